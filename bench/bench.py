@@ -0,0 +1,156 @@
+# Decode every file of the benchmark corpus with mp3dec and write the results as JSON.
+# Runs on the MicroPython unix port built by bench/run.sh (MP3DEC_BENCH enables stack_peak).
+#
+# Usage: micropython bench.py corpus_dir results.json [buf_size] [repeats]
+#
+# Per file: best-of-repeats decode time through an in-memory stream,
+# frames/sec, realtime_x (seconds of audio decoded per second), bytes
+# memmoved and heap bytes allocated per frame (gc disabled while decoding),
+# peak stack below decode(), and the decoder health counters.
+# A separate untimed pass measures the heap one decoder holds (object, input
+# buffer, checkpoints) and the most heap a single decode() call allocated,
+# and the time from construction to the first frame for a stream and for the
+# same data as an in-memory source.
+# The mixer section mixes 1, 2, 4 and 8 voices of cbr_128 (or the first file)
+# at gain 1/N and reports mixed frames/sec (1152 sample frames of output).
+import gc
+import io
+import json
+import os
+import sys
+import time
+
+from mp3dec import MP3Decoder, Mixer
+
+PCM_BYTES = 1152 * 2 * 2  # One frame, stereo int16
+MIXER_VOICES = (1, 2, 4, 8)
+MIXER_FILE = "cbr_128"
+
+
+def bench_file(data, buf_size, repeats):
+    pcm = bytearray(PCM_BYTES)
+    best_us = None
+    for _ in range(repeats):
+        gc.collect()
+        gc.disable()
+        dec = MP3Decoder(io.BytesIO(data), buf_size)
+        heap0 = gc.mem_alloc()
+        audio_sec = 0.0
+        t0 = time.ticks_us()
+        while True:
+            n = dec.decode(pcm)
+            if not n:
+                break
+            audio_sec += n / (2 * dec.get_channels() * dec.get_sample_rate())
+        elapsed = time.ticks_diff(time.ticks_us(), t0)
+        heap = gc.mem_alloc() - heap0
+        gc.enable()
+        if best_us is None or elapsed < best_us:
+            best_us = elapsed
+    stats = dec.stats()
+    frames = max(1, stats["frames"])
+    return {
+        "bytes": len(data),
+        "frames": stats["frames"],
+        "audio_sec": audio_sec,
+        "decode_ms": best_us / 1000,
+        "frames_per_sec": stats["frames"] * 1000000 / max(1, best_us),
+        "realtime_x": audio_sec * 1000000 / max(1, best_us),
+        "moved_per_frame": stats["bytes_moved"] / frames,
+        "heap_per_frame": heap / frames,
+        "stack_peak": stats.get("stack_peak", 0),
+        "obj_bytes": stats.get("obj_bytes", 0),
+        "buf_bytes": stats.get("buf_bytes", 0),
+        "cp_bytes": stats.get("cp_bytes", 0),
+        "refills": stats["refills"],
+        "sync_losses": stats["sync_losses"],
+        "bytes_skipped": stats["bytes_skipped"],
+        "reservoir_miss": stats["reservoir_miss"],
+    }
+
+
+def memory_file(data, buf_size):
+    pcm = bytearray(PCM_BYTES)
+    stream = io.BytesIO(data)
+    gc.collect()
+    gc.disable()
+    heap0 = gc.mem_alloc()
+    dec = MP3Decoder(stream, buf_size)
+    held = gc.mem_alloc() - heap0
+    call_peak = 0
+    while True:
+        heap0 = gc.mem_alloc()
+        n = dec.decode(pcm)
+        call_peak = max(call_peak, gc.mem_alloc() - heap0)
+        if not n:
+            break
+    gc.enable()
+    return held, call_peak
+
+
+def start_us(source, buf_size):
+    pcm = bytearray(PCM_BYTES)
+    t0 = time.ticks_us()
+    MP3Decoder(source, buf_size).decode(pcm)
+    return time.ticks_diff(time.ticks_us(), t0)
+
+
+def bench_mixer(data, voices, repeats):
+    out = bytearray(PCM_BYTES)
+    best_us, frames = None, 0
+    for _ in range(repeats):
+        gc.collect()
+        mixer = Mixer(2)
+        for _ in range(voices):
+            mixer.add(MP3Decoder(data), 1 / voices)
+        frames = 0
+        t0 = time.ticks_us()
+        while True:
+            n = mixer.mix(out)
+            if not n:
+                break
+            frames += n // 4
+        elapsed = time.ticks_diff(time.ticks_us(), t0)
+        if best_us is None or elapsed < best_us:
+            best_us = elapsed
+    return frames / 1152 * 1000000 / max(1, best_us)
+
+
+def main():
+    if len(sys.argv) < 3:
+        print("usage: bench.py corpus_dir results.json [buf_size] [repeats]")
+        sys.exit(2)
+    corpus, out = sys.argv[1], sys.argv[2]
+    buf_size = int(sys.argv[3]) if len(sys.argv) > 3 else 8192
+    repeats = int(sys.argv[4]) if len(sys.argv) > 4 else 3
+
+    results = {}
+    names = sorted(n for n in os.listdir(corpus) if n.endswith(".mp3"))
+    for name in names:
+        with open(corpus + "/" + name, "rb") as f:
+            data = f.read()
+        r = bench_file(data, buf_size, repeats)
+        r["heap_held"], r["heap_call_peak"] = memory_file(data, buf_size)
+        r["start_us"] = start_us(io.BytesIO(data), buf_size)
+        r["start_mem_us"] = start_us(data, buf_size)
+        results[name[:-4]] = r
+        print("%-20s %7.1f ms %8.0f fps %7.1fx rt  moved %6.0f B/f  heap %5.1f B/f  held %6d  stack %5d" % (
+            name[:-4], r["decode_ms"], r["frames_per_sec"], r["realtime_x"],
+            r["moved_per_frame"], r["heap_per_frame"], r["heap_held"], r["stack_peak"]))
+        data = None
+        gc.collect()
+
+    mixer = {}
+    name = MIXER_FILE + ".mp3" if MIXER_FILE + ".mp3" in names else names[0]
+    with open(corpus + "/" + name, "rb") as f:
+        data = f.read()
+    for voices in MIXER_VOICES:
+        mixer[str(voices)] = bench_mixer(data, voices, repeats)
+        print("mixer %d voices (%s) %8.0f mixed fps" % (voices, name[:-4], mixer[str(voices)]))
+
+    with open(out, "w") as f:
+        f.write(json.dumps({"version": 1, "buf_size": buf_size, "repeats": repeats, "files": results,
+                            "mixer": mixer}))
+
+
+main()
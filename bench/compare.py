@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+"""Compare two bench/bench.py result files.
+
+Prints per-file changes in decode speed, memmoved bytes, heap use and stack,
+the geometric mean of the speed ratios, the mixer speed per voice count and
+the static section sizes. Exits 1 if the geometric mean speed (of the files
+or of the mixer) drops by more than --threshold percent, or if a
+deterministic metric (memmoved bytes, heap bytes per frame and held, peak
+stack, static sections) grows by more than that.
+
+Usage: bench/compare.py [--threshold PCT] baseline.json results.json
+"""
+
+import argparse
+import json
+import math
+import sys
+
+# deterministic per-file metrics: any growth beyond the threshold fails
+STRICT = ('moved_per_frame', 'heap_per_frame', 'heap_held', 'stack_peak')
+
+
+def pct(new, old):
+    return (new - old)*100.0/old if old else 0.0
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('--threshold', type=float, default=5.0, help='allowed regression in percent (default 5)')
+    ap.add_argument('baseline')
+    ap.add_argument('results')
+    args = ap.parse_args()
+
+    base_run = json.load(open(args.baseline))
+    new_run = json.load(open(args.results))
+    base, new = base_run['files'], new_run['files']
+    failures = []
+    ratios = []
+
+    print('%-20s %10s %10s %7s %9s %9s %9s' % ('file', 'base fps', 'fps', 'speed', 'moved', 'heap', 'stack'))
+    for name in sorted(set(base) | set(new)):
+        if name not in base or name not in new:
+            print('%-20s %s' % (name, 'only in baseline' if name in base else 'new file'))
+            continue
+        b, n = base[name], new[name]
+        if b['frames'] != n['frames']:
+            failures.append('%s: %d frames, baseline %d' % (name, n['frames'], b['frames']))
+        ratio = n['frames_per_sec']/b['frames_per_sec'] if b['frames_per_sec'] else 1.0
+        ratios.append(ratio)
+        print('%-20s %10.0f %10.0f %+6.1f%% %+8.1f%% %+8.1f%% %+8.1f%%' % (
+            name, b['frames_per_sec'], n['frames_per_sec'], (ratio - 1)*100,
+            pct(n['moved_per_frame'], b['moved_per_frame']),
+            pct(n['heap_per_frame'], b['heap_per_frame']),
+            pct(n['stack_peak'], b['stack_peak'])))
+        for key in STRICT:
+            # baselines from older bench.py versions may lack a metric
+            if key in b and key in n and pct(n[key], b[key]) > args.threshold:
+                failures.append('%s: %s %.1f -> %.1f' % (name, key, b[key], n[key]))
+
+    if ratios:
+        geomean = math.exp(sum(math.log(r) for r in ratios)/len(ratios))
+        print('geometric mean speed: %+.1f%%' % ((geomean - 1)*100))
+        if (1 - geomean)*100 > args.threshold:
+            failures.append('speed: geometric mean %+.1f%%' % ((geomean - 1)*100))
+
+    # mixed frames/sec per voice count, when both runs have them
+    base_mix, new_mix = base_run.get('mixer', {}), new_run.get('mixer', {})
+    mix_ratios = []
+    for voices in sorted(set(base_mix) & set(new_mix), key=int):
+        ratio = new_mix[voices]/base_mix[voices] if base_mix[voices] else 1.0
+        mix_ratios.append(ratio)
+        print('mixer %s voices: %.0f -> %.0f mixed fps (%+.1f%%)' % (
+            voices, base_mix[voices], new_mix[voices], (ratio - 1)*100))
+    if mix_ratios:
+        geomean = math.exp(sum(math.log(r) for r in mix_ratios)/len(mix_ratios))
+        if (1 - geomean)*100 > args.threshold:
+            failures.append('mixer speed: geometric mean %+.1f%%' % ((geomean - 1)*100))
+
+    # static sections from bench/memory.py, when both runs have them
+    base_static, new_static = base_run.get('static'), new_run.get('static')
+    if base_static and new_static:
+        print('static: ' + ', '.join('%s %d (%+.1f%%)' % (k, new_static[k], pct(new_static[k], base_static.get(k, 0)))
+                                     for k in sorted(new_static)))
+        for key in sorted(new_static):
+            if pct(new_static[key], base_static.get(key, 0)) > args.threshold:
+                failures.append('static %s: %d -> %d' % (key, base_static.get(key, 0), new_static[key]))
+
+    for f in failures:
+        print('REGRESSION', f)
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,230 @@
+#!/usr/bin/env python3
+"""Generate the benchmark corpus for bench/bench.py.
+
+A deterministic test signal (chords, bass, drum hits, a fade to silence) is
+written as WAV and encoded with LAME into the variants below. Files LAME
+cannot produce are built directly:
+
+    cbr_*        CBR 32..320 kbps, MPEG-1 joint stereo
+    vbr_*        VBR -V0/-V4/-V9
+    mono_*, stereo_*, ms_*
+                 channel modes (mono, simple stereo, forced mid/side)
+    mpeg2_*, mpeg25_*
+                 MPEG-2 and MPEG-2.5 sample rates
+    free_*       free-format
+    id3_*        cbr_128 behind a 64 KB ID3v2 tag, with an ID3v1 tail
+    corrupt_*    cbr_128 with bit flips, zeroed runs, dropped chunks and a cut end
+    synth_is_*   intensity stereo frames with random side info and payload
+                 (MPEG-1 and LSF). They are structurally valid but not music.
+
+Usage: bench/gen_corpus.py [--seconds N] [--synthetic-only] [out_dir]
+"""
+
+import argparse
+import array
+import math
+import os
+import random
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+import wave
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_OUT = os.path.join(HERE, 'out', 'corpus')
+RATE = 44100
+
+# name: LAME options
+LAME_VARIANTS = [
+    ('cbr_032', ['-b', '32', '--resample', '32']),
+    ('cbr_064', ['-b', '64']),
+    ('cbr_128', ['-b', '128']),
+    ('cbr_192', ['-b', '192']),
+    ('cbr_256', ['-b', '256']),
+    ('cbr_320', ['-b', '320']),
+    ('vbr_v0', ['-V', '0']),
+    ('vbr_v4', ['-V', '4']),
+    ('vbr_v9', ['-V', '9']),
+    ('mono_096', ['-m', 'm', '-b', '96']),
+    ('stereo_160', ['-m', 's', '-b', '160']),
+    ('ms_128', ['-m', 'f', '-b', '128']),
+    ('mpeg2_22k_064', ['--resample', '22.05', '-b', '64']),
+    ('mpeg2_16k_032_mono', ['--resample', '16', '-m', 'm', '-b', '32']),
+    ('mpeg25_11k_032', ['--resample', '11.025', '-b', '32']),
+    ('mpeg25_8k_016_mono', ['--resample', '8', '-m', 'm', '-b', '16']),
+    ('free_400', ['--freeformat', '-b', '400']),
+]
+
+
+def test_signal(seconds, seed):
+    """Interleaved 16-bit stereo: a chord every 1.5 s, bass, drum hits every 0.375 s."""
+    rnd = random.Random(seed)
+    n = int(seconds*RATE)
+    fade = max(1, n - RATE)  # last second fades out to digital silence
+    chords = [(220.0, 277.2, 329.6), (196.0, 246.9, 293.7), (174.6, 220.0, 261.6), (164.8, 207.7, 246.9)]
+    pcm = array.array('h', bytes(4*n))
+    hit, hit_len = 0.0, int(0.03*RATE)
+    for i in range(n):
+        t = i/RATE
+        notes = chords[int(t/1.5) % len(chords)]
+        left = right = 0.0
+        for k, f in enumerate(notes):
+            pan = 0.2 + 0.3*k
+            for h in range(1, 5):
+                v = math.sin(2*math.pi*f*h*t*(1.0 + 0.002*k))/h
+                left += v*(1.0 - pan)
+                right += v*pan
+        bass = 0.8*math.sin(math.pi*notes[0]*t)
+        if i % int(0.375*RATE) == 0:
+            hit = 1.0
+        drum = 0.0
+        if hit > 0.001:
+            drum = hit*(rnd.random()*2 - 1)*1.5
+            hit *= math.exp(-1.0/hit_len)
+        gain = 3000.0*min(1.0, (n - i)/(n - fade)) if i > fade else 3000.0
+        pcm[2*i] = int(max(-32767, min(32767, (left + bass + drum)*gain)))
+        pcm[2*i + 1] = int(max(-32767, min(32767, (right + bass + 0.7*drum)*gain)))
+    return pcm
+
+
+def write_wav(path, pcm):
+    with wave.open(path, 'wb') as w:
+        w.setnchannels(2)
+        w.setsampwidth(2)
+        w.setframerate(RATE)
+        if sys.byteorder == 'big':
+            pcm = array.array('h', pcm)
+            pcm.byteswap()
+        w.writeframes(pcm.tobytes())
+
+
+def id3v2_tag(rnd, image_bytes):
+    def syncsafe(n):
+        return bytes([(n >> 21) & 0x7f, (n >> 14) & 0x7f, (n >> 7) & 0x7f, n & 0x7f])
+
+    def frame(fid, body):
+        return fid.encode() + syncsafe(len(body)) + b'\0\0' + body
+
+    title = frame('TIT2', b'\x03mp3dec benchmark')
+    image = frame('APIC', b'\x03image/jpeg\x00\x03\x00' + bytes(rnd.getrandbits(8) for _ in range(image_bytes)))
+    body = title + image + bytes(256)  # padding
+    return b'ID3\x04\x00\x00' + syncsafe(len(body)) + body
+
+
+def id3v1_tag():
+    return b'TAG' + b'mp3dec benchmark'.ljust(30, b'\0') + bytes(30 + 30 + 4 + 30) + b'\xff'
+
+
+def corrupt(data, rnd):
+    out = bytearray(data)
+    for pos in range(0, len(out) - 4096, 4096):  # a flipped bit every 4 KB
+        out[pos + rnd.randrange(4096)] ^= 1 << rnd.randrange(8)
+    for _ in range(5):  # zeroed runs, e.g. bad sectors
+        pos = rnd.randrange(len(out) - 512)
+        out[pos:pos + 512] = bytes(512)
+    for _ in range(3):  # dropped chunks, e.g. lost packets
+        pos = rnd.randrange(len(out) - 300)
+        del out[pos:pos + 300]
+    return bytes(out[:len(out) - 777])  # ends mid-frame
+
+
+class BitWriter:
+    def __init__(self):
+        self.bits = []
+
+    def put(self, value, n):
+        self.bits.extend((value >> i) & 1 for i in range(n - 1, -1, -1))
+
+    def tobytes(self):
+        bits = self.bits + [0]*(-len(self.bits) % 8)
+        return bytes(int(''.join(map(str, bits[i:i + 8])), 2) for i in range(0, len(bits), 8))
+
+
+def synth_is_frame(rnd, mpeg1):
+    """One joint-stereo Layer III frame with intensity stereo on and random side info."""
+    sri, bri = 0, 9  # 44.1 kHz / 22.05 kHz, 128 kbps / 80 kbps
+    kbps = 128 if mpeg1 else 80
+    hz = 44100 if mpeg1 else 22050
+    size = (144 if mpeg1 else 72)*kbps*1000//hz
+    h = BitWriter()
+    h.put(0x7ff, 11); h.put(3 if mpeg1 else 2, 2); h.put(1, 2); h.put(1, 1)
+    h.put(bri, 4); h.put(sri, 2); h.put(0, 1); h.put(0, 1)
+    h.put(1, 2); h.put(rnd.choice([1, 3]), 2); h.put(0, 4)  # joint stereo, IS (+MS)
+    body = BitWriter()
+    granules = 2 if mpeg1 else 1
+    if mpeg1:
+        body.put(rnd.randrange(0, 300), 9); body.put(0, 3)
+        for _ in range(2):
+            body.put(rnd.getrandbits(4), 4)
+    else:
+        body.put(rnd.randrange(0, 200), 8); body.put(0, 2)
+    side_bytes = 32 if mpeg1 else 17
+    avail = (size - 4 - side_bytes)*8
+    for _ in range(granules):
+        for _ in range(2):
+            body.put(rnd.randrange(0, max(1, avail//(2*granules))), 12)
+            body.put(rnd.randrange(0, 289), 9)
+            body.put(rnd.randrange(120, 256), 8)
+            body.put(rnd.getrandbits(4 if mpeg1 else 9), 4 if mpeg1 else 9)
+            short = rnd.random() < 0.3
+            body.put(short, 1)
+            if short:
+                body.put(rnd.choice([1, 2, 3]), 2); body.put(rnd.getrandbits(1), 1)
+                body.put(rnd.getrandbits(10), 10); body.put(rnd.getrandbits(9), 9)
+            else:
+                body.put(rnd.getrandbits(15), 15); body.put(rnd.getrandbits(4), 4); body.put(rnd.getrandbits(3), 3)
+            if mpeg1:
+                body.put(rnd.getrandbits(1), 1)
+            body.put(rnd.getrandbits(2), 2)
+    side = body.tobytes()
+    return h.tobytes() + side + bytes(rnd.getrandbits(8) for _ in range(size - 4 - len(side)))
+
+
+def synth_is(seconds, mpeg1, seed):
+    rnd = random.Random(seed)
+    frames = int(seconds*(44100/1152 if mpeg1 else 22050/576))
+    return b''.join(synth_is_frame(rnd, mpeg1) for _ in range(frames))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('--seconds', type=float, default=12.0, help='length of each file (default 12)')
+    ap.add_argument('--synthetic-only', action='store_true', help='skip the LAME-encoded files')
+    ap.add_argument('out', nargs='?', default=DEFAULT_OUT)
+    args = ap.parse_args()
+
+    os.makedirs(args.out, exist_ok=True)
+    rnd = random.Random(1)
+
+    def save(name, data):
+        with open(os.path.join(args.out, name + '.mp3'), 'wb') as f:
+            f.write(data)
+        print('%-20s %8d bytes' % (name, len(data)))
+
+    if not args.synthetic_only:
+        if not shutil.which('lame'):
+            sys.exit('gen_corpus: lame not found (install it, or pass --synthetic-only)')
+        tmp = tempfile.mkdtemp()
+        try:
+            wav = os.path.join(tmp, 'signal.wav')
+            write_wav(wav, test_signal(args.seconds, 1))
+            for name, opts in LAME_VARIANTS:
+                mp3 = os.path.join(tmp, name + '.mp3')
+                subprocess.run(['lame', '--quiet', '--noreplaygain', '-t'] + opts + [wav, mp3], check=True)
+                with open(mp3, 'rb') as f:
+                    save(name, f.read())
+        finally:
+            shutil.rmtree(tmp)
+        with open(os.path.join(args.out, 'cbr_128.mp3'), 'rb') as f:
+            cbr = f.read()
+        save('id3_cbr_128', id3v2_tag(rnd, 64*1024) + cbr + id3v1_tag())
+        save('corrupt_cbr_128', corrupt(cbr, rnd))
+
+    save('synth_is_mpeg1', synth_is(args.seconds, True, 2))
+    save('synth_is_lsf', synth_is(args.seconds, False, 3))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""Static memory of the decoder objects, from their symbol table.
+
+Sums code (.text), constant tables (.rodata, flash on the ESP32), initialized
+data (.data) and zeroed data (.bss) over the given object files and lists the
+largest tables, so build options can be compared for flash and static RAM.
+The per-decoder heap and stack are measured by bench.py.
+
+Usage: bench/memory.py [--json results.json] [--top N] file.o ...
+
+--json merges the totals into a bench.py result file as "static", where
+compare.py checks them against the baseline.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+
+# nm symbol type -> section class
+CLASSES = {'t': 'text', 'r': 'rodata', 'd': 'data', 'b': 'bss'}
+
+
+def symbols(path):
+    """(name, size, class) of every sized symbol in an object file."""
+    out = subprocess.run(['nm', '-S', '--size-sort', path], check=True, stdout=subprocess.PIPE,
+                         universal_newlines=True).stdout
+    for line in out.splitlines():
+        parts = line.split()
+        if len(parts) != 4:
+            continue
+        cls = CLASSES.get(parts[2].lower())
+        if cls:
+            yield parts[3], int(parts[1], 16), cls
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('--json', help='bench.py result file to add the totals to')
+    ap.add_argument('--top', type=int, default=12, help='tables to list (default 12)')
+    ap.add_argument('objects', nargs='+')
+    args = ap.parse_args()
+
+    totals = dict.fromkeys(('text', 'rodata', 'data', 'bss'), 0)
+    tables = []
+    for path in args.objects:
+        for name, size, cls in symbols(path):
+            totals[cls] += size
+            if cls != 'text':
+                tables.append((size, name, cls, os.path.basename(path)))
+
+    print('%-10s %8s' % ('section', 'bytes'))
+    for cls, size in totals.items():
+        print('%-10s %8d' % (cls, size))
+    print('static RAM (data + bss): %d bytes' % (totals['data'] + totals['bss']))
+    tables.sort(reverse=True)
+    print('largest tables:')
+    for size, name, cls, obj in tables[:args.top]:
+        print('  %-28s %7d  %-6s %s' % (name, size, cls, obj))
+
+    if args.json:
+        with open(args.json) as f:
+            results = json.load(f)
+        results['static'] = totals
+        with open(args.json, 'w') as f:
+            json.dump(results, f)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,50 @@
+#!/bin/sh
+# Build the MicroPython unix port with mp3dec, generate the corpus and benchmark it.
+#
+# Usage: bench/run.sh [--save-baseline] [make VAR=value ...]
+#
+# Extra arguments go to make, e.g. MP3DEC_VECTOR_EXT=1 to benchmark a build
+# option. Results (speed, heap, stack and the static sizes from memory.py)
+# land in bench/out/results.json and are compared against bench/baseline.json
+# when it exists; --save-baseline replaces it instead.
+#
+# Environment: MICROPY_DIR (default ../micropython next to this repo, cloned
+# at MICROPY_REF=v1.26.1 if missing), BUF_SIZE (8192), REPEATS (3).
+set -e
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+REPO=$(dirname "$HERE")
+OUT=$HERE/out
+MICROPY_DIR=${MICROPY_DIR:-$REPO/../micropython}
+MICROPY_REF=${MICROPY_REF:-v1.26.1}
+
+SAVE_BASELINE=0
+if [ "$1" = "--save-baseline" ]; then
+    SAVE_BASELINE=1
+    shift
+fi
+
+if [ ! -d "$MICROPY_DIR" ]; then
+    git clone --depth 1 -b "$MICROPY_REF" https://github.com/micropython/micropython "$MICROPY_DIR"
+fi
+make -C "$MICROPY_DIR/mpy-cross" -j"$(nproc)"
+make -C "$MICROPY_DIR/ports/unix" submodules
+make -C "$MICROPY_DIR/ports/unix" -j"$(nproc)" BUILD=build-mp3bench \
+    USER_C_MODULES="$REPO/modules" CFLAGS_EXTRA="-DMP3DEC_BENCH" "$@"
+
+mkdir -p "$OUT"
+[ -d "$OUT/corpus" ] || python3 "$HERE/gen_corpus.py" "$OUT/corpus"
+
+"$MICROPY_DIR/ports/unix/build-mp3bench/micropython" -X heapsize=32M \
+    "$HERE/bench.py" "$OUT/corpus" "$OUT/results.json" "${BUF_SIZE:-8192}" "${REPEATS:-3}"
+
+# Flash and static RAM of this build's decoder objects
+python3 "$HERE/memory.py" --json "$OUT/results.json" \
+    $(find "$MICROPY_DIR/ports/unix/build-mp3bench" -path '*mp3dec*' -name '*.o')
+
+if [ "$SAVE_BASELINE" = 1 ]; then
+    cp "$OUT/results.json" "$HERE/baseline.json"
+    echo "saved bench/baseline.json"
+elif [ -f "$HERE/baseline.json" ]; then
+    python3 "$HERE/compare.py" "$HERE/baseline.json" "$OUT/results.json"
+fi
@@ -0,0 +1,684 @@
+// Native command line decoder on top of mp3dec_core (no MicroPython).
+// Decodes a file the way MP3Decoder does, writes raw PCM or WAV and reports
+// throughput, so decoder changes can be profiled with perf/valgrind.
+//
+// Usage: mp3dec [options] input.mp3 [output.wav|output.raw|-]
+//   -b N    input buffer size (default 8192, below 4096: small-buffer mode)
+//   -s N    sync matches, 1..10 (decoder.set_sync_matches)
+//   -q N    fixed quality level 0..3 (decoder.set_governor(0, N))
+//   -g T    governor target load, 0..1 (decoder.set_governor(T))
+//   -v N    volume 0..100
+//   -m      mix stereo to mono
+//   -t SEC  start at SEC (decoder.scan)
+//   -r N    decode N times and report the fastest run
+//   -i      load the file into memory and decode it in place (zero-copy source)
+//   -I N    live stream mode, the input is an ICY stream with metadata every
+//           N bytes (decoder.set_live(N)); prints each new StreamTitle. With
+//           input "-" (e.g. a connected socket) stdin is read without
+//           blocking and frames are decoded at playback speed, as on a board
+//   -G      gapless: drop the Xing/Info frame, encoder delay and padding
+//   -x N    mix N voices of the file (mp3dec.Mixer, 1..8, each at gain 1/N)
+//           and report mixed frames/s (1152 sample frames of output)
+//   -n FILE play FILE after the input (mp3dec.Playlist, gapless; up to 3 times)
+//   -c SEC  crossfade between playlist tracks (playlist.set_crossfade)
+//   -S N    spectrum tap with N bars (decoder.set_spectrum); prints the
+//           levels over the whole file
+//   -E G    equalizer: G is 1..32 comma-separated gains in dB
+//           (decoder.set_eq), or pN for preset N (e.g. p1 = EQ_BASS)
+//   -T B,T  bass and treble shelves in dB (decoder.set_tone)
+//   -O SEC  loudness overview with a level per SEC seconds (decoder.overview);
+//           reports its time against the decode and how closely the levels
+//           follow the decoded PCM
+//   -k L,F,A,B  simulated CPU contention: the core reads a virtual clock on
+//           which a full-quality frame costs L of its duration, F times that
+//           for frames A..B-1 (the other levels scaled by their measured
+//           speed); reports the frames a 2-frame output buffer would miss and
+//           how the quality level moved (use with -g, or -q 0 to compare)
+// Input "-" is stdin (a plain decode, once). Output is WAV when the name ends
+// in .wav, otherwise raw 16-bit native-endian PCM ("-" for stdout).
+// Statistics go to stderr.
+#define _POSIX_C_SOURCE 199309L
+#include "mp3dec_core.h"
+#include "mp3dec_mixer.h"
+#include "mp3dec_playlist.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef struct _cli_opts_t {
+    size_t buf_size;
+    int sync_matches;
+    int quality;
+    float gov_target;
+    int volume;
+    bool mono;
+    float start_sec;
+    int repeats;
+    bool in_memory;
+    long icy_metaint;     // -I: live mode (-1: off)
+    bool paced;           // -I with input "-": non-blocking reads, playback speed
+    int voices;           // -x: mixer voices (0: plain decode)
+    bool gapless;
+    const char *next[MP3DEC_PLAYLIST_MAX - 1]; // -n: playlist tracks after the input
+    int next_count;
+    float crossfade;      // -c: seconds
+    int spectrum_bars;    // -S (0: off)
+    float eq_db[MP3DEC_SPECTRUM_BANDS]; // -E
+    int eq_bands;
+    int eq_preset;        // -E pN (-1: none)
+    float bass_db, treble_db; // -T
+    float overview_sec;   // -O (0: off)
+    float sim_load;       // -k (0: off)
+    float sim_factor;
+    unsigned sim_from, sim_to;
+} cli_opts_t;
+
+#define CLI_OVERVIEW_MAX 4096 // -O levels
+#define CLI_OVERVIEW_DB  60   // Their range, the overview's default
+
+// Levels of the decoded PCM per o->overview_sec, for comparison with the overview
+typedef struct _cli_levels_t {
+    double power;         // Sum of squares of the level being summed
+    uint32_t samples;     // Its samples (all channels)
+    uint32_t end;         // Sample frame where the next level starts
+    uint32_t pos;         // Sample frames decoded
+    size_t n;
+    uint8_t level[CLI_OVERVIEW_MAX];
+} cli_levels_t;
+
+#define CLI_SIM_BUFFER 2 // -k: decoded frames queued for playback
+
+// -k: virtual clock and playback model. A frame's cost is added to the clock
+// right after the core reads it before decoding, so the governor sees exactly
+// that cost; playback starts once CLI_SIM_BUFFER frames are decoded and
+// stalls when a frame is late.
+typedef struct _cli_sim_t {
+    double rel[MP3D_QUALITY_LOWEST + 1]; // Decode time per quality level, relative to full
+    double virtual_us;
+    double pending_us;    // Cost of the frame being decoded
+    uint32_t frame;       // Frames decoded
+    double done;          // Virtual time the last one was ready
+    double play;          // Virtual time frame 0 started (moved by stalls)
+    uint32_t late;
+    int quality, peak;
+    uint32_t down, up;    // Quality level steps
+} cli_sim_t;
+
+typedef struct _cli_result_t {
+    double busy;          // Seconds spent in the core
+    double audio_sec;
+    uint32_t data_bytes;
+    int hz;               // Output format, from the first frame
+    int channels;
+} cli_result_t;
+
+// --- Host Callbacks ---
+static size_t cli_read(void *ctx, uint8_t *buf, size_t len) {
+    return fread(buf, 1, len, (FILE *)ctx);
+}
+
+// -I from stdin: whatever has arrived, like a socket's recv() on a board
+static size_t cli_read_live(void *ctx, uint8_t *buf, size_t len) {
+    ssize_t n = read(fileno((FILE *)ctx), buf, len);
+    if (n < 0) return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? MP3DEC_IO_AGAIN : 0;
+    return (size_t)n;
+}
+
+static int cli_seek(void *ctx, size_t offset) {
+    return fseek((FILE *)ctx, (long)offset, SEEK_SET);
+}
+
+static uint32_t cli_ticks_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u);
+}
+
+static cli_sim_t cli_sim;
+
+static uint32_t cli_sim_ticks_us(void) {
+    uint32_t now = (uint32_t)(uint64_t)cli_sim.virtual_us;
+    cli_sim.virtual_us += cli_sim.pending_us;
+    cli_sim.pending_us = 0.0;
+    return now;
+}
+
+static double cli_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void cli_sleep(double sec) {
+    if (sec <= 0.0) return;
+    struct timespec ts = { (time_t)sec, (long)((sec - (double)(time_t)sec) * 1e9) };
+    nanosleep(&ts, NULL);
+}
+
+// --- WAV Output ---
+static void cli_put_le(uint8_t *p, uint32_t v, int bytes) {
+    for (int i = 0; i < bytes; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+// 44-byte PCM header; rewritten with the real sizes once decoding is done
+static void cli_write_wav_header(FILE *out, int hz, int channels, uint32_t data_bytes) {
+    uint8_t h[44];
+    memcpy(h, "RIFF", 4);
+    cli_put_le(h + 4, 36 + data_bytes, 4);
+    memcpy(h + 8, "WAVEfmt ", 8);
+    cli_put_le(h + 16, 16, 4);
+    cli_put_le(h + 20, 1, 2); // PCM
+    cli_put_le(h + 22, channels, 2);
+    cli_put_le(h + 24, hz, 4);
+    cli_put_le(h + 28, hz * channels * 2, 4);
+    cli_put_le(h + 32, channels * 2, 2);
+    cli_put_le(h + 34, 16, 2);
+    memcpy(h + 36, "data", 4);
+    cli_put_le(h + 40, data_bytes, 4);
+    fwrite(h, 1, sizeof(h), out);
+}
+
+// WAV is little-endian; raw output keeps the native order
+static void cli_write_pcm(FILE *out, int16_t *pcm, int bytes, bool wav) {
+    const uint16_t probe = 1;
+    if (wav && *(const uint8_t *)&probe == 0) {
+        for (int i = 0; i < bytes / 2; i++) pcm[i] = (int16_t)(((uint16_t)pcm[i] >> 8) | ((uint16_t)pcm[i] << 8));
+    }
+    fwrite(pcm, 1, bytes, out);
+}
+
+// --- Decode Loop ---
+static void cli_setup(const cli_opts_t *o, mp3dec_core_t *core) {
+    if (o->sync_matches) mp3dec_core_set_sync_matches(core, o->sync_matches);
+    mp3dec_core_set_governor(core, o->gov_target, o->gov_target > 0.0f ? MP3D_QUALITY_LOWEST : o->quality);
+    mp3dec_core_set_volume(core, o->volume);
+    core->force_mono = o->mono;
+    if (o->icy_metaint >= 0) mp3dec_core_set_live(core, (uint32_t)o->icy_metaint, 0, 0);
+    mp3dec_core_set_gapless(core, o->gapless);
+    mp3dec_core_set_spectrum(core, o->spectrum_bars, 0);
+    if (o->eq_preset >= 0) mp3dec_core_set_eq_preset(core, o->eq_preset);
+    else mp3dec_core_set_eq(core, o->eq_db, o->eq_bands);
+    mp3dec_core_set_tone(core, o->bass_db, o->treble_db);
+}
+
+// -k: account one decoded frame that took cost_us of virtual time
+static void cli_sim_frame(double cost_us, double frame_us, int quality) {
+    cli_sim_t *sim = &cli_sim;
+    uint32_t k = sim->frame++;
+    if (k < CLI_SIM_BUFFER) {
+        sim->done += cost_us;
+        sim->play = sim->done;
+    } else {
+        double room = sim->play + (k - CLI_SIM_BUFFER) * frame_us; // Frame k - CLI_SIM_BUFFER starts playing
+        double due = sim->play + k * frame_us;
+        sim->done = (sim->done > room ? sim->done : room) + cost_us;
+        if (sim->done > due) {
+            sim->late++;
+            sim->play += sim->done - due;
+        }
+    }
+    if (quality > sim->quality) sim->down++;
+    if (quality < sim->quality) sim->up++;
+    if (quality > sim->peak) sim->peak = quality;
+    sim->quality = quality;
+}
+
+// Same scale as the overview: 0..255 over the CLI_OVERVIEW_DB below full scale
+static void cli_levels_flush(cli_levels_t *lv) {
+    if (lv->samples == 0 || lv->n == CLI_OVERVIEW_MAX) return;
+    double p = lv->power / lv->samples / (32768.0 * 32768.0);
+    double level = p > 0.0 ? 255.0 * (10.0 * log10(p) + CLI_OVERVIEW_DB) / CLI_OVERVIEW_DB : 0.0;
+    lv->level[lv->n++] = level <= 0.0 ? 0 : level >= 255.0 ? 255 : (uint8_t)level;
+    lv->power = 0.0;
+    lv->samples = 0;
+}
+
+// Add a decoded frame (levels change on frame starts, like the overview's)
+static void cli_levels_add(cli_levels_t *lv, const int16_t *pcm, int samples, int channels, int hz, float sec) {
+    if (lv->end == 0) lv->end = (uint32_t)(sec * hz);
+    if (lv->pos >= lv->end) {
+        cli_levels_flush(lv);
+        lv->end += (uint32_t)(sec * hz);
+    }
+    for (int i = 0; i < samples * channels; i++) lv->power += (double)pcm[i] * pcm[i];
+    lv->samples += samples * channels;
+    lv->pos += samples;
+}
+
+// One pass over the file; PCM is only written when out != NULL, levels
+// summed when lv != NULL. With -i, buf holds the whole file (buf_len bytes)
+// and is decoded in place.
+static void cli_decode(const cli_opts_t *o, FILE *in, FILE *out, bool wav, mp3dec_core_t *core,
+    uint8_t *buf, size_t buf_len, mp3dec_checkpoint_t *cp, cli_levels_t *lv, cli_result_t *res) {
+    static int16_t pcm[MINIMP3_MAX_SAMPLES_PER_FRAME];
+    const mp3dec_core_io_t io = { o->paced ? cli_read_live : cli_read, cli_seek,
+        o->sim_load > 0.0f ? cli_sim_ticks_us : cli_ticks_us, in };
+    char title[MP3DEC_ICY_TITLE_MAX + 1] = "";
+
+    if (o->in_memory) {
+        mp3dec_core_init_mem(core, &io, buf, buf_len, cp, MP3DEC_DEFAULT_CP_MAX);
+    } else {
+        rewind(in);
+        mp3dec_core_init(core, &io, buf, buf_len, cp, MP3DEC_DEFAULT_CP_MAX);
+    }
+    cli_setup(o, core);
+
+    memset(res, 0, sizeof(*res));
+    double frame_us = 0.0; // -k: the previous frame's duration (the first frame is free)
+    if (o->sim_load > 0.0f) {
+        double rel[MP3D_QUALITY_LOWEST + 1];
+        memcpy(rel, cli_sim.rel, sizeof(rel));
+        memset(&cli_sim, 0, sizeof(cli_sim));
+        memcpy(cli_sim.rel, rel, sizeof(rel));
+        cli_sim.quality = core->mp3d.quality;
+    }
+    if (o->start_sec > 0.0f && mp3dec_core_scan(core, false, 0, 0.0f, o->start_sec) <= 0) return;
+
+    double due = 0.0; // -I from stdin: when the next frame plays (0: after a (re)buffer)
+    while (1) {
+        if (o->paced) cli_sleep(due - cli_now());
+        if (o->sim_load > 0.0f) {
+            bool contended = cli_sim.frame >= o->sim_from && cli_sim.frame < o->sim_to;
+            cli_sim.pending_us = frame_us * o->sim_load * cli_sim.rel[core->mp3d.quality] * (contended ? o->sim_factor : 1.0f);
+        }
+        double t0 = cli_now(), v0 = cli_sim.virtual_us;
+        int bytes = mp3dec_core_decode(core, pcm);
+        res->busy += cli_now() - t0;
+        if (bytes == MP3DEC_CORE_BUFFERING) { // A file never runs dry: only the prebuffer
+            if (o->paced) {
+                cli_sleep(0.001);
+                due = 0.0;
+            }
+            continue;
+        }
+        if (bytes == 0) break;
+
+        int channels = (core->force_mono && core->info.channels == 2) ? 1 : core->info.channels;
+        if (o->paced) due = (due > 0.0 ? due : cli_now()) + (double)bytes / (2.0 * channels * core->info.hz);
+        if (o->icy_metaint >= 0 && strcmp(title, core->live.title) != 0) {
+            strcpy(title, core->live.title);
+            fprintf(stderr, "title \"%s\" at %.2f s\n", title, res->audio_sec);
+        }
+        if (o->sim_load > 0.0f) {
+            frame_us = 1e6 * bytes / (2.0 * channels * core->info.hz);
+            cli_sim_frame(cli_sim.virtual_us - v0, frame_us, core->mp3d.quality);
+        }
+        res->audio_sec += (double)bytes / (2.0 * channels * core->info.hz);
+        if (res->data_bytes == 0) {
+            res->hz = core->info.hz;
+            res->channels = channels;
+            if (out && wav) cli_write_wav_header(out, res->hz, res->channels, 0);
+        }
+        if (lv) cli_levels_add(lv, pcm, bytes / (2 * channels), channels, core->info.hz, o->overview_sec);
+        if (out) cli_write_pcm(out, pcm, bytes, wav);
+        res->data_bytes += bytes;
+    }
+    if (lv) cli_levels_flush(lv);
+}
+
+// -k: time whole decodes of the file (without output, best of 3) at every
+// quality level; the virtual clock charges each frame by its level's speed
+static void cli_sim_calibrate(const cli_opts_t *o, FILE *in, mp3dec_core_t *core, uint8_t *buf, size_t buf_len,
+    mp3dec_checkpoint_t *cp) {
+    cli_opts_t plain = *o;
+    double busy[MP3D_QUALITY_LOWEST + 1];
+    plain.sim_load = 0.0f;
+    plain.gov_target = 0.0f;
+    for (int q = MP3D_QUALITY_FULL; q <= MP3D_QUALITY_LOWEST; q++) {
+        plain.quality = q;
+        busy[q] = 0.0;
+        for (int r = 0; r < 3; r++) {
+            cli_result_t res;
+            cli_decode(&plain, in, NULL, false, core, buf, buf_len, cp, NULL, &res);
+            if (r == 0 || res.busy < busy[q]) busy[q] = res.busy;
+        }
+    }
+    for (int q = MP3D_QUALITY_FULL; q <= MP3D_QUALITY_LOWEST; q++) {
+        cli_sim.rel[q] = busy[MP3D_QUALITY_FULL] > 0.0 ? busy[q] / busy[MP3D_QUALITY_FULL] : 1.0;
+    }
+}
+
+// -O: the overview of the decoded file, best of o->repeats runs, against the
+// levels of its PCM
+static void cli_overview(const cli_opts_t *o, mp3dec_core_t *core, const cli_levels_t *lv, double decode_sec) {
+    static uint8_t levels[CLI_OVERVIEW_MAX];
+    double best = 0.0;
+    int n = 0;
+    for (int r = 0; r < o->repeats; r++) {
+        double t0 = cli_now();
+        n = mp3dec_core_overview(core, levels, CLI_OVERVIEW_MAX, o->overview_sec, CLI_OVERVIEW_DB);
+        double t = cli_now() - t0;
+        if (r == 0 || t < best) best = t;
+    }
+    if (n < 0) {
+        fprintf(stderr, "overview: error %d\n", n);
+        return;
+    }
+
+    // Pearson correlation and mean distance over the levels both have (where
+    // both are silent, below the range, there is nothing to compare)
+    size_t both = (size_t)n < lv->n ? (size_t)n : lv->n, m = 0;
+    double sx = 0.0, sy = 0.0, sxx = 0.0, syy = 0.0, sxy = 0.0, dist = 0.0;
+    for (size_t i = 0; i < both; i++) {
+        if (levels[i] == 0 && lv->level[i] == 0) continue;
+        m++;
+        double x = levels[i], y = lv->level[i];
+        sx += x;
+        sy += y;
+        sxx += x * x;
+        syy += y * y;
+        sxy += x * y;
+        dist += fabs(x - y);
+    }
+    double vx = m * sxx - sx * sx, vy = m * syy - sy * sy;
+    double corr = (vx > 0.0 && vy > 0.0) ? (m * sxy - sx * sy) / sqrt(vx * vy) : 0.0;
+    fprintf(stderr, "overview %.2f ms, %.1fx faster than decode, %d levels (decoded %u), r %.3f, "
+                    "mean |diff| %.1f dB, bias %+.1f dB\n",
+        best * 1e3, best > 0.0 ? decode_sec / best : 0.0, n, (unsigned)lv->n, corr,
+        m ? dist / m * CLI_OVERVIEW_DB / 255.0 : 0.0, m ? (sx - sy) / m * CLI_OVERVIEW_DB / 255.0 : 0.0);
+    fprintf(stderr, "overview");
+    for (int i = 0; i < n; i++) fprintf(stderr, " %u", levels[i]);
+    fprintf(stderr, " (0..255 = -%d..0 dBFS)\n", CLI_OVERVIEW_DB);
+}
+
+// -x: o->voices decoders over the in-memory file (core is the first) through
+// the mixer, 1152 sample frames per mix() call
+static void cli_mix(const cli_opts_t *o, FILE *out, bool wav, mp3dec_core_t *core, const uint8_t *buf,
+    size_t buf_len, mp3dec_mixer_t *mixer, cli_result_t *res) {
+    static mp3dec_core_t more[MP3DEC_MIXER_MAX_VOICES - 1];
+    static int16_t voice_pcm[MP3DEC_MIXER_MAX_VOICES][MINIMP3_MAX_SAMPLES_PER_FRAME];
+    static int16_t mixed[1152 * 2];
+    const mp3dec_core_io_t io = { NULL, NULL, cli_ticks_us, NULL };
+
+    mp3dec_mixer_init(mixer, o->mono ? 1 : 2);
+    for (int v = 0; v < o->voices; v++) {
+        mp3dec_core_t *c = v ? &more[v - 1] : core;
+        mp3dec_core_init_mem(c, &io, buf, buf_len, NULL, 0);
+        cli_setup(o, c);
+        mp3dec_mixer_add(mixer, c, voice_pcm[v]);
+        mp3dec_mixer_set_gain(mixer, v, 1.0f / o->voices, 0.0f);
+    }
+
+    memset(res, 0, sizeof(*res));
+    while (1) {
+        double t0 = cli_now();
+        size_t frames = mp3dec_mixer_mix(mixer, mixed, 1152);
+        res->busy += cli_now() - t0;
+        if (frames == 0) break;
+
+        int bytes = (int)(frames * mixer->channels * 2);
+        if (res->data_bytes == 0) {
+            res->hz = mixer->hz;
+            res->channels = mixer->channels;
+            if (out && wav) cli_write_wav_header(out, res->hz, res->channels, 0);
+        }
+        if (out) cli_write_pcm(out, mixed, bytes, wav);
+        res->data_bytes += bytes;
+    }
+    if (res->hz) res->audio_sec = (double)mixer->frames / res->hz;
+}
+
+// -n: the input, then the -n files through the playlist (one o->buf_size
+// stream buffer each), 1152 sample frames per decode() call
+static void cli_playlist(const cli_opts_t *o, FILE *in, FILE *out, bool wav, mp3dec_core_t *core, uint8_t *buf,
+    mp3dec_playlist_t *pl, cli_result_t *res) {
+    static mp3dec_core_t more[MP3DEC_PLAYLIST_MAX - 1];
+    static int16_t track_pcm[MP3DEC_PLAYLIST_MAX][MINIMP3_MAX_SAMPLES_PER_FRAME];
+    static int16_t mixed[1152 * 2];
+    FILE *files[MP3DEC_PLAYLIST_MAX] = { in };
+    uint8_t *bufs[MP3DEC_PLAYLIST_MAX] = { buf };
+
+    mp3dec_playlist_init(pl, o->mono ? 1 : 2);
+    mp3dec_playlist_set_crossfade(pl, o->crossfade);
+    for (int t = 0; t <= o->next_count; t++) {
+        mp3dec_core_t *c = t ? &more[t - 1] : core;
+        if (t) {
+            files[t] = fopen(o->next[t - 1], "rb");
+            bufs[t] = malloc(o->buf_size);
+            if (!files[t] || !bufs[t]) {
+                perror(o->next[t - 1]);
+                exit(1);
+            }
+        }
+        rewind(files[t]);
+        const mp3dec_core_io_t io = { cli_read, cli_seek, cli_ticks_us, files[t] };
+        mp3dec_core_init(c, &io, bufs[t], o->buf_size, NULL, 0);
+        cli_setup(o, c);
+        mp3dec_playlist_append(pl, c, track_pcm[t]);
+    }
+
+    memset(res, 0, sizeof(*res));
+    while (1) {
+        double t0 = cli_now();
+        size_t frames = mp3dec_playlist_decode(pl, mixed, 1152);
+        res->busy += cli_now() - t0;
+        if (frames == 0) break;
+
+        int bytes = (int)(frames * pl->mixer.channels * 2);
+        if (res->data_bytes == 0) {
+            res->hz = pl->mixer.hz;
+            res->channels = pl->mixer.channels;
+            if (out && wav) cli_write_wav_header(out, res->hz, res->channels, 0);
+        }
+        if (out) cli_write_pcm(out, mixed, bytes, wav);
+        res->data_bytes += bytes;
+        res->audio_sec += (double)frames / pl->mixer.hz;
+    }
+    for (int t = 1; t <= o->next_count; t++) {
+        fclose(files[t]);
+        free(bufs[t]);
+    }
+}
+
+static void cli_usage(void) {
+    fprintf(stderr, "usage: mp3dec [-b buf_size] [-s sync_matches] [-q quality] [-g target] [-v volume] [-m] [-i] [-G]\n"
+                    "              [-I metaint] [-x voices] [-n next.mp3] [-c crossfade_sec] [-S bars]\n"
+                    "              [-E db,db,..|pN] [-T bass,treble] [-O sec] [-k load,factor,from,to]\n"
+                    "              [-t start_sec] [-r repeats]\n"
+                    "              input.mp3 [output.wav|output.raw|-]\n");
+    exit(2);
+}
+
+int main(int argc, char **argv) {
+    cli_opts_t o = { MP3DEC_DEFAULT_BUF_SIZE, 0, MP3D_QUALITY_FULL, 0.0f, 100, false, 0.0f, 1, false, -1, false, 0, false, { NULL }, 0, 0.0f, 0, { 0.0f }, 0, -1, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0, 0 };
+    int i;
+    for (i = 1; i < argc && argv[i][0] == '-' && argv[i][1]; i++) {
+        char opt = argv[i][1];
+        if (opt == 'm' || opt == 'i' || opt == 'G') {
+            if (opt == 'm') o.mono = true;
+            else if (opt == 'i') o.in_memory = true;
+            else o.gapless = true;
+            continue;
+        }
+        if (i + 1 >= argc) cli_usage();
+        const char *val = argv[++i];
+        switch (opt) {
+            case 'b': o.buf_size = (size_t)atol(val); break;
+            case 's': o.sync_matches = atoi(val); break;
+            case 'q': o.quality = atoi(val); break;
+            case 'g': o.gov_target = (float)atof(val); break;
+            case 'v': o.volume = atoi(val); break;
+            case 't': o.start_sec = (float)atof(val); break;
+            case 'r': o.repeats = atoi(val); break;
+            case 'I': o.icy_metaint = atol(val); break;
+            case 'x': o.voices = atoi(val); break;
+            case 'n':
+                if (o.next_count == MP3DEC_PLAYLIST_MAX - 1) cli_usage();
+                o.next[o.next_count++] = val;
+                break;
+            case 'c': o.crossfade = (float)atof(val); break;
+            case 'S': o.spectrum_bars = atoi(val); break;
+            case 'E':
+                if (val[0] == 'p') {
+                    o.eq_preset = atoi(val + 1);
+                    break;
+                }
+                for (o.eq_bands = 0; *val && o.eq_bands < MP3DEC_SPECTRUM_BANDS; val += (*val == ',')) {
+                    char *end;
+                    o.eq_db[o.eq_bands++] = strtof(val, &end);
+                    if (end == val) cli_usage();
+                    val = end;
+                }
+                break;
+            case 'T':
+                if (sscanf(val, "%f,%f", &o.bass_db, &o.treble_db) != 2) cli_usage();
+                break;
+            case 'O': o.overview_sec = (float)atof(val); break;
+            case 'k':
+                if (sscanf(val, "%f,%f,%u,%u", &o.sim_load, &o.sim_factor, &o.sim_from, &o.sim_to) != 4) cli_usage();
+                break;
+            default: cli_usage();
+        }
+    }
+    if (i >= argc || argc - i > 2) cli_usage();
+    if (o.buf_size < MP3DEC_MIN_BUF_SIZE) o.buf_size = MP3DEC_MIN_BUF_SIZE; // Same minimum as MP3Decoder
+    if (o.repeats < 1) o.repeats = 1;
+    if (o.voices < 0) o.voices = 0;
+    if (o.voices > MP3DEC_MIXER_MAX_VOICES) o.voices = MP3DEC_MIXER_MAX_VOICES;
+    if (o.next_count) { // Playlist tracks are streamed
+        o.in_memory = false;
+        o.voices = 0;
+    }
+    if (o.voices || o.next_count || o.start_sec > 0.0f) o.overview_sec = 0.0f; // Whole plain decodes only
+    if (o.voices || o.next_count) o.sim_load = 0.0f;
+    bool from_stdin = strcmp(argv[i], "-") == 0;
+    if (from_stdin) { // Read once, as it comes
+        o.in_memory = false;
+        o.voices = 0;
+        o.next_count = 0;
+        o.start_sec = 0.0f;
+        o.overview_sec = 0.0f;
+        o.sim_load = 0.0f;
+        o.repeats = 1;
+        o.paced = o.icy_metaint >= 0;
+    }
+    bool load = o.in_memory || o.voices > 0; // The mixer's voices share one in-memory copy
+
+    FILE *in = from_stdin ? stdin : fopen(argv[i], "rb");
+    if (!in) {
+        perror(argv[i]);
+        return 1;
+    }
+    const char *out_name = (i + 1 < argc) ? argv[i + 1] : NULL;
+    FILE *out = NULL;
+    bool wav = false;
+    if (out_name) {
+        size_t n = strlen(out_name);
+        wav = n > 4 && strcmp(out_name + n - 4, ".wav") == 0;
+        out = strcmp(out_name, "-") == 0 ? stdout : fopen(out_name, "wb");
+        if (!out) {
+            perror(out_name);
+            return 1;
+        }
+    }
+
+    static mp3dec_core_t core;
+    size_t buf_len = o.buf_size;
+    if (load) { // The input buffer becomes the whole file
+        fseek(in, 0, SEEK_END);
+        buf_len = (size_t)ftell(in);
+        rewind(in);
+    }
+    if (o.paced) fcntl(fileno(in), F_SETFL, fcntl(fileno(in), F_GETFL) | O_NONBLOCK);
+    uint8_t *buf = malloc(buf_len ? buf_len : 1);
+    mp3dec_checkpoint_t *cp = malloc(MP3DEC_DEFAULT_CP_MAX * sizeof(mp3dec_checkpoint_t));
+    if (!buf || !cp) {
+        fprintf(stderr, "mp3dec: out of memory\n");
+        return 1;
+    }
+    if (load && fread(buf, 1, buf_len, in) != buf_len) {
+        perror(argv[i]);
+        return 1;
+    }
+
+    // Only the first run writes output; the fastest one is reported
+    static mp3dec_mixer_t mixer;
+    static mp3dec_playlist_t playlist;
+    static cli_levels_t lv;
+    cli_result_t res = { 0 };
+    double best = 0.0;
+    if (o.sim_load > 0.0f) cli_sim_calibrate(&o, in, &core, buf, buf_len, cp);
+    for (int r = 0; r < o.repeats; r++) {
+        if (o.voices) {
+            cli_mix(&o, r == 0 ? out : NULL, wav, &core, buf, buf_len, &mixer, &res);
+        } else if (o.next_count) {
+            cli_playlist(&o, in, r == 0 ? out : NULL, wav, &core, buf, &playlist, &res);
+        } else {
+            cli_decode(&o, in, r == 0 ? out : NULL, wav, &core, buf, buf_len, cp,
+                (r == 0 && o.overview_sec > 0.0f) ? &lv : NULL, &res);
+        }
+        if (r == 0 || res.busy < best) best = res.busy;
+        if (r == 0 && out && wav && res.data_bytes > 0 && fseek(out, 0, SEEK_SET) == 0) {
+            cli_write_wav_header(out, res.hz, res.channels, res.data_bytes);
+        }
+    }
+    if (out && out != stdout) fclose(out);
+
+    const mp3dec_stats_t *st = &core.stats;
+    fprintf(stderr, "%s: %u frames, %.2f s audio, %d Hz, %d ch, %d kbps\n",
+        argv[i], (unsigned)st->frames, res.audio_sec, core.info.hz, core.info.channels, core.info.bitrate_kbps);
+    fprintf(stderr, "decode %.2f ms, %.0f frames/s, %.1fx realtime (best of %d)\n",
+        best * 1e3, best > 0.0 ? st->frames / best : 0.0, best > 0.0 ? res.audio_sec / best : 0.0, o.repeats);
+    fprintf(stderr, "reservoir_miss %u, sync_losses %u, bytes_skipped %u, format_changes %u, "
+                    "bytes_read %u, refills %u, bytes_moved %u, quality %d, load %.3f\n",
+        (unsigned)st->reservoir_miss, (unsigned)st->sync_losses, (unsigned)st->bytes_skipped,
+        (unsigned)st->format_changes, (unsigned)st->bytes_read, (unsigned)st->refills,
+        (unsigned)st->bytes_moved, core.mp3d.quality, core.load);
+    if (o.voices) {
+        double mixed_fps = best > 0.0 ? mixer.frames / 1152.0 / best : 0.0;
+        fprintf(stderr, "mix %d voices: %.0f mixed frames/s (%.1fx realtime), clipped %u, rate_drops %u\n",
+            o.voices, mixed_fps, best > 0.0 ? res.audio_sec / best : 0.0, (unsigned)mixer.clipped,
+            (unsigned)mixer.rate_drops);
+    }
+    if (o.next_count) {
+        fprintf(stderr, "playlist: %u tracks, %u crossfades, %u sample frames, rate_drops %u\n",
+            (unsigned)playlist.tracks, (unsigned)playlist.crossfades, (unsigned)playlist.mixer.frames,
+            (unsigned)playlist.mixer.rate_drops);
+    }
+    uint8_t levels[MP3DEC_SPECTRUM_BANDS + MP3DEC_SPECTRUM_LEVELS];
+    size_t n_levels = mp3dec_core_read_spectrum(&core, levels, sizeof(levels));
+    if (n_levels) {
+        size_t bars = n_levels - MP3DEC_SPECTRUM_LEVELS;
+        fprintf(stderr, "spectrum");
+        for (size_t b = 0; b < bars; b++) fprintf(stderr, " %u", levels[b]);
+        fprintf(stderr, ", peak/rms L %u/%u R %u/%u (0..255 = -60..0 dBFS)\n",
+            levels[bars], levels[bars + 1], levels[bars + 2], levels[bars + 3]);
+    }
+    if (o.icy_metaint >= 0) {
+        fprintf(stderr, "underruns %u, meta_bytes %u, title \"%s\"\n",
+            (unsigned)st->underruns, (unsigned)st->meta_bytes, core.live.title);
+    }
+    if (o.overview_sec > 0.0f) cli_overview(&o, &core, &lv, best);
+    if (o.sim_load > 0.0f) {
+        fprintf(stderr, "contention: load %.2f, x%.1f for frames %u..%u: late frames %u, quality peak %d, "
+                        "final %d, steps down %u, up %u\n",
+            o.sim_load, o.sim_factor, o.sim_from, o.sim_to, (unsigned)cli_sim.late, cli_sim.peak, cli_sim.quality,
+            (unsigned)cli_sim.down, (unsigned)cli_sim.up);
+    }
+    fclose(in);
+#ifdef MP3DEC_BENCH
+    fprintf(stderr, "stack_peak %u, state %u (mp3dec_t %u), buffer %u, checkpoints %u bytes\n",
+        (unsigned)st->stack_peak, (unsigned)sizeof(mp3dec_core_t), (unsigned)sizeof(mp3dec_t),
+        o.in_memory ? 0u : (unsigned)o.buf_size, (unsigned)(MP3DEC_DEFAULT_CP_MAX * sizeof(mp3dec_checkpoint_t)));
+#endif // MP3DEC_BENCH
+#ifdef MINIMP3_PROFILE
+    static const char *stages[MP3D_PROF_STAGES] = {
+        "refill", "sync", "side_info", "scalefactors", "huffman", "stereo", "imdct", "synth", "post",
+    };
+    uint64_t total = 0;
+    for (int s = 0; s < MP3D_PROF_STAGES; s++) total += mp3d_profile_ticks[s];
+    for (int s = 0; s < MP3D_PROF_STAGES; s++) {
+        fprintf(stderr, "%-13s %12llu ticks %5.1f%%\n", stages[s], (unsigned long long)mp3d_profile_ticks[s],
+            total ? mp3d_profile_ticks[s] * 100.0 / total : 0.0);
+    }
+    fprintf(stderr, "clock_hz %u (summed over %d runs)\n", (unsigned)mp3dec_core_profile_hz(), o.repeats);
+#endif // MINIMP3_PROFILE
+    free(cp);
+    free(buf);
+    return 0;
+}
@@ -0,0 +1,217 @@
+#!/usr/bin/env python3
+"""Decoder conformance: build configurations against reference PCM.
+
+Every case below is a native build of the core (see CMakeLists.txt) plus CLI
+arguments. Each file of the corpus is decoded to 16-bit PCM and checked one of
+three ways (the streams in conformance/streams are decoded along with the
+corpus):
+
+    golden     the PCM hash must match conformance/reference.json
+    exact      the PCM must be bit-identical to the default build
+    tolerance  the PCM must have the default build's length and stay within
+               the case's max sample error and PSNR of it. Only the length is
+               checked for synth_* files: their random payloads reach values
+               where float rounding no longer stays small after synthesis.
+               A case that compared no file this way fails.
+
+The lowpass qualities must also decode conformance/streams/lowpass_edges
+to the same PCM as its twin with the lines above their last subband zeroed.
+
+Golden references are keyed by the SHA-1 of the MP3 file, so files the
+reference does not know (e.g. from another LAME version) are reported and
+skipped. The conformance/streams files are built by tools/gen_ref_streams.py
+and do not depend on LAME, so their references always apply. A speedup that changes the output on purpose either moves its case
+to a tolerance check or refreshes the references with --update.
+
+Usage: conformance/check.py [--update] [--cases a,b] [--build-dir DIR] [corpus_dir]
+
+The corpus defaults to bench/out/corpus and is generated with
+bench/gen_corpus.py when missing (--synthetic-only without lame).
+"""
+
+import argparse
+import array
+import hashlib
+import json
+import math
+import os
+import shutil
+import subprocess
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+REPO = os.path.dirname(HERE)
+REFERENCE = os.path.join(HERE, 'reference.json')
+STREAMS = os.path.join(HERE, 'streams')
+DEFAULT_CORPUS = os.path.join(REPO, 'bench', 'out', 'corpus')
+DEFAULT_BUILD = os.path.join(REPO, 'build', 'conformance')
+
+# name, cmake -D options, C defines, CLI arguments, check, (max error, min PSNR dB)
+CASES = [
+    ('default', [], [], [], 'golden', None),
+    ('small_buffer', [], [], ['-b', '2000'], 'golden', None),
+    ('mono_volume', [], [], ['-m', '-v', '50'], 'golden', None),
+    ('in_memory', [], [], ['-i'], 'golden', None),
+    ('quality_1', [], [], ['-q', '1'], 'golden', None),
+    ('quality_2', [], [], ['-q', '2'], 'golden', None),
+    ('quality_3', [], [], ['-q', '3'], 'golden', None),
+    ('only_simd', [], ['MINIMP3_ONLY_SIMD'], [], 'exact', None),
+    ('specialize', ['MP3DEC_SPECIALIZE=ON'], [], [], 'exact', None),
+    ('narrow_huffman', ['MP3DEC_WIDE_HUFFMAN=OFF'], [], [], 'exact', None),
+    ('nonstandard', [], ['MINIMP3_NONSTANDARD_BUT_LOGICAL'], [], 'golden', None),
+    ('vector_ext', ['MP3DEC_VECTOR_EXT=ON'], [], [], 'tolerance', (2, 100.0)),
+    ('float_output', [], ['MINIMP3_FLOAT_OUTPUT'], [], 'tolerance', (2, 100.0)),
+    ('no_simd', [], ['MINIMP3_NO_SIMD'], [], 'tolerance', (4, 90.0)),
+    ('pow43_table', ['MP3DEC_POW43_TABLE_SIZE=8207'], [], [], 'tolerance', (4, 90.0)),
+]
+
+# random-payload stress files, see the tolerance note above
+STRESS_PREFIX = 'synth_'
+
+# file, twin without the lines the cases' lowpass drops, cases (see tools/gen_ref_streams.py)
+TWINS = [
+    ('lowpass_edges.mp3', 'lowpass_edges_cut20.mp3', ('quality_1', 'quality_2')),
+    ('lowpass_edges.mp3', 'lowpass_edges_cut10.mp3', ('quality_3',)),
+]
+
+
+def sha1_file(path):
+    with open(path, 'rb') as f:
+        return hashlib.sha1(f.read()).hexdigest()
+
+
+def build(build_dir, name, options, defines):
+    out = os.path.join(build_dir, name)
+    cmd = ['cmake', '-S', REPO, '-B', out, '-DCMAKE_BUILD_TYPE=Release']
+    cmd += ['-D' + o for o in options]
+    # no FMA contraction, so the hashes hold for any compiler and target
+    cmd.append('-DCMAKE_C_FLAGS=' + ' '.join(['-ffp-contract=off'] + ['-D' + d for d in defines]))
+    subprocess.run(cmd, check=True, stdout=subprocess.DEVNULL)
+    subprocess.run(['cmake', '--build', out, '-j', str(os.cpu_count() or 1)], check=True, stdout=subprocess.DEVNULL)
+    return os.path.join(out, 'mp3dec')
+
+
+def decode(cli, args, path):
+    res = subprocess.run([cli] + args + [path, '-'], check=True, stdout=subprocess.PIPE, stderr=subprocess.DEVNULL)
+    return res.stdout
+
+
+def compare(ref, pcm):
+    """(max abs sample error, PSNR in dB) of pcm against ref, both raw int16."""
+    a, b = array.array('h', ref), array.array('h', pcm)
+    peak, sq = 0, 0
+    for x, y in zip(a, b):
+        d = abs(x - y)
+        if d:
+            peak = max(peak, d)
+            sq += d*d
+    if not sq:
+        return 0, math.inf
+    return peak, 10*math.log10(32767.0**2*len(a)/sq)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('--update', action='store_true', help='rewrite the golden references from this build')
+    ap.add_argument('--cases', help='comma-separated case names (default: all)')
+    ap.add_argument('--build-dir', default=DEFAULT_BUILD)
+    ap.add_argument('corpus', nargs='?', default=DEFAULT_CORPUS)
+    args = ap.parse_args()
+
+    if not os.path.isdir(args.corpus):
+        gen = [sys.executable, os.path.join(REPO, 'bench', 'gen_corpus.py')]
+        if not shutil.which('lame'):
+            gen.append('--synthetic-only')
+        subprocess.run(gen + [args.corpus], check=True)
+    paths = {}
+    for d in (STREAMS, args.corpus):
+        paths.update((f, os.path.join(d, f)) for f in os.listdir(d) if f.endswith('.mp3'))
+    files = sorted(paths)
+
+    cases = CASES
+    if args.cases:
+        wanted = args.cases.split(',')
+        unknown = set(wanted) - {c[0] for c in CASES}
+        if unknown:
+            sys.exit('conformance: unknown case(s) %s' % ', '.join(sorted(unknown)))
+        # exact and tolerance checks need the default build to compare with
+        cases = [c for c in CASES if c[0] in wanted or (c[0] == 'default' and any(
+            k != 'golden' for n, _, _, _, k, _ in CASES if n in wanted))]
+
+    reference = {'files': {}}
+    if os.path.exists(REFERENCE):
+        with open(REFERENCE) as f:
+            reference = json.load(f)
+
+    mp3_sha = {name: sha1_file(paths[name]) for name in files}
+    default_pcm = {}
+    failures, missing = [], 0
+
+    for name, options, defines, cli_args, kind, limits in cases:
+        print('== %s (%s)' % (name, kind))
+        cli = build(args.build_dir, name, options, defines)
+        compared, twin_pcm = 0, {}
+        for f in files:
+            pcm = decode(cli, cli_args, paths[f])
+            digest = hashlib.sha1(pcm).hexdigest()
+            if any(name in cases and f in (a, b) for a, b, cases in TWINS):
+                twin_pcm[f] = pcm
+            if name == 'default':
+                default_pcm[f] = pcm
+            if kind == 'golden':
+                entry = reference['files'].setdefault(mp3_sha[f], {'name': f[:-4], 'pcm': {}})
+                if args.update:
+                    entry['pcm'][name] = digest
+                    status = 'updated'
+                elif name not in entry['pcm']:
+                    status = 'no reference'
+                    missing += 1
+                elif entry['pcm'][name] == digest:
+                    status = 'ok'
+                else:
+                    status = 'FAIL hash %s, reference %s' % (digest[:12], entry['pcm'][name][:12])
+            elif kind == 'exact':
+                status = 'ok' if pcm == default_pcm[f] else 'FAIL differs from default'
+            else:
+                ref = default_pcm[f]
+                if len(pcm) != len(ref):
+                    status = 'FAIL %d samples, default %d' % (len(pcm)//2, len(ref)//2)
+                elif f.startswith(STRESS_PREFIX):
+                    status = 'ok (length only)'
+                else:
+                    peak, psnr = compare(ref, pcm)
+                    compared += 1
+                    status = 'max error %d, PSNR %.1f dB' % (peak, psnr)
+                    if peak > limits[0] or psnr < limits[1]:
+                        status = 'FAIL ' + status
+            print('  %-24s %s' % (f, status))
+            if status.startswith('FAIL'):
+                failures.append('%s/%s: %s' % (name, f, status[5:]))
+        for a, b, cases in TWINS:
+            if name in cases and a in twin_pcm and b in twin_pcm:
+                status = 'ok' if twin_pcm[a] == twin_pcm[b] else 'FAIL differs from %s' % b
+                print('  %-24s %s' % ('= ' + b, status))
+                if status.startswith('FAIL'):
+                    failures.append('%s/%s: %s' % (name, a, status[5:]))
+        if kind == 'tolerance' and not compared:
+            failures.append('%s: no file checked beyond its length' % name)
+
+    if args.update:
+        # drop files that are no longer referenced by any case
+        reference['files'] = {k: v for k, v in reference['files'].items() if v['pcm']}
+        with open(REFERENCE, 'w') as f:
+            json.dump(reference, f, indent=1, sort_keys=True)
+            f.write('\n')
+        print('updated %s' % os.path.relpath(REFERENCE, REPO))
+    elif missing:
+        print('%d file/case pairs without a golden reference (run with --update to add them)' % missing)
+
+    if failures:
+        print('%d failure(s):' % len(failures))
+        for msg in failures:
+            print('  ' + msg)
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+"""Governor under simulated CPU contention.
+
+Decodes conformance/streams/stereo_44k_128 looped LOOPS times with the CLI's
+-k clock: a full-quality frame costs LOAD of its duration, FACTOR times that
+for frames FROM..TO-1. The frame cost of each quality level comes from timed
+decodes of the file, so the run is deterministic once they are measured.
+
+    -q 0    the contended frames miss their deadline (a 2-frame buffer)
+    -g T    the governor lowers the quality while contended, misses at most
+            half as many frames and steps back up to full quality after
+
+Usage: conformance/governor.py [--build-dir DIR]
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+from check import DEFAULT_BUILD, STREAMS, build
+
+STREAM = os.path.join(STREAMS, 'stereo_44k_128.mp3')
+LOOPS = 8
+LOAD, FACTOR, FROM, TO = 0.24, 5.0, 100, 300
+TARGET = 0.9
+
+CONTENTION = re.compile(r'contention: .*: late frames (\d+), quality peak (\d+), final (\d+), '
+                        r'steps down (\d+), up (\d+)')
+
+
+def run(cli, args, path):
+    sim = '%g,%g,%d,%d' % (LOAD, FACTOR, FROM, TO)
+    res = subprocess.run([cli] + args + ['-k', sim, path, os.devnull], check=True, stdout=subprocess.DEVNULL,
+                         stderr=subprocess.PIPE, universal_newlines=True)
+    m = CONTENTION.search(res.stderr)
+    if not m:
+        sys.exit('governor: no contention report in\n' + res.stderr)
+    late, peak, final, down, up = map(int, m.groups())
+    print('  %-8s late frames %d, quality peak %d, final %d, steps down %d, up %d' % (
+        ' '.join(args), late, peak, final, down, up))
+    return late, peak, final, up
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('--build-dir', default=DEFAULT_BUILD)
+    args = ap.parse_args()
+
+    cli = build(args.build_dir, 'default', [], [])
+    with open(STREAM, 'rb') as f:
+        data = f.read()
+    failures = []
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, 'looped.mp3')
+        with open(path, 'wb') as f:
+            f.write(data*LOOPS)
+        print('== contention x%g for frames %d..%d' % (FACTOR, FROM, TO))
+        late_off, _, _, _ = run(cli, ['-q', '0'], path)
+        late_on, peak, final, up = run(cli, ['-g', str(TARGET)], path)
+
+    if not late_off:
+        failures.append('-q 0 missed no frame: the contention is too light to test the governor')
+    if late_on*2 > late_off:
+        failures.append('-g missed %d frames, -q 0 %d' % (late_on, late_off))
+    if not peak:
+        failures.append('-g never lowered the quality')
+    if final or not up:
+        failures.append('-g ended at quality %d after %d step(s) up' % (final, up))
+    if failures:
+        print('%d failure(s):' % len(failures))
+        for msg in failures:
+            print('  ' + msg)
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""Live stream decode from tools/icy_server.py.
+
+Serves conformance/streams/stereo_44k_128 looped LOOPS times as an ICY stream
+(--once, metadata every METAINT bytes, a new title every second) and decodes
+it with the CLI reading the connected socket (-I METAINT -): non-blocking
+reads at playback speed, as MP3Decoder.set_live() does on a board. Checked
+twice:
+
+    stalls     the server stops for STALL s every STALL_EVERY s: the decoder
+               must report underruns, yet produce the plain decode's PCM
+    steady     no stalls: no underruns either
+
+Both runs must see at least two StreamTitles, in order.
+
+Usage: conformance/live.py [--build-dir DIR]
+"""
+
+import argparse
+import hashlib
+import os
+import re
+import socket
+import subprocess
+import sys
+import tempfile
+
+from check import DEFAULT_BUILD, REPO, STREAMS, build
+
+STREAM = os.path.join(STREAMS, 'stereo_44k_128.mp3')
+SERVER = os.path.join(REPO, 'tools', 'icy_server.py')
+LOOPS = 3
+METAINT = 997             # Odd, so metadata blocks land anywhere in the frames
+BUF_SIZE = 16384          # Prebuffers ~0.8 s at 128 kbps, less than a stall
+STALL, STALL_EVERY = 1.0, 1.5
+
+TITLE = re.compile(r'^title "Song (\d+)"', re.M)
+UNDERRUNS = re.compile(r'^underruns (\d+),', re.M)
+
+
+def listen(cli, path, stalls):
+    """(PCM, CLI stderr) of one client of a fresh server."""
+    cmd = [sys.executable, SERVER, '--port', '0', '--metaint', str(METAINT), '--title-every', '1', '--once']
+    if stalls:
+        cmd += ['--stall', str(STALL), '--stall-every', str(STALL_EVERY)]
+    server = subprocess.Popen(cmd + [path], stdout=subprocess.PIPE, universal_newlines=True)
+    try:
+        port = int(re.search(r' on port (\d+)', server.stdout.readline()).group(1))
+        with socket.create_connection(('127.0.0.1', port)) as s:
+            s.sendall(b'GET / HTTP/1.0\r\nIcy-MetaData: 1\r\n\r\n')
+            head = b''
+            while not head.endswith(b'\r\n\r\n'):
+                c = s.recv(1)
+                if not c:
+                    sys.exit('live: no ICY reply')
+                head += c
+            if b'icy-metaint: %d' % METAINT not in head:
+                sys.exit('live: unexpected reply %r' % head)
+            res = subprocess.run([cli, '-b', str(BUF_SIZE), '-I', str(METAINT), '-', '-'], stdin=s.fileno(),
+                                 stdout=subprocess.PIPE, stderr=subprocess.PIPE, check=True)
+    finally:
+        server.kill()
+        server.wait()
+    return res.stdout, res.stderr.decode()
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('--build-dir', default=DEFAULT_BUILD)
+    args = ap.parse_args()
+
+    cli = build(args.build_dir, 'default', [], [])
+    with open(STREAM, 'rb') as f:
+        data = f.read()
+    failures = []
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, 'looped.mp3')
+        with open(path, 'wb') as f:
+            f.write(data*LOOPS)
+        plain = subprocess.run([cli, path, '-'], stdout=subprocess.PIPE, stderr=subprocess.DEVNULL, check=True).stdout
+        for name, stalls in (('stalls', True), ('steady', False)):
+            pcm, log = listen(cli, path, stalls)
+            titles = [int(n) for n in TITLE.findall(log)]
+            m = UNDERRUNS.search(log)
+            underruns = int(m.group(1)) if m else -1
+            print('== %s: %d samples, underruns %d, titles %s' % (
+                name, len(pcm)//2, underruns, ', '.join('Song %d' % n for n in titles)))
+            if pcm != plain:
+                failures.append('%s: PCM %s, plain decode %s' % (
+                    name, hashlib.sha1(pcm).hexdigest()[:12], hashlib.sha1(plain).hexdigest()[:12]))
+            if len(titles) < 2 or titles != sorted(set(titles)):
+                failures.append('%s: titles %s' % (name, titles))
+            if (underruns > 0) != stalls:
+                failures.append('%s: %d underruns' % (name, underruns))
+    if failures:
+        print('%d failure(s):' % len(failures))
+        for msg in failures:
+            print('  ' + msg)
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
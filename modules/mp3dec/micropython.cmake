@@ -2,10 +2,46 @@ add_library(usermod_mp3dec INTERFACE)
 
 target_sources(usermod_mp3dec INTERFACE
     ${CMAKE_CURRENT_LIST_DIR}/mp3dec.c
+    ${CMAKE_CURRENT_LIST_DIR}/mp3dec_core.c
+    ${CMAKE_CURRENT_LIST_DIR}/mp3dec_mixer.c
+    ${CMAKE_CURRENT_LIST_DIR}/mp3dec_playlist.c
 )
 
 target_include_directories(usermod_mp3dec INTERFACE
     ${CMAKE_CURRENT_LIST_DIR}
 )
 
+# Wide-first-level Huffman tables (minimp3_huff_wide.h): faster, ~4.8 KB more flash
+option(MP3DEC_WIDE_HUFFMAN "Use the wide Huffman tables" ON)
+if(MP3DEC_WIDE_HUFFMAN)
+    target_compile_definitions(usermod_mp3dec INTERFACE MINIMP3_WIDE_HUFFMAN)
+endif()
+
+# pow(x, 4/3) table for escaped Huffman values (minimp3_pow43.h), 4 bytes per entry.
+# Off by default: the values are exact, so output differs slightly from the
+# polynomial approximation. 8207 covers every value.
+set(MP3DEC_POW43_TABLE_SIZE 0 CACHE STRING "pow(x, 4/3) table entries, 0 = off")
+if(MP3DEC_POW43_TABLE_SIZE)
+    target_compile_definitions(usermod_mp3dec INTERFACE MINIMP3_POW43_TABLE_SIZE=${MP3DEC_POW43_TABLE_SIZE})
+endif()
+
+# Portable GCC/Clang vector-extension kernels (MINIMP3_VECTOR_EXT) instead of scalar/SSE/NEON
+option(MP3DEC_VECTOR_EXT "Use the vector-extension SIMD backend" OFF)
+if(MP3DEC_VECTOR_EXT)
+    target_compile_definitions(usermod_mp3dec INTERFACE MINIMP3_VECTOR_EXT)
+endif()
+
+# Specialized Layer III granule paths per stereo/mono and MPEG-1/LSF (MINIMP3_SPECIALIZE):
+# up to ~10% faster on stereo MPEG-1, roughly doubles the decoder's code size
+option(MP3DEC_SPECIALIZE "Build specialized Layer III granule paths" OFF)
+if(MP3DEC_SPECIALIZE)
+    target_compile_definitions(usermod_mp3dec INTERFACE MINIMP3_SPECIALIZE)
+endif()
+
+# Per-stage decode timers (MINIMP3_PROFILE) and decoder.get_profile(); off in normal builds
+option(MP3DEC_PROFILE "Build the per-stage profiler" OFF)
+if(MP3DEC_PROFILE)
+    target_compile_definitions(usermod_mp3dec INTERFACE MINIMP3_PROFILE)
+endif()
+
 target_link_libraries(usermod INTERFACE usermod_mp3dec)
\ No newline at end of file
@@ -2,6 +2,42 @@ MP3DEC_MOD_DIR := $(USERMOD_DIR)
 
 # Add all C files to SRC_USERMOD.
 SRC_USERMOD += $(MP3DEC_MOD_DIR)/mp3dec.c
+SRC_USERMOD += $(MP3DEC_MOD_DIR)/mp3dec_core.c
+SRC_USERMOD += $(MP3DEC_MOD_DIR)/mp3dec_mixer.c
+SRC_USERMOD += $(MP3DEC_MOD_DIR)/mp3dec_playlist.c
 
 # Add our module directory to include paths
-CFLAGS_USERMOD += -I$(MP3DEC_MOD_DIR)
\ No newline at end of file
+CFLAGS_USERMOD += -I$(MP3DEC_MOD_DIR)
+
+# Wide-first-level Huffman tables (minimp3_huff_wide.h): faster, ~4.8 KB more flash
+MP3DEC_WIDE_HUFFMAN ?= 1
+ifeq ($(MP3DEC_WIDE_HUFFMAN),1)
+CFLAGS_USERMOD += -DMINIMP3_WIDE_HUFFMAN
+endif
+
+# pow(x, 4/3) table for escaped Huffman values (minimp3_pow43.h), 4 bytes per entry.
+# Off by default: the values are exact, so output differs slightly from the
+# polynomial approximation. 8207 covers every value.
+MP3DEC_POW43_TABLE_SIZE ?= 0
+ifneq ($(MP3DEC_POW43_TABLE_SIZE),0)
+CFLAGS_USERMOD += -DMINIMP3_POW43_TABLE_SIZE=$(MP3DEC_POW43_TABLE_SIZE)
+endif
+
+# Portable GCC/Clang vector-extension kernels (MINIMP3_VECTOR_EXT) instead of scalar/SSE/NEON
+MP3DEC_VECTOR_EXT ?= 0
+ifeq ($(MP3DEC_VECTOR_EXT),1)
+CFLAGS_USERMOD += -DMINIMP3_VECTOR_EXT
+endif
+
+# Specialized Layer III granule paths per stereo/mono and MPEG-1/LSF (MINIMP3_SPECIALIZE):
+# up to ~10% faster on stereo MPEG-1, roughly doubles the decoder's code size
+MP3DEC_SPECIALIZE ?= 0
+ifeq ($(MP3DEC_SPECIALIZE),1)
+CFLAGS_USERMOD += -DMINIMP3_SPECIALIZE
+endif
+
+# Per-stage decode timers (MINIMP3_PROFILE) and decoder.get_profile(); off in normal builds
+MP3DEC_PROFILE ?= 0
+ifeq ($(MP3DEC_PROFILE),1)
+CFLAGS_USERMOD += -DMINIMP3_PROFILE
+endif
@@ -17,11 +17,24 @@ typedef struct
 
 typedef struct
 {
-    float mdct_overlap[2][9*32], qmf_state[15*2*32];
+    float mdct_overlap[2][9*32], qmf_state[17*2*32]; /* ring of 64-float blocks, 15 of them history */
+    int qmf_pos, qmf_right_pos; /* ring index of the oldest history block (left, right lanes) */
     int reserv, free_format_bytes;
     unsigned char header[4], reserv_buf[511];
+    int sync_matches; /* headers required to accept sync; mp3dec_init() sets MAX_FRAME_SYNC_MATCHES */
+    int quality; /* MP3D_QUALITY_*, kept across resync like sync_matches */
+    float *band_energy; /* NULL, or [2][32]: squared subband samples per channel are added here before
+                           synthesis (a spectrum at almost no cost); kept across resync */
+    float *band_gain; /* NULL, or [2][32]: subband gains applied before synthesis (an equalizer), the
+                         ones in use and their targets, see mp3d_band_gain(); kept across resync */
 } mp3dec_t;
 
+/* cheaper Layer III decoding for when the CPU cannot keep up; each level includes the one before */
+#define MP3D_QUALITY_FULL       0
+#define MP3D_QUALITY_LOWPASS    1 /* decode only subbands 0..19 (13.8 kHz at 44.1 kHz) */
+#define MP3D_QUALITY_MONO       2 /* synthesize stereo as mono, output stays interleaved */
+#define MP3D_QUALITY_LOWEST     3 /* decode only subbands 0..9 */
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -34,6 +47,25 @@ typedef float mp3d_sample_t;
 void mp3dec_f32_to_s16(const float *in, int16_t *out, int num_samples);
 #endif /* MINIMP3_FLOAT_OUTPUT */
 int mp3dec_decode_frame(mp3dec_t *dec, const uint8_t *mp3, int mp3_bytes, mp3d_sample_t *pcm, mp3dec_frame_info_t *info);
+/* mean power (1.0: full scale) of the Layer III frame at mp3 (its header, mp3_bytes long) estimated
+   from the side info alone: no bit reservoir, Huffman decoding or synthesis. 0 for other layers */
+float mp3dec_frame_power(const uint8_t *mp3, int mp3_bytes);
+#ifdef MINIMP3_HUFFMAN_STATS
+/* [0..31] big_values tables by table_select, [32..33] count1 tables A/B:
+   codewords decoded, codewords resolved by the first table probe */
+extern unsigned long mp3d_huffman_stats[34][2];
+#endif /* MINIMP3_HUFFMAN_STATS */
+#ifdef MINIMP3_PROFILE
+/* clock ticks spent per decoding stage, summed over every decoder in the process;
+   REFILL and POST are left to the caller, which does input and output */
+enum
+{
+    MP3D_PROF_REFILL, MP3D_PROF_SYNC, MP3D_PROF_SIDE_INFO, MP3D_PROF_SCALEFACTORS, MP3D_PROF_HUFFMAN,
+    MP3D_PROF_STEREO, MP3D_PROF_IMDCT, MP3D_PROF_SYNTH, MP3D_PROF_POST, MP3D_PROF_STAGES
+};
+extern uint64_t mp3d_profile_ticks[MP3D_PROF_STAGES];
+extern uint32_t mp3d_profile_last;
+#endif /* MINIMP3_PROFILE */
 
 #ifdef __cplusplus
 }
@@ -45,6 +77,52 @@ int mp3dec_decode_frame(mp3dec_t *dec, const uint8_t *mp3, int mp3_bytes, mp3d_s
 
 #include <stdlib.h>
 #include <string.h>
+#ifdef MINIMP3_WIDE_HUFFMAN
+/* one-probe-for-most-codewords tables, see tools/gen_huff_wide.py */
+#include "minimp3_huff_wide.h"
+#endif /* MINIMP3_WIDE_HUFFMAN */
+#ifdef MINIMP3_POW43_TABLE_SIZE
+/* pow(x, 4/3) beyond g_pow43[], see tools/gen_pow43.py */
+#include "minimp3_pow43.h"
+#endif /* MINIMP3_POW43_TABLE_SIZE */
+#ifdef MINIMP3_HUFFMAN_STATS
+unsigned long mp3d_huffman_stats[34][2];
+#endif /* MINIMP3_HUFFMAN_STATS */
+
+#ifdef MINIMP3_PROFILE
+/* MINIMP3_PROFILE_CLOCK() returns a free-running 32-bit tick count, MINIMP3_PROFILE_HZ its
+   rate (0: CPU cycles at whatever the clock is). Define both to plug in another timer. */
+#ifndef MINIMP3_PROFILE_CLOCK
+#if defined(__XTENSA__)
+static __inline__ uint32_t mp3d_profile_clock(void)
+{
+    uint32_t ccount;
+    __asm__ __volatile__("rsr %0, ccount" : "=a"(ccount));
+    return ccount;
+}
+#define MINIMP3_PROFILE_HZ 0
+#else /* __XTENSA__ */
+#include <time.h>
+static uint32_t mp3d_profile_clock(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)ts.tv_sec*1000000000u + (uint32_t)ts.tv_nsec;
+}
+#define MINIMP3_PROFILE_HZ 1000000000
+#endif /* __XTENSA__ */
+#define MINIMP3_PROFILE_CLOCK() mp3d_profile_clock()
+#endif /* MINIMP3_PROFILE_CLOCK */
+uint64_t mp3d_profile_ticks[MP3D_PROF_STAGES];
+uint32_t mp3d_profile_last;
+/* MP3D_PROF_MARK() charges everything since the previous mark to one stage */
+#define MP3D_PROF_START() mp3d_profile_last = MINIMP3_PROFILE_CLOCK()
+#define MP3D_PROF_MARK(stage) { uint32_t prof_now = MINIMP3_PROFILE_CLOCK(); \
+    mp3d_profile_ticks[stage] += (uint32_t)(prof_now - mp3d_profile_last); mp3d_profile_last = prof_now; }
+#else /* MINIMP3_PROFILE */
+#define MP3D_PROF_START()
+#define MP3D_PROF_MARK(stage)
+#endif /* MINIMP3_PROFILE */
 
 #define MAX_FREE_FORMAT_FRAME_SIZE  2304    /* more than ISO spec's */
 #ifndef MAX_FRAME_SYNC_MATCHES
@@ -54,6 +132,10 @@ int mp3dec_decode_frame(mp3dec_t *dec, const uint8_t *mp3, int mp3_bytes, mp3d_s
 #define MAX_L3_FRAME_PAYLOAD_BYTES  MAX_FREE_FORMAT_FRAME_SIZE /* MUST be >= 320000/8/32000*1152 = 1440 */
 
 #define MAX_BITRESERVOIR_BYTES      511
+/* furthest L3_huffman() reads past the main data: the widest band (192 lines) of the costliest
+   pairs (17-bit codeword, 2*13 linbits, 2 signs) started just before its end, a count1 quad and
+   the 4-byte read-ahead */
+#define MAX_L3_HUFFMAN_OVERREAD     ((96*45 + 10 + 7)/8 + 4)
 #define SHORT_BLOCK_TYPE            2
 #define STOP_BLOCK_TYPE             3
 #define MODE_MONO                   3
@@ -84,6 +166,13 @@ int mp3dec_decode_frame(mp3dec_t *dec, const uint8_t *mp3, int mp3_bytes, mp3d_s
 #define MINIMP3_MIN(a, b)           ((a) > (b) ? (b) : (a))
 #define MINIMP3_MAX(a, b)           ((a) < (b) ? (b) : (a))
 
+#if defined(MINIMP3_SPECIALIZE) && (defined(__GNUC__) || defined(__clang__))
+/* granule pipeline stages are inlined into each L3_GRANULE_VARIANT() with constant nch/mpeg1 */
+#define MP3D_SPECIALIZED static __inline__ __attribute__((always_inline))
+#else /* MINIMP3_SPECIALIZE */
+#define MP3D_SPECIALIZED static
+#endif /* MINIMP3_SPECIALIZE */
+
 #if !defined(MINIMP3_NO_SIMD)
 
 #if !defined(MINIMP3_ONLY_SIMD) && (defined(_M_X64) || defined(__x86_64__) || defined(__aarch64__) || defined(_M_ARM64))
@@ -91,12 +180,49 @@ int mp3dec_decode_frame(mp3dec_t *dec, const uint8_t *mp3, int mp3_bytes, mp3d_s
 #define MINIMP3_ONLY_SIMD
 #endif /* SIMD checks... */
 
-#if (defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))) || ((defined(__i386__) || defined(__x86_64__)) && defined(__SSE2__))
+#if defined(MINIMP3_VECTOR_EXT) && (defined(__GNUC__) || defined(__clang__))
+/* portable backend: GCC/Clang vector types, lowered to whatever vector unit (or scalar code) the target has */
+#define HAVE_SSE 0
+#define HAVE_VEXT 1
+#define HAVE_SIMD 1
+typedef float f4 __attribute__((vector_size(16)));
+typedef int32_t i4 __attribute__((vector_size(16)));
+static __inline__ f4 vext_ld(const float *p) { f4 v; memcpy(&v, p, sizeof(v)); return v; }
+static __inline__ void vext_st(float *p, f4 v) { memcpy(p, &v, sizeof(v)); }
+static __inline__ f4 vext_set(float x) { f4 v = { x, x, x, x }; return v; }
+static __inline__ void vext_st2(float *p, f4 v) { memcpy(p, &v, 2*sizeof(float)); }
+static __inline__ i4 vext_scale_pcm(f4 a)
+{   /* same rounding and clipping as the scalar mp3d_scale_pcm() */
+    i4 hi = a > vext_set(32767.0f), lo = a < vext_set(-32768.0f), s;
+    a = (f4)(((i4)a & ~(hi | lo)) | ((i4)vext_set(32767.0f) & hi) | ((i4)vext_set(-32768.0f) & lo));
+    s = __builtin_convertvector(a + vext_set(0.5f), i4);
+    return s + (s < 0);   /* away from zero: -1 where negative */
+}
+#define VSTORE vext_st
+#define VLD vext_ld
+#define VSET vext_set
+#define VADD(a, b) ((a) + (b))
+#define VSUB(a, b) ((a) - (b))
+#define VMUL(a, b) ((a) * (b))
+#define VMAC(a, x, y) ((a) + (x)*(y))
+#define VMSB(a, x, y) ((a) - (x)*(y))
+#define VMUL_S(x, s)  ((x)*vext_set(s))
+#if defined(__clang__)
+#define VREV(x) __builtin_shufflevector(x, x, 3, 2, 1, 0)
+#else /* defined(__clang__) */
+#define VREV(x) __builtin_shuffle(x, (i4){ 3, 2, 1, 0 })
+#endif /* defined(__clang__) */
+static int have_simd(void)
+{
+    return 1;
+}
+#elif (defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))) || ((defined(__i386__) || defined(__x86_64__)) && defined(__SSE2__))
 #if defined(_MSC_VER)
 #include <intrin.h>
 #endif /* defined(_MSC_VER) */
 #include <immintrin.h>
 #define HAVE_SSE 1
+#define HAVE_VEXT 0
 #define HAVE_SIMD 1
 #define VSTORE _mm_storeu_ps
 #define VLD _mm_loadu_ps
@@ -164,6 +290,7 @@ end:
 #elif defined(__ARM_NEON) || defined(__aarch64__) || defined(_M_ARM64)
 #include <arm_neon.h>
 #define HAVE_SSE 0
+#define HAVE_VEXT 0
 #define HAVE_SIMD 1
 #define VSTORE vst1q_f32
 #define VLD vld1q_f32
@@ -182,12 +309,14 @@ static int have_simd()
 }
 #else /* SIMD checks... */
 #define HAVE_SSE 0
+#define HAVE_VEXT 0
 #define HAVE_SIMD 0
 #ifdef MINIMP3_ONLY_SIMD
 #error MINIMP3_ONLY_SIMD used, but SSE/NEON not enabled
 #endif /* MINIMP3_ONLY_SIMD */
 #endif /* SIMD checks... */
 #else /* !defined(MINIMP3_NO_SIMD) */
+#define HAVE_VEXT 0
 #define HAVE_SIMD 0
 #endif /* !defined(MINIMP3_NO_SIMD) */
 
@@ -234,7 +363,7 @@ typedef struct
     bs_t bs;
     uint8_t maindata[MAX_BITRESERVOIR_BYTES + MAX_L3_FRAME_PAYLOAD_BYTES];
     L3_gr_info_t gr_info[4];
-    float grbuf[2][576], scf[40], syn[18 + 15][2*32];
+    float grbuf[2][576], scf[40], syn[9][2*32];
     uint8_t ist_pos[2][39];
 } mp3dec_scratch_t;
 
@@ -248,10 +377,16 @@ static void bs_init(bs_t *bs, const uint8_t *data, int bytes)
 static uint32_t get_bits(bs_t *bs, int n)
 {
     uint32_t next, cache = 0, s = bs->pos & 7;
-    int shl = n + s;
-    const uint8_t *p = bs->buf + (bs->pos >> 3);
+    int shl = n + s, byte = bs->pos >> 3;
+    const uint8_t *p = bs->buf + byte;
     if ((bs->pos += n) > bs->limit)
         return 0;
+    if (byte + 4 <= (bs->limit >> 3) && n > 0 && shl <= 32)
+    {
+        /* a whole big-endian word is in range: one load and shift instead of the byte loop */
+        cache = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+        return cache << s >> (32 - n);
+    }
     next = *p++ & (255 >> s);
     while ((shl -= 8) > 0)
     {
@@ -523,7 +658,7 @@ static int L3_read_side_info(bs_t *bs, L3_gr_info_t *gr, const uint8_t *hdr)
     {
         gr_count *= 2;
         main_data_begin = get_bits(bs, 9);
-        scfsi = get_bits(bs, 7 + gr_count);
+        scfsi = get_bits(bs, 7 + gr_count) & ((1u << 2*gr_count) - 1); /* drop private_bits, they would end up in granule 0 */
     } else
     {
         main_data_begin = get_bits(bs, 8 + gr_count) >> gr_count;
@@ -641,29 +776,33 @@ static void L3_read_scalefactors(uint8_t *scf, uint8_t *ist_pos, const uint8_t *
 
 static float L3_ldexp_q2(float y, int exp_q2)
 {
-    static const float g_expfrac[4] = { 9.31322575e-10f,7.83145814e-10f,6.58544508e-10f,5.53767716e-10f };
+    /* float bits of 2^(-k/4): the 2^(-e/4) step is built by lowering the exponent field,
+       which gives exactly the old g_expfrac[e & 3]*(1 << 30 >> (e >> 2)) without the int->float */
+    static const uint32_t g_expfrac_bits[4] = { 0x3f800000, 0x3f5744fd, 0x3f3504f3, 0x3f1837f0 };
     int e;
     do
     {
+        union { uint32_t u; float f; } step;
         e = MINIMP3_MIN(30*4, exp_q2);
-        y *= g_expfrac[e & 3]*(1 << 30 >> (e >> 2));
+        step.u = g_expfrac_bits[e & 3] - ((uint32_t)(e >> 2) << 23);
+        y *= step.f;
     } while ((exp_q2 -= e) > 0);
     return y;
 }
 
-static void L3_decode_scalefactors(const uint8_t *hdr, uint8_t *ist_pos, bs_t *bs, const L3_gr_info_t *gr, float *scf, int ch)
+/* scalefactor bands per partition: long, mixed and short blocks; MPEG-1 uses the first four */
+static const uint8_t g_scf_partitions[3][28] = {
+    { 6,5,5, 5,6,5,5,5,6,5, 7,3,11,10,0,0, 7, 7, 7,0, 6, 6,6,3, 8, 8,5,0 },
+    { 8,9,6,12,6,9,9,9,6,9,12,6,15,18,0,0, 6,15,12,0, 6,12,9,6, 6,18,9,0 },
+    { 9,9,6,12,9,9,9,9,9,9,12,6,18,18,0,0,12,12,12,0,12, 9,9,6,15,12,9,0 }
+};
+
+/* bits per scalefactor of the four partitions, from scalefac_compress; returns the band counts of
+   the partitions (a row of g_scf_partitions) */
+static const uint8_t *L3_scf_sizes(const uint8_t *hdr, const L3_gr_info_t *gr, int ch, int mpeg1, uint8_t *scf_size)
 {
-    static const uint8_t g_scf_partitions[3][28] = {
-        { 6,5,5, 5,6,5,5,5,6,5, 7,3,11,10,0,0, 7, 7, 7,0, 6, 6,6,3, 8, 8,5,0 },
-        { 8,9,6,12,6,9,9,9,6,9,12,6,15,18,0,0, 6,15,12,0, 6,12,9,6, 6,18,9,0 },
-        { 9,9,6,12,9,9,9,9,9,9,12,6,18,18,0,0,12,12,12,0,12, 9,9,6,15,12,9,0 }
-    };
     const uint8_t *scf_partition = g_scf_partitions[!!gr->n_short_sfb + !gr->n_long_sfb];
-    uint8_t scf_size[4], iscf[40];
-    int i, scf_shift = gr->scalefac_scale + 1, gain_exp, scfsi = gr->scfsi;
-    float gain;
-
-    if (HDR_TEST_MPEG1(hdr))
+    if (mpeg1)
     {
         static const uint8_t g_scfc_decode[16] = { 0,1,2,3, 12,5,6,7, 9,10,11,13, 14,15,18,19 };
         int part = g_scfc_decode[gr->scalefac_compress];
@@ -672,7 +811,7 @@ static void L3_decode_scalefactors(const uint8_t *hdr, uint8_t *ist_pos, bs_t *b
     } else
     {
         static const uint8_t g_mod[6*4] = { 5,5,4,4,5,5,4,1,4,3,1,1,5,6,6,1,4,4,4,1,4,3,1,1 };
-        int k, modprod, sfc, ist = HDR_TEST_I_STEREO(hdr) && ch;
+        int i, k, modprod, sfc, ist = HDR_TEST_I_STEREO(hdr) && ch;
         sfc = gr->scalefac_compress >> ist;
         for (k = ist*3*4; sfc >= 0; sfc -= modprod, k += 4)
         {
@@ -683,9 +822,26 @@ static void L3_decode_scalefactors(const uint8_t *hdr, uint8_t *ist_pos, bs_t *b
             }
         }
         scf_partition += k;
-        scfsi = -16;
     }
+    return scf_partition;
+}
+
+MP3D_SPECIALIZED void L3_decode_scalefactors(const uint8_t *hdr, uint8_t *ist_pos, bs_t *bs, const L3_gr_info_t *gr, float *scf, int ch, int mpeg1)
+{
+    uint8_t scf_size[4], iscf[40];
+    const uint8_t *scf_partition = L3_scf_sizes(hdr, gr, ch, mpeg1, scf_size);
+    int i, scf_shift = gr->scalefac_scale + 1, gain_exp, scfsi = mpeg1 ? gr->scfsi : -16;
+    float gain;
+
     L3_read_scalefactors(iscf, ist_pos, scf_size, scf_partition, bs, scfsi);
+    if (ch)
+    {
+        /* bands without scalefactors get no intensity position: with block types that differ
+           between the channels (not allowed, but seen in damaged streams) the left channel's
+           band table walks past the ones read here */
+        int n = scf_partition[0] + scf_partition[1] + scf_partition[2] + scf_partition[3];
+        memset(ist_pos + n, -1, 39 - n);
+    }
 
     if (gr->n_short_sfb)
     {
@@ -711,6 +867,10 @@ static void L3_decode_scalefactors(const uint8_t *hdr, uint8_t *ist_pos, bs_t *b
     {
         scf[i] = L3_ldexp_q2(gain, iscf[i] << scf_shift);
     }
+    for (; gr->sfbtab[i]; i++)
+    {
+        scf[i] = gain; /* the 8 kHz mixed-block table has three bands more than n_long_sfb + n_short_sfb */
+    }
 }
 
 static const float g_pow43[129 + 16] = {
@@ -727,6 +887,12 @@ static float L3_pow_43(int x)
     {
         return g_pow43[16 + x];
     }
+#ifdef MINIMP3_POW43_TABLE_SIZE
+    if (x < 129 + (int)(sizeof(g_pow43_ext)/sizeof(g_pow43_ext[0])))
+    {
+        return g_pow43_ext[x - 129];
+    }
+#endif /* MINIMP3_POW43_TABLE_SIZE */
 
     if (x < 1024)
     {
@@ -739,8 +905,9 @@ static float L3_pow_43(int x)
     return g_pow43[16 + ((x + sign) >> 6)]*(1.f + frac*((4.f/3) + frac*(2.f/9)))*mult;
 }
 
-static void L3_huffman(float *dst, bs_t *bs, const L3_gr_info_t *gr_info, const float *scf, int layer3gr_limit)
+static void L3_huffman(float *dst, bs_t *bs, const L3_gr_info_t *gr_info, const float *scf, int layer3gr_limit, int max_pairs)
 {
+#ifndef MINIMP3_WIDE_HUFFMAN
     static const int16_t tabs[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
         785,785,785,785,784,784,784,784,513,513,513,513,513,513,513,513,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
         -255,1313,1298,1282,785,785,785,785,784,784,784,784,769,769,769,769,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,290,288,
@@ -758,16 +925,24 @@ static void L3_huffman(float *dst, bs_t *bs, const L3_gr_info_t *gr_info, const
         -251,-892,-2058,-2620,-2828,-2957,-3023,-3039,1041,1041,1040,1040,769,769,769,769,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,-511,-527,-543,-559,1530,-575,-591,1528,1527,1407,1526,1391,1023,1023,1023,1023,1525,1375,1268,1268,1103,1103,1087,1087,1039,1039,1523,-604,815,815,815,815,510,495,509,479,508,463,507,447,431,505,415,399,-734,-782,1262,-815,1259,1244,-831,1258,1228,-847,-863,1196,-879,1253,987,987,748,-767,493,493,462,477,414,414,686,669,478,446,461,445,474,429,487,458,412,471,1266,1264,1009,1009,799,799,-1019,-1276,-1452,-1581,-1677,-1757,-1821,-1886,-1933,-1997,1257,1257,1483,1468,1512,1422,1497,1406,1467,1496,1421,1510,1134,1134,1225,1225,1466,1451,1374,1405,1252,1252,1358,1480,1164,1164,1251,1251,1238,1238,1389,1465,-1407,1054,1101,-1423,1207,-1439,830,830,1248,1038,1237,1117,1223,1148,1236,1208,411,426,395,410,379,269,1193,1222,1132,1235,1221,1116,976,976,1192,1162,1177,1220,1131,1191,963,963,-1647,961,780,-1663,558,558,994,993,437,408,393,407,829,978,813,797,947,-1743,721,721,377,392,844,950,828,890,706,706,812,859,796,960,948,843,934,874,571,571,-1919,690,555,689,421,346,539,539,944,779,918,873,932,842,903,888,570,570,931,917,674,674,-2575,1562,-2591,1609,-2607,1654,1322,1322,1441,1441,1696,1546,1683,1593,1669,1624,1426,1426,1321,1321,1639,1680,1425,1425,1305,1305,1545,1668,1608,1623,1667,1592,1638,1666,1320,1320,1652,1607,1409,1409,1304,1304,1288,1288,1664,1637,1395,1395,1335,1335,1622,1636,1394,1394,1319,1319,1606,1621,1392,1392,1137,1137,1137,1137,345,390,360,375,404,373,1047,-2751,-2767,-2783,1062,1121,1046,-2799,1077,-2815,1106,1061,789,789,1105,1104,263,355,310,340,325,354,352,262,339,324,1091,1076,1029,1090,1060,1075,833,833,788,788,1088,1028,818,818,803,803,561,561,531,531,816,771,546,546,289,274,288,258,
         -253,-317,-381,-446,-478,-509,1279,1279,-811,-1179,-1451,-1756,-1900,-2028,-2189,-2253,-2333,-2414,-2445,-2511,-2526,1313,1298,-2559,1041,1041,1040,1040,1025,1025,1024,1024,1022,1007,1021,991,1020,975,1019,959,687,687,1018,1017,671,671,655,655,1016,1015,639,639,758,758,623,623,757,607,756,591,755,575,754,559,543,543,1009,783,-575,-621,-685,-749,496,-590,750,749,734,748,974,989,1003,958,988,973,1002,942,987,957,972,1001,926,986,941,971,956,1000,910,985,925,999,894,970,-1071,-1087,-1102,1390,-1135,1436,1509,1451,1374,-1151,1405,1358,1480,1420,-1167,1507,1494,1389,1342,1465,1435,1450,1326,1505,1310,1493,1373,1479,1404,1492,1464,1419,428,443,472,397,736,526,464,464,486,457,442,471,484,482,1357,1449,1434,1478,1388,1491,1341,1490,1325,1489,1463,1403,1309,1477,1372,1448,1418,1433,1476,1356,1462,1387,-1439,1475,1340,1447,1402,1474,1324,1461,1371,1473,269,448,1432,1417,1308,1460,-1711,1459,-1727,1441,1099,1099,1446,1386,1431,1401,-1743,1289,1083,1083,1160,1160,1458,1445,1067,1067,1370,1457,1307,1430,1129,1129,1098,1098,268,432,267,416,266,400,-1887,1144,1187,1082,1173,1113,1186,1066,1050,1158,1128,1143,1172,1097,1171,1081,420,391,1157,1112,1170,1142,1127,1065,1169,1049,1156,1096,1141,1111,1155,1080,1126,1154,1064,1153,1140,1095,1048,-2159,1125,1110,1137,-2175,823,823,1139,1138,807,807,384,264,368,263,868,838,853,791,867,822,852,837,866,806,865,790,-2319,851,821,836,352,262,850,805,849,-2399,533,533,835,820,336,261,578,548,563,577,532,532,832,772,562,562,547,547,305,275,560,515,290,290,288,258 };
     static const uint8_t tab32[] = { 130,162,193,209,44,28,76,140,9,9,9,9,9,9,9,9,190,254,222,238,126,94,157,157,109,61,173,205 };
+#endif /* MINIMP3_WIDE_HUFFMAN */
     static const uint8_t tab33[] = { 252,236,220,204,188,172,156,140,124,108,92,76,60,44,28,12 };
+#ifndef MINIMP3_WIDE_HUFFMAN
     static const int16_t tabindex[2*16] = { 0,32,64,98,0,132,180,218,292,364,426,538,648,746,0,1126,1460,1460,1460,1460,1460,1460,1460,1460,1842,1842,1842,1842,1842,1842,1842,1842 };
+#endif /* MINIMP3_WIDE_HUFFMAN */
     static const uint8_t g_linbits[] =  { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,3,4,6,8,10,13,4,5,6,7,8,9,11,13 };
 
 #define PEEK_BITS(n)  (bs_cache >> (32 - n))
 #define FLUSH_BITS(n) { bs_cache <<= (n); bs_sh += (n); }
 #define CHECK_BITS    while (bs_sh >= 0) { bs_cache |= (uint32_t)*bs_next_ptr++ << bs_sh; bs_sh -= 8; }
 #define BSPOS         ((bs_next_ptr - bs->buf)*8 - 24 + bs_sh)
+#ifdef MINIMP3_HUFFMAN_STATS
+#define HUFF_STAT(t, hit) { mp3d_huffman_stats[t][0]++; mp3d_huffman_stats[t][1] += (hit); }
+#else /* MINIMP3_HUFFMAN_STATS */
+#define HUFF_STAT(t, hit)
+#endif /* MINIMP3_HUFFMAN_STATS */
 
-    float one = 0.0f;
+    float one = 0.0f, *dst_end = dst + 2*max_pairs;
     int ireg = 0, big_val_cnt = gr_info->big_values;
     const uint8_t *sfb = gr_info->sfbtab;
     const uint8_t *bs_next_ptr = bs->buf + bs->pos/8;
@@ -775,11 +950,23 @@ static void L3_huffman(float *dst, bs_t *bs, const L3_gr_info_t *gr_info, const
     int pairs_to_decode, np, bs_sh = (bs->pos & 7) - 8;
     bs_next_ptr += 4;
 
-    while (big_val_cnt > 0)
+    if (big_val_cnt > max_pairs)
+    {
+        big_val_cnt = max_pairs; /* lowpass: the rest of the granule is skipped */
+    }
+    /* a band is only started within part_23_length, which bounds the overread of corrupt
+       big_values (MAX_L3_HUFFMAN_OVERREAD) */
+    while (big_val_cnt > 0 && BSPOS <= layer3gr_limit)
     {
         int tab_num = gr_info->table_select[ireg];
         int sfb_cnt = gr_info->region_count[ireg++];
+#ifdef MINIMP3_WIDE_HUFFMAN
+        const int16_t *codebook = g_huff_wide + g_huff_wide_index[tab_num];
+        int first_bits = g_huff_wide_bits[tab_num];
+#else /* MINIMP3_WIDE_HUFFMAN */
         const int16_t *codebook = tabs + tabindex[tab_num];
+        int first_bits = 5;
+#endif /* MINIMP3_WIDE_HUFFMAN */
         int linbits = g_linbits[tab_num];
         if (linbits)
         {
@@ -790,8 +977,9 @@ static void L3_huffman(float *dst, bs_t *bs, const L3_gr_info_t *gr_info, const
                 one = *scf++;
                 do
                 {
-                    int j, w = 5;
+                    int j, w = first_bits;
                     int leaf = codebook[PEEK_BITS(w)];
+                    HUFF_STAT(tab_num, leaf >= 0);
                     while (leaf < 0)
                     {
                         FLUSH_BITS(w);
@@ -817,7 +1005,7 @@ static void L3_huffman(float *dst, bs_t *bs, const L3_gr_info_t *gr_info, const
                     }
                     CHECK_BITS;
                 } while (--pairs_to_decode);
-            } while ((big_val_cnt -= np) > 0 && --sfb_cnt >= 0);
+            } while ((big_val_cnt -= np) > 0 && --sfb_cnt >= 0 && BSPOS <= layer3gr_limit);
         } else
         {
             do
@@ -827,8 +1015,9 @@ static void L3_huffman(float *dst, bs_t *bs, const L3_gr_info_t *gr_info, const
                 one = *scf++;
                 do
                 {
-                    int j, w = 5;
+                    int j, w = first_bits;
                     int leaf = codebook[PEEK_BITS(w)];
+                    HUFF_STAT(tab_num, leaf >= 0);
                     while (leaf < 0)
                     {
                         FLUSH_BITS(w);
@@ -845,18 +1034,24 @@ static void L3_huffman(float *dst, bs_t *bs, const L3_gr_info_t *gr_info, const
                     }
                     CHECK_BITS;
                 } while (--pairs_to_decode);
-            } while ((big_val_cnt -= np) > 0 && --sfb_cnt >= 0);
+            } while ((big_val_cnt -= np) > 0 && --sfb_cnt >= 0 && BSPOS <= layer3gr_limit);
         }
     }
 
-    for (np = 1 - big_val_cnt;; dst += 4)
+    for (np = 1 - big_val_cnt; dst < dst_end; dst += 4)
     {
+#ifdef MINIMP3_WIDE_HUFFMAN
+        int leaf = (gr_info->count1_table) ? tab33[PEEK_BITS(4)] : g_huff_wide_count1[PEEK_BITS(6)];
+        HUFF_STAT(32 + gr_info->count1_table, 1);
+#else /* MINIMP3_WIDE_HUFFMAN */
         const uint8_t *codebook_count1 = (gr_info->count1_table) ? tab33 : tab32;
         int leaf = codebook_count1[PEEK_BITS(4)];
+        HUFF_STAT(32 + gr_info->count1_table, (leaf & 8) != 0);
         if (!(leaf & 8))
         {
             leaf = codebook_count1[(leaf >> 3) + (bs_cache << 4 >> (32 - (leaf & 3)))];
         }
+#endif /* MINIMP3_WIDE_HUFFMAN */
         FLUSH_BITS(leaf & 7);
         if (BSPOS > layer3gr_limit)
         {
@@ -867,6 +1062,10 @@ static void L3_huffman(float *dst, bs_t *bs, const L3_gr_info_t *gr_info, const
         RELOAD_SCALEFACTOR;
         DEQ_COUNT1(0);
         DEQ_COUNT1(1);
+        if (dst + 2 >= dst_end)
+        {
+            break; /* lowpass: the quad's second half lies above the last decoded subband */
+        }
         RELOAD_SCALEFACTOR;
         DEQ_COUNT1(2);
         DEQ_COUNT1(3);
@@ -1191,7 +1390,7 @@ static void L3_change_sign(float *grbuf)
             grbuf[i] = -grbuf[i];
 }
 
-static void L3_imdct_gr(float *grbuf, float *overlap, unsigned block_type, unsigned n_long_bands)
+static void L3_imdct_gr(float *grbuf, float *overlap, unsigned block_type, unsigned n_long_bands, unsigned nbands)
 {
     static const float g_mdct_window[2][18] = {
         { 0.99904822f,0.99144486f,0.97629601f,0.95371695f,0.92387953f,0.88701083f,0.84339145f,0.79335334f,0.73727734f,0.04361938f,0.13052619f,0.21643961f,0.30070580f,0.38268343f,0.46174861f,0.53729961f,0.60876143f,0.67559021f },
@@ -1204,9 +1403,14 @@ static void L3_imdct_gr(float *grbuf, float *overlap, unsigned block_type, unsig
         overlap += 9*n_long_bands;
     }
     if (block_type == SHORT_BLOCK_TYPE)
-        L3_imdct_short(grbuf, overlap, 32 - n_long_bands);
+        L3_imdct_short(grbuf, overlap, nbands - n_long_bands);
     else
-        L3_imdct36(grbuf, overlap, g_mdct_window[block_type == STOP_BLOCK_TYPE], 32 - n_long_bands);
+        L3_imdct36(grbuf, overlap, g_mdct_window[block_type == STOP_BLOCK_TYPE], nbands - n_long_bands);
+    if (nbands < 32)
+    {
+        /* lowpass: bands above nbands are silent, drop their overlap so they restart clean */
+        memset(overlap + 9*(nbands - n_long_bands), 0, 9*(32 - nbands)*sizeof(float));
+    }
 }
 
 static void L3_save_reservoir(mp3dec_t *h, mp3dec_scratch_t *s)
@@ -1231,28 +1435,33 @@ static int L3_restore_reservoir(mp3dec_t *h, bs_t *bs, mp3dec_scratch_t *s, int
     int bytes_have = MINIMP3_MIN(h->reserv, main_data_begin);
     memcpy(s->maindata, h->reserv_buf + MINIMP3_MAX(0, h->reserv - main_data_begin), MINIMP3_MIN(h->reserv, main_data_begin));
     memcpy(s->maindata + bytes_have, bs->buf + bs->pos/8, frame_bytes);
+    /* Huffman decoding may run past part_23_length (count1 sign bits, corrupt big_values): read zeros, not stale stack */
+    memset(s->maindata + bytes_have + frame_bytes, 0, MINIMP3_MIN(MAX_L3_HUFFMAN_OVERREAD, (int)sizeof(s->maindata) - bytes_have - frame_bytes));
     bs_init(&s->bs, s->maindata, bytes_have + frame_bytes);
     return h->reserv >= main_data_begin;
 }
 
-static void L3_decode(mp3dec_t *h, mp3dec_scratch_t *s, L3_gr_info_t *gr_info, int nch)
+MP3D_SPECIALIZED void L3_decode(mp3dec_t *h, mp3dec_scratch_t *s, L3_gr_info_t *gr_info, int nch, int mpeg1)
 {
-    int ch;
+    int ch, nbands = h->quality >= MP3D_QUALITY_LOWEST ? 10 : (h->quality >= MP3D_QUALITY_LOWPASS ? 20 : 32);
 
     for (ch = 0; ch < nch; ch++)
     {
         int layer3gr_limit = s->bs.pos + gr_info[ch].part_23_length;
-        L3_decode_scalefactors(h->header, s->ist_pos[ch], &s->bs, gr_info + ch, s->scf, ch);
-        L3_huffman(s->grbuf[ch], &s->bs, gr_info + ch, s->scf, layer3gr_limit);
+        L3_decode_scalefactors(h->header, s->ist_pos[ch], &s->bs, gr_info + ch, s->scf, ch, mpeg1);
+        MP3D_PROF_MARK(MP3D_PROF_SCALEFACTORS);
+        L3_huffman(s->grbuf[ch], &s->bs, gr_info + ch, s->scf, layer3gr_limit, nbands*9);
+        MP3D_PROF_MARK(MP3D_PROF_HUFFMAN);
     }
 
-    if (HDR_TEST_I_STEREO(h->header))
+    if (nch == 2 && HDR_TEST_I_STEREO(h->header)) /* mode_extension means nothing in mono frames */
     {
         L3_intensity_stereo(s->grbuf[0], s->ist_pos[1], gr_info, h->header);
     } else if (HDR_IS_MS_STEREO(h->header))
     {
         L3_midside_stereo(s->grbuf[0], 576);
     }
+    MP3D_PROF_MARK(MP3D_PROF_STEREO);
 
     for (ch = 0; ch < nch; ch++, gr_info++)
     {
@@ -1265,10 +1474,11 @@ static void L3_decode(mp3dec_t *h, mp3dec_scratch_t *s, L3_gr_info_t *gr_info, i
             L3_reorder(s->grbuf[ch] + n_long_bands*18, s->syn[0], gr_info->sfbtab + gr_info->n_long_sfb);
         }
 
-        L3_antialias(s->grbuf[ch], aa_bands);
-        L3_imdct_gr(s->grbuf[ch], h->mdct_overlap[ch], gr_info->block_type, n_long_bands);
+        L3_antialias(s->grbuf[ch], MINIMP3_MIN(aa_bands, nbands - 1));
+        L3_imdct_gr(s->grbuf[ch], h->mdct_overlap[ch], gr_info->block_type, n_long_bands, nbands);
         L3_change_sign(s->grbuf[ch]);
     }
+    MP3D_PROF_MARK(MP3D_PROF_IMDCT);
 }
 
 static void mp3d_DCT_II(float *grbuf, int n)
@@ -1327,7 +1537,9 @@ static void mp3d_DCT_II(float *grbuf, int n)
 
         if (k > n - 3)
         {
-#if HAVE_SSE
+#if HAVE_VEXT
+#define VSAVE2(i, v) vext_st2(&y[i*18], v)
+#elif HAVE_SSE
 #define VSAVE2(i, v) _mm_storel_pi((__m64 *)(void*)&y[i*18], v)
 #else /* HAVE_SSE */
 #define VSAVE2(i, v) vst1_f32((float32_t *)&y[i*18],  vget_low_f32(v))
@@ -1448,32 +1660,33 @@ static float mp3d_scale_pcm(float sample)
 }
 #endif /* MINIMP3_FLOAT_OUTPUT */
 
-static void mp3d_synth_pair(mp3d_sample_t *pcm, int nch, const float *z)
+MP3D_SPECIALIZED void mp3d_synth_pair(mp3d_sample_t *pcm, int nch, float * const *z, int k)
 {
     float a;
-    a  = (z[14*64] - z[    0]) * 29;
-    a += (z[ 1*64] + z[13*64]) * 213;
-    a += (z[12*64] - z[ 2*64]) * 459;
-    a += (z[ 3*64] + z[11*64]) * 2037;
-    a += (z[10*64] - z[ 4*64]) * 5153;
-    a += (z[ 5*64] + z[ 9*64]) * 6574;
-    a += (z[ 8*64] - z[ 6*64]) * 37489;
-    a +=  z[ 7*64]             * 75038;
+    a  = (z[14][k] - z[ 0][k]) * 29;
+    a += (z[ 1][k] + z[13][k]) * 213;
+    a += (z[12][k] - z[ 2][k]) * 459;
+    a += (z[ 3][k] + z[11][k]) * 2037;
+    a += (z[10][k] - z[ 4][k]) * 5153;
+    a += (z[ 5][k] + z[ 9][k]) * 6574;
+    a += (z[ 8][k] - z[ 6][k]) * 37489;
+    a +=  z[ 7][k]             * 75038;
     pcm[0] = mp3d_scale_pcm(a);
 
-    z += 2;
-    a  = z[14*64] * 104;
-    a += z[12*64] * 1567;
-    a += z[10*64] * 9727;
-    a += z[ 8*64] * 64019;
-    a += z[ 6*64] * -9975;
-    a += z[ 4*64] * -45;
-    a += z[ 2*64] * 146;
-    a += z[ 0*64] * -5;
+    k += 2;
+    a  = z[14][k] * 104;
+    a += z[12][k] * 1567;
+    a += z[10][k] * 9727;
+    a += z[ 8][k] * 64019;
+    a += z[ 6][k] * -9975;
+    a += z[ 4][k] * -45;
+    a += z[ 2][k] * 146;
+    a += z[ 0][k] * -5;
     pcm[16*nch] = mp3d_scale_pcm(a);
 }
 
-static void mp3d_synth(float *xl, mp3d_sample_t *dstl, int nch, float *lins)
+/* z[0..16] are the history blocks -15..+1 around the block being synthesized (z[15]) */
+MP3D_SPECIALIZED void mp3d_synth(float *xl, mp3d_sample_t *dstl, int nch, float * const *z)
 {
     int i;
     float *xr = xl + 576*(nch - 1);
@@ -1496,46 +1709,66 @@ static void mp3d_synth(float *xl, mp3d_sample_t *dstl, int nch, float *lins)
         -4,7,-91,117,177,-106,-1428,1698,402,545,-9416,9916,-7154,12980,-61289,66494,
         -5,6,-97,111,163,-127,-1498,1634,185,288,-9585,9838,-8540,11455,-62684,65290
     };
-    float *zlin = lins + 15*64;
+    float *zlin = z[15], *znext = z[16], *zprev = z[14];
+    float *rlin = zlin, *rnext = znext, *rprev = zprev;
     const float *w = g_win;
+#ifndef MINIMP3_NONSTANDARD_BUT_LOGICAL
+    float rdummy[64];
+
+    if (nch == 1)
+    {
+        /* mono leaves the right lanes of the history alone, see mp3d_synth_granule() */
+        rlin = rnext = rprev = rdummy;
+    }
+#endif /* MINIMP3_NONSTANDARD_BUT_LOGICAL */
 
     zlin[4*15]     = xl[18*16];
-    zlin[4*15 + 1] = xr[18*16];
+    rlin[4*15 + 1] = xr[18*16];
     zlin[4*15 + 2] = xl[0];
-    zlin[4*15 + 3] = xr[0];
+    rlin[4*15 + 3] = xr[0];
 
-    zlin[4*31]     = xl[1 + 18*16];
-    zlin[4*31 + 1] = xr[1 + 18*16];
-    zlin[4*31 + 2] = xl[1];
-    zlin[4*31 + 3] = xr[1];
+    znext[4*15]     = xl[1 + 18*16];
+    rnext[4*15 + 1] = xr[1 + 18*16];
+    znext[4*15 + 2] = xl[1];
+    rnext[4*15 + 3] = xr[1];
 
-    mp3d_synth_pair(dstr, nch, lins + 4*15 + 1);
-    mp3d_synth_pair(dstr + 32*nch, nch, lins + 4*15 + 64 + 1);
-    mp3d_synth_pair(dstl, nch, lins + 4*15);
-    mp3d_synth_pair(dstl + 32*nch, nch, lins + 4*15 + 64);
+    mp3d_synth_pair(dstr, nch, z, 4*15 + 1);
+    mp3d_synth_pair(dstr + 32*nch, nch, z + 1, 4*15 + 1);
+    mp3d_synth_pair(dstl, nch, z, 4*15);
+    mp3d_synth_pair(dstl + 32*nch, nch, z + 1, 4*15);
 
 #if HAVE_SIMD
     if (have_simd()) for (i = 14; i >= 0; i--)
     {
-#define VLOAD(k) f4 w0 = VSET(*w++); f4 w1 = VSET(*w++); f4 vz = VLD(&zlin[4*i - 64*k]); f4 vy = VLD(&zlin[4*i - 64*(15 - k)]);
+#define VLOAD(k) f4 w0 = VSET(*w++); f4 w1 = VSET(*w++); f4 vz = VLD(&z[15 - k][4*i]); f4 vy = VLD(&z[k][4*i]);
 #define V0(k) { VLOAD(k) b =         VADD(VMUL(vz, w1), VMUL(vy, w0)) ; a =         VSUB(VMUL(vz, w0), VMUL(vy, w1));  }
 #define V1(k) { VLOAD(k) b = VADD(b, VADD(VMUL(vz, w1), VMUL(vy, w0))); a = VADD(a, VSUB(VMUL(vz, w0), VMUL(vy, w1))); }
 #define V2(k) { VLOAD(k) b = VADD(b, VADD(VMUL(vz, w1), VMUL(vy, w0))); a = VADD(a, VSUB(VMUL(vy, w1), VMUL(vz, w0))); }
         f4 a, b;
         zlin[4*i]     = xl[18*(31 - i)];
-        zlin[4*i + 1] = xr[18*(31 - i)];
+        rlin[4*i + 1] = xr[18*(31 - i)];
         zlin[4*i + 2] = xl[1 + 18*(31 - i)];
-        zlin[4*i + 3] = xr[1 + 18*(31 - i)];
-        zlin[4*i + 64] = xl[1 + 18*(1 + i)];
-        zlin[4*i + 64 + 1] = xr[1 + 18*(1 + i)];
-        zlin[4*i - 64 + 2] = xl[18*(1 + i)];
-        zlin[4*i - 64 + 3] = xr[18*(1 + i)];
+        rlin[4*i + 3] = xr[1 + 18*(31 - i)];
+        znext[4*i]     = xl[1 + 18*(1 + i)];
+        rnext[4*i + 1] = xr[1 + 18*(1 + i)];
+        zprev[4*i + 2] = xl[18*(1 + i)];
+        rprev[4*i + 3] = xr[18*(1 + i)];
 
         V0(0) V2(1) V1(2) V2(3) V1(4) V2(5) V1(6) V2(7)
 
         {
 #ifndef MINIMP3_FLOAT_OUTPUT
-#if HAVE_SSE
+#if HAVE_VEXT
+            i4 pcma = vext_scale_pcm(a), pcmb = vext_scale_pcm(b);
+            dstr[(15 - i)*nch] = (int16_t)pcma[1];
+            dstr[(17 + i)*nch] = (int16_t)pcmb[1];
+            dstl[(15 - i)*nch] = (int16_t)pcma[0];
+            dstl[(17 + i)*nch] = (int16_t)pcmb[0];
+            dstr[(47 - i)*nch] = (int16_t)pcma[3];
+            dstr[(49 + i)*nch] = (int16_t)pcmb[3];
+            dstl[(47 - i)*nch] = (int16_t)pcma[2];
+            dstl[(49 + i)*nch] = (int16_t)pcmb[2];
+#elif HAVE_SSE
             static const f4 g_max = { 32767.0f, 32767.0f, 32767.0f, 32767.0f };
             static const f4 g_min = { -32768.0f, -32768.0f, -32768.0f, -32768.0f };
             __m128i pcm8 = _mm_packs_epi32(_mm_cvtps_epi32(_mm_max_ps(_mm_min_ps(a, g_max), g_min)),
@@ -1569,7 +1802,16 @@ static void mp3d_synth(float *xl, mp3d_sample_t *dstl, int nch, float *lins)
             static const f4 g_scale = { 1.0f/32768.0f, 1.0f/32768.0f, 1.0f/32768.0f, 1.0f/32768.0f };
             a = VMUL(a, g_scale);
             b = VMUL(b, g_scale);
-#if HAVE_SSE
+#if HAVE_VEXT
+            dstr[(15 - i)*nch] = a[1];
+            dstr[(17 + i)*nch] = b[1];
+            dstl[(15 - i)*nch] = a[0];
+            dstl[(17 + i)*nch] = b[0];
+            dstr[(47 - i)*nch] = a[3];
+            dstr[(49 + i)*nch] = b[3];
+            dstl[(47 - i)*nch] = a[2];
+            dstl[(49 + i)*nch] = b[2];
+#elif HAVE_SSE
             _mm_store_ss(dstr + (15 - i)*nch, _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)));
             _mm_store_ss(dstr + (17 + i)*nch, _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 1, 1, 1)));
             _mm_store_ss(dstl + (15 - i)*nch, _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0)));
@@ -1597,20 +1839,20 @@ static void mp3d_synth(float *xl, mp3d_sample_t *dstl, int nch, float *lins)
 #else /* MINIMP3_ONLY_SIMD */
     for (i = 14; i >= 0; i--)
     {
-#define LOAD(k) float w0 = *w++; float w1 = *w++; float *vz = &zlin[4*i - k*64]; float *vy = &zlin[4*i - (15 - k)*64];
+#define LOAD(k) float w0 = *w++; float w1 = *w++; float *vz = &z[15 - k][4*i]; float *vy = &z[k][4*i];
 #define S0(k) { int j; LOAD(k); for (j = 0; j < 4; j++) b[j]  = vz[j]*w1 + vy[j]*w0, a[j]  = vz[j]*w0 - vy[j]*w1; }
 #define S1(k) { int j; LOAD(k); for (j = 0; j < 4; j++) b[j] += vz[j]*w1 + vy[j]*w0, a[j] += vz[j]*w0 - vy[j]*w1; }
 #define S2(k) { int j; LOAD(k); for (j = 0; j < 4; j++) b[j] += vz[j]*w1 + vy[j]*w0, a[j] += vy[j]*w1 - vz[j]*w0; }
         float a[4], b[4];
 
         zlin[4*i]     = xl[18*(31 - i)];
-        zlin[4*i + 1] = xr[18*(31 - i)];
+        rlin[4*i + 1] = xr[18*(31 - i)];
         zlin[4*i + 2] = xl[1 + 18*(31 - i)];
-        zlin[4*i + 3] = xr[1 + 18*(31 - i)];
-        zlin[4*(i + 16)]   = xl[1 + 18*(1 + i)];
-        zlin[4*(i + 16) + 1] = xr[1 + 18*(1 + i)];
-        zlin[4*(i - 16) + 2] = xl[18*(1 + i)];
-        zlin[4*(i - 16) + 3] = xr[18*(1 + i)];
+        rlin[4*i + 3] = xr[1 + 18*(31 - i)];
+        znext[4*i]     = xl[1 + 18*(1 + i)];
+        rnext[4*i + 1] = xr[1 + 18*(1 + i)];
+        zprev[4*i + 2] = xl[18*(1 + i)];
+        rprev[4*i + 3] = xr[18*(1 + i)];
 
         S0(0) S2(1) S1(2) S2(3) S1(4) S2(5) S1(6) S2(7)
 
@@ -1626,38 +1868,167 @@ static void mp3d_synth(float *xl, mp3d_sample_t *dstl, int nch, float *lins)
 #endif /* MINIMP3_ONLY_SIMD */
 }
 
-static void mp3d_synth_granule(float *qmf_state, float *grbuf, int nbands, int nch, mp3d_sample_t *pcm, float *lins)
+MP3D_SPECIALIZED void mp3d_synth_granule(mp3dec_t *dec, float *grbuf, int nbands, int nch, mp3d_sample_t *pcm, float *tmp)
 {
-    int i;
+    /* the filterbank history is a ring of 17 blocks: 15 blocks of history plus the two a
+       mp3d_synth() call writes, so each granule synthesizes in place and only advances qmf_pos */
+    float *z[15 + 18];
+    int i, j, pos = dec->qmf_pos;
     for (i = 0; i < nch; i++)
     {
         mp3d_DCT_II(grbuf + 576*i, nbands);
     }
 
-    memcpy(lins, qmf_state, sizeof(float)*15*64);
+    if (nch == 2 && dec->qmf_right_pos != pos)
+    {
+        /* mono granules keep the right lanes where they were (the shifted-buffer decoder only
+           copied the left lanes back), so move them under the current history once */
+        int from = dec->qmf_right_pos, to = pos;
+        for (i = 0; i < 15; i++, from = from < 16 ? from + 1 : 0)
+            for (j = 0; j < 32; j++)
+                tmp[i*32 + j] = dec->qmf_state[from*64 + 2*j + 1];
+        for (i = 0; i < 15; i++, to = to < 16 ? to + 1 : 0)
+            for (j = 0; j < 32; j++)
+                dec->qmf_state[to*64 + 2*j + 1] = tmp[i*32 + j];
+    }
+
+    for (i = 0; i < 15 + nbands; i++, pos = pos < 16 ? pos + 1 : 0)
+    {
+        z[i] = dec->qmf_state + pos*64;
+    }
 
     for (i = 0; i < nbands; i += 2)
     {
-        mp3d_synth(grbuf + i, pcm + 32*nch*i, nch, lins + i*64);
+        mp3d_synth(grbuf + i, pcm + 32*nch*i, nch, z + i);
     }
+    dec->qmf_pos = (dec->qmf_pos + nbands) % 17;
 #ifndef MINIMP3_NONSTANDARD_BUT_LOGICAL
     if (nch == 1)
+        return;
+#endif /* MINIMP3_NONSTANDARD_BUT_LOGICAL */
+    dec->qmf_right_pos = dec->qmf_pos;
+}
+
+/* subband b of channel ch holds its n (12 or 18) time samples at grbuf[576*ch + 18*b];
+   three sums per band keep the additions independent */
+static void mp3d_band_energy(float *energy, const float *grbuf, int n, int nch)
+{
+    int ch, b, t;
+    for (ch = 0; ch < nch; ch++, grbuf += 576, energy += 32)
+    {
+        for (b = 0; b < 32; b++)
+        {
+            const float *x = grbuf + 18*b;
+            float e0 = 0, e1 = 0, e2 = 0;
+            for (t = 0; t < n; t += 3)
+            {
+                e0 += x[t]*x[t];
+                e1 += x[t + 1]*x[t + 1];
+                e2 += x[t + 2]*x[t + 2];
+            }
+            energy[b] += e0 + e1 + e2;
+        }
+    }
+}
+
+/* each band's gain moves a quarter of the way to its target per granule, ramped linearly
+   across the granule's n samples so that changes do not click; settled unity bands are skipped */
+static void mp3d_band_gain(float *gain, float *grbuf, int n, int nch)
+{
+    int ch, b, t;
+    for (b = 0; b < 32; b++)
+    {
+        float g = gain[b], target = gain[32 + b], step = (target - g)*0.25f;
+        if (step > -1e-5f && step < 1e-5f)
+        {
+            step = target - g; /* close enough: settle exactly */
+            if (g == 1.0f && step == 0.0f)
+                continue;
+        }
+        step /= n;
+        for (ch = 0; ch < nch; ch++)
+        {
+            float *x = grbuf + 576*ch + 18*b, gt = g;
+            for (t = 0; t < n; t++)
+            {
+                gt += step;
+                x[t] *= gt;
+            }
+        }
+        gain[b] = g + step*n;
+        if (gain[b] - target < 1e-6f && target - gain[b] < 1e-6f)
+            gain[b] = target;
+    }
+}
+
+MP3D_SPECIALIZED void L3_granule(mp3dec_t *dec, mp3dec_scratch_t *s, L3_gr_info_t *gr_info, int nch, int mpeg1, mp3d_sample_t *pcm)
+{
+    memset(s->grbuf[0], 0, 576*2*sizeof(float));
+    MP3D_PROF_MARK(MP3D_PROF_HUFFMAN);
+    L3_decode(dec, s, gr_info, nch, mpeg1);
+    if (dec->band_gain)
+    {
+        mp3d_band_gain(dec->band_gain, s->grbuf[0], 18, nch);
+    }
+    if (dec->band_energy)
     {
-        for (i = 0; i < 15*64; i += 2)
+        mp3d_band_energy(dec->band_energy, s->grbuf[0], 18, nch); /* before a mono downmix */
+    }
+    if (nch == 2 && dec->quality >= MP3D_QUALITY_MONO)
+    {
+        /* one synthesis pass on the downmix, duplicated into both output channels */
+        float *left = s->grbuf[0], *right = s->grbuf[1];
+        int i;
+        for (i = 0; i < 576; i++)
         {
-            qmf_state[i] = lins[nbands*64 + i];
+            left[i] = (left[i] + right[i])*0.5f;
+        }
+        mp3d_synth_granule(dec, left, 18, 1, pcm, s->syn[0]);
+        for (i = 575; i >= 0; i--)
+        {
+            pcm[2*i] = pcm[2*i + 1] = pcm[i];
         }
     } else
-#endif /* MINIMP3_NONSTANDARD_BUT_LOGICAL */
     {
-        memcpy(qmf_state, lins + nbands*64, sizeof(float)*15*64);
+        mp3d_synth_granule(dec, s->grbuf[0], 18, nch, pcm, s->syn[0]);
     }
+    MP3D_PROF_MARK(MP3D_PROF_SYNTH);
 }
 
-static int mp3d_match_frame(const uint8_t *hdr, int mp3_bytes, int frame_bytes)
+#ifdef MINIMP3_SPECIALIZE
+#define L3_GRANULE_VARIANT(name, nch, mpeg1) \
+    static void name(mp3dec_t *dec, mp3dec_scratch_t *s, L3_gr_info_t *gr_info, mp3d_sample_t *pcm) \
+    { \
+        L3_granule(dec, s, gr_info, nch, mpeg1, pcm); \
+    }
+L3_GRANULE_VARIANT(L3_granule_stereo_mpeg1, 2, 1)
+L3_GRANULE_VARIANT(L3_granule_mono_mpeg1, 1, 1)
+L3_GRANULE_VARIANT(L3_granule_stereo_lsf, 2, 0)
+
+static void L3_granule_any(mp3dec_t *dec, mp3dec_scratch_t *s, L3_gr_info_t *gr_info, int nch, int mpeg1, mp3d_sample_t *pcm)
+{
+    if (mpeg1)
+    {
+        if (nch == 2)
+            L3_granule_stereo_mpeg1(dec, s, gr_info, pcm);
+        else
+            L3_granule_mono_mpeg1(dec, s, gr_info, pcm);
+    } else if (nch == 2)
+    {
+        L3_granule_stereo_lsf(dec, s, gr_info, pcm);
+    } else
+    {
+        L3_granule(dec, s, gr_info, nch, mpeg1, pcm); /* mono LSF: generic copy */
+    }
+}
+#else /* MINIMP3_SPECIALIZE */
+#define L3_granule_any L3_granule
+#endif /* MINIMP3_SPECIALIZE */
+
+static int mp3d_match_frame(const uint8_t *hdr, int mp3_bytes, int frame_bytes, int max_matches)
 {
     int i, nmatch;
-    for (i = 0, nmatch = 0; nmatch < MAX_FRAME_SYNC_MATCHES; nmatch++)
+    for (i = 0, nmatch = 0; nmatch < max_matches; nmatch++)
     {
         i += hdr_frame_bytes(hdr + i, frame_bytes) + hdr_padding(hdr + i);
         if (i + HDR_SIZE > mp3_bytes)
@@ -1668,18 +2039,30 @@ static int mp3d_match_frame(const uint8_t *hdr, int mp3_bytes, int frame_bytes)
     return 1;
 }
 
-static int mp3d_find_frame(const uint8_t *mp3, int mp3_bytes, int *free_format_bytes, int *ptr_frame_bytes)
+static int mp3d_find_frame(const uint8_t *mp3, int mp3_bytes, int *free_format_bytes, int *ptr_frame_bytes, int sync_matches)
 {
     int i, k;
     for (i = 0; i < mp3_bytes - HDR_SIZE; i++, mp3++)
     {
+        /* every header starts with 0xFF: let memchr skip the junk in between */
+        const uint8_t *sync = (const uint8_t *)memchr(mp3, 0xff, mp3_bytes - HDR_SIZE - i);
+        if (!sync)
+            break;
+        i += (int)(sync - mp3);
+        mp3 = sync;
         if (hdr_valid(mp3))
         {
             int frame_bytes = hdr_frame_bytes(mp3, *free_format_bytes);
             int frame_and_padding = frame_bytes + hdr_padding(mp3);
+            int k_max = MINIMP3_MIN(MAX_FREE_FORMAT_FRAME_SIZE, (mp3_bytes - HDR_SIZE - i + 1)/2);
 
-            for (k = HDR_SIZE; !frame_bytes && k < MAX_FREE_FORMAT_FRAME_SIZE && i + 2*k < mp3_bytes - HDR_SIZE; k++)
+            for (k = HDR_SIZE; !frame_bytes && k < k_max; k++)
             {
+                /* candidates for the next header also start with 0xFF */
+                const uint8_t *next = (const uint8_t *)memchr(mp3 + k, 0xff, k_max - k);
+                if (!next)
+                    break;
+                k = (int)(next - mp3);
                 if (hdr_compare(mp3, mp3 + k))
                 {
                     int fb = k - hdr_padding(mp3);
@@ -1692,7 +2075,7 @@ static int mp3d_find_frame(const uint8_t *mp3, int mp3_bytes, int *free_format_b
                 }
             }
             if ((frame_bytes && i + frame_and_padding <= mp3_bytes &&
-                mp3d_match_frame(mp3, mp3_bytes - i, frame_bytes)) ||
+                mp3d_match_frame(mp3, mp3_bytes - i, frame_bytes, sync_matches)) ||
                 (!i && frame_and_padding == mp3_bytes))
             {
                 *ptr_frame_bytes = frame_and_padding;
@@ -1708,6 +2091,8 @@ static int mp3d_find_frame(const uint8_t *mp3, int mp3_bytes, int *free_format_b
 void mp3dec_init(mp3dec_t *dec)
 {
     dec->header[0] = 0;
+    dec->sync_matches = MAX_FRAME_SYNC_MATCHES;
+    dec->quality = MP3D_QUALITY_FULL;
 }
 
 int mp3dec_decode_frame(mp3dec_t *dec, const uint8_t *mp3, int mp3_bytes, mp3d_sample_t *pcm, mp3dec_frame_info_t *info)
@@ -1717,6 +2102,7 @@ int mp3dec_decode_frame(mp3dec_t *dec, const uint8_t *mp3, int mp3_bytes, mp3d_s
     bs_t bs_frame[1];
     mp3dec_scratch_t scratch;
 
+    MP3D_PROF_START();
     if (mp3_bytes > 4 && dec->header[0] == 0xff && hdr_compare(dec->header, mp3))
     {
         frame_size = hdr_frame_bytes(mp3, dec->free_format_bytes) + hdr_padding(mp3);
@@ -1727,8 +2113,15 @@ int mp3dec_decode_frame(mp3dec_t *dec, const uint8_t *mp3, int mp3_bytes, mp3d_s
     }
     if (!frame_size)
     {
+        int sync_matches = dec->sync_matches, quality = dec->quality;
+        float *band_energy = dec->band_energy, *band_gain = dec->band_gain;
         memset(dec, 0, sizeof(mp3dec_t));
-        i = mp3d_find_frame(mp3, mp3_bytes, &dec->free_format_bytes, &frame_size);
+        dec->sync_matches = sync_matches;
+        dec->quality = quality;
+        dec->band_energy = band_energy;
+        dec->band_gain = band_gain;
+        i = mp3d_find_frame(mp3, mp3_bytes, &dec->free_format_bytes, &frame_size, sync_matches > 0 ? sync_matches : MAX_FRAME_SYNC_MATCHES);
+        MP3D_PROF_MARK(MP3D_PROF_SYNC);
         if (!frame_size || i + frame_size > mp3_bytes)
         {
             info->frame_bytes = i;
@@ -1744,6 +2137,7 @@ int mp3dec_decode_frame(mp3dec_t *dec, const uint8_t *mp3, int mp3_bytes, mp3d_s
     info->hz = hdr_sample_rate_hz(hdr);
     info->layer = 4 - HDR_GET_LAYER(hdr);
     info->bitrate_kbps = hdr_bitrate_kbps(hdr);
+    MP3D_PROF_MARK(MP3D_PROF_SYNC);
 
     if (!pcm)
     {
@@ -1761,20 +2155,20 @@ int mp3dec_decode_frame(mp3dec_t *dec, const uint8_t *mp3, int mp3_bytes, mp3d_s
         int main_data_begin = L3_read_side_info(bs_frame, scratch.gr_info, hdr);
         if (main_data_begin < 0 || bs_frame->pos > bs_frame->limit)
         {
-            mp3dec_init(dec);
+            dec->header[0] = 0; /* lose sync, keep settings */
             return 0;
         }
         success = L3_restore_reservoir(dec, bs_frame, &scratch, main_data_begin);
+        MP3D_PROF_MARK(MP3D_PROF_SIDE_INFO);
         if (success)
         {
             for (igr = 0; igr < (HDR_TEST_MPEG1(hdr) ? 2 : 1); igr++, pcm += 576*info->channels)
             {
-                memset(scratch.grbuf[0], 0, 576*2*sizeof(float));
-                L3_decode(dec, &scratch, scratch.gr_info + igr*info->channels, info->channels);
-                mp3d_synth_granule(dec->qmf_state, scratch.grbuf[0], 18, info->channels, pcm, scratch.syn[0]);
+                L3_granule_any(dec, &scratch, scratch.gr_info + igr*info->channels, info->channels, HDR_TEST_MPEG1(hdr) != 0, pcm);
             }
         }
         L3_save_reservoir(dec, &scratch);
+        MP3D_PROF_MARK(MP3D_PROF_SIDE_INFO);
     } else
     {
 #ifdef MINIMP3_ONLY_MP3
@@ -1782,6 +2176,7 @@ int mp3dec_decode_frame(mp3dec_t *dec, const uint8_t *mp3, int mp3_bytes, mp3d_s
 #else /* MINIMP3_ONLY_MP3 */
         L12_scale_info sci[1];
         L12_read_scale_info(hdr, bs_frame, sci);
+        MP3D_PROF_MARK(MP3D_PROF_SIDE_INFO);
 
         memset(scratch.grbuf[0], 0, 576*2*sizeof(float));
         for (i = 0, igr = 0; igr < 3; igr++)
@@ -1790,13 +2185,23 @@ int mp3dec_decode_frame(mp3dec_t *dec, const uint8_t *mp3, int mp3_bytes, mp3d_s
             {
                 i = 0;
                 L12_apply_scf_384(sci, sci->scf + igr, scratch.grbuf[0]);
-                mp3d_synth_granule(dec->qmf_state, scratch.grbuf[0], 12, info->channels, pcm, scratch.syn[0]);
+                MP3D_PROF_MARK(MP3D_PROF_HUFFMAN); /* Layer I/II: dequantization */
+                if (dec->band_gain)
+                {
+                    mp3d_band_gain(dec->band_gain, scratch.grbuf[0], 12, info->channels);
+                }
+                if (dec->band_energy)
+                {
+                    mp3d_band_energy(dec->band_energy, scratch.grbuf[0], 12, info->channels);
+                }
+                mp3d_synth_granule(dec, scratch.grbuf[0], 12, info->channels, pcm, scratch.syn[0]);
                 memset(scratch.grbuf[0], 0, 576*2*sizeof(float));
+                MP3D_PROF_MARK(MP3D_PROF_SYNTH);
                 pcm += 384*info->channels;
             }
             if (bs_frame->pos > bs_frame->limit)
             {
-                mp3dec_init(dec);
+                dec->header[0] = 0; /* lose sync, keep settings */
                 return 0;
             }
         }
@@ -1805,11 +2210,125 @@ int mp3dec_decode_frame(mp3dec_t *dec, const uint8_t *mp3, int mp3_bytes, mp3d_s
     return success*hdr_frame_samples(dec->header);
 }
 
+/* side info loudness (mp3dec_frame_power): per Huffman table, the mean |q|^(8/3) and bits per line
+   under the distribution its code lengths imply, the value an escape table stands for and the mean
+   attenuation of unknown scalefactors, see tools/gen_side_power.py */
+#include "minimp3_side_power.h"
+
+/* lines start..end-1 of energy e per line, attenuated by the scalefactor partition(s) they fall in */
+static float L3_side_lines(const int *part_end, const float *att, int start, int end, float e)
+{
+    float sum = 0;
+    int p;
+    for (p = 0; start < end; p++)
+    {
+        int to = (p < 4) ? MINIMP3_MIN(part_end[p], end) : end;
+        if (to > start)
+        {
+            sum += (to - start)*e*att[p];
+            start = to;
+        }
+    }
+    return sum;
+}
+
+static float L3_side_info_power(const uint8_t *hdr, const L3_gr_info_t *gr, int ch, int mpeg1)
+{
+    uint8_t scf_size[4];
+    const uint8_t *scf_partition = L3_scf_sizes(hdr, gr, ch, mpeg1, scf_size);
+    const uint8_t *sfb = gr->sfbtab;
+    int part_end[4], i, k, ireg, line = 0, bits = gr->part_23_length, lines = 2*gr->big_values, scfsi = mpeg1 ? gr->scfsi : 0;
+    float att[5], energy = 0, huff_bits = 0, count1;
+
+    /* where each partition's scalefactors end, in lines, and the bits they took */
+    for (i = 0; i < 4; i++)
+    {
+        for (k = 0; k < scf_partition[i] && *sfb; k++)
+        {
+            line += *sfb++;
+        }
+        part_end[i] = line;
+        att[i] = g_side_scf[gr->scalefac_scale][MINIMP3_MIN(scf_size[i], 5)];
+        if (!(scfsi & (8 >> i)))
+        {
+            bits -= scf_partition[i]*scf_size[i];
+        }
+    }
+    att[4] = 1.0f; /* the top band has no scalefactor */
+
+    /* big_values regions: region_count + 1 bands each, the last one up to big_values */
+    for (sfb = gr->sfbtab, line = 0, ireg = 0; ireg < 3 && line < lines; ireg++)
+    {
+        int t = gr->table_select[ireg], start = line;
+        for (k = gr->region_count[ireg]; k >= 0 && *sfb && line < lines; k--)
+        {
+            line += *sfb++;
+        }
+        line = MINIMP3_MIN(line, lines);
+        energy += L3_side_lines(part_end, att, start, line, g_side_energy[t]);
+        huff_bits += (line - start)*g_side_bits[t];
+        if (t >= 16)
+        {
+            energy += 2*L3_side_lines(part_end, att, start, start + 1, g_side_peak[t - 16]);
+        }
+    }
+
+    /* count1 region: what the bits left would code */
+    count1 = (bits - huff_bits)/g_side_bits[32 + gr->count1_table];
+    if (count1 > 0)
+    {
+        int end = lines + (int)MINIMP3_MIN(count1, (float)(576 - lines));
+        energy += L3_side_lines(part_end, att, lines, end, g_side_energy[32 + gr->count1_table]);
+    }
+
+    if (gr->block_type == SHORT_BLOCK_TYPE)
+    {
+        /* subblock_gain: 2^(-2*gain) per window */
+        energy *= (L3_ldexp_q2(1.0f, 16*gr->subblock_gain[0]) + L3_ldexp_q2(1.0f, 16*gr->subblock_gain[1]) +
+            L3_ldexp_q2(1.0f, 16*gr->subblock_gain[2]))*(1.0f/3);
+    }
+    /* dequantized |x|^2 = |q|^(8/3)*2^((global_gain - 214)/2); the granule's power relative to full
+       scale is twice their sum (IMDCT gain 9, filterbank 2^37, over 32768^2 and 576 samples) */
+    return L3_ldexp_q2(energy*2965820.0f, 2*(255 - gr->global_gain));
+}
+
+float mp3dec_frame_power(const uint8_t *mp3, int mp3_bytes)
+{
+    bs_t bs[1];
+    L3_gr_info_t gr_info[4];
+    int igr, ch, nch, ngr;
+    float power = 0;
+
+    if (mp3_bytes <= HDR_SIZE || !hdr_valid(mp3) || 4 - HDR_GET_LAYER(mp3) != 3)
+    {
+        return 0;
+    }
+    bs_init(bs, mp3 + HDR_SIZE, mp3_bytes - HDR_SIZE);
+    if (HDR_IS_CRC(mp3))
+    {
+        get_bits(bs, 16);
+    }
+    if (L3_read_side_info(bs, gr_info, mp3) < 0 || bs->pos > bs->limit)
+    {
+        return 0;
+    }
+    nch = HDR_IS_MONO(mp3) ? 1 : 2;
+    ngr = HDR_TEST_MPEG1(mp3) ? 2 : 1;
+    for (igr = 0; igr < ngr; igr++)
+    {
+        for (ch = 0; ch < nch; ch++)
+        {
+            power += L3_side_info_power(mp3, gr_info + igr*nch + ch, ch, ngr == 2);
+        }
+    }
+    return power/(ngr*nch);
+}
+
 #ifdef MINIMP3_FLOAT_OUTPUT
 void mp3dec_f32_to_s16(const float *in, int16_t *out, int num_samples)
 {
     int i = 0;
-#if HAVE_SIMD
+#if HAVE_SIMD && !HAVE_VEXT
     int aligned_count = num_samples & ~7;
     for(; i < aligned_count; i += 8)
     {
@@ -1845,7 +2364,7 @@ void mp3dec_f32_to_s16(const float *in, int16_t *out, int num_samples)
         vst1_lane_s16(out+i+7, pcmb, 3);
 #endif /* HAVE_SSE */
     }
-#endif /* HAVE_SIMD */
+#endif /* HAVE_SIMD && !HAVE_VEXT */
     for(; i < num_samples; i++)
     {
         float sample = in[i] * 32768.0f;
@@ -0,0 +1,312 @@
+/* Generated by tools/gen_huff_wide.py --bits 8 from minimp3.h, do not edit.
+   Wide-first-level Huffman tables for MINIMP3_WIDE_HUFFMAN, 9160 bytes. */
+#ifndef MINIMP3_HUFF_WIDE_H
+#define MINIMP3_HUFF_WIDE_H
+
+#define MINIMP3_HUFF_WIDE_BITS 8
+
+static const int16_t g_huff_wide[4500] = {
+    0,0,785,784,513,513,256,256,256,256,1570,1568,1313,1313,1298,1298,
+    1282,1282,785,785,785,785,785,785,785,785,784,784,784,784,784,784,
+    784,784,769,769,769,769,769,769,769,769,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,1570,1568,1313,1313,1298,1298,
+    1282,1282,769,769,769,769,769,769,769,769,529,529,529,529,529,529,
+    529,529,529,529,529,529,529,529,529,529,528,528,528,528,528,528,
+    528,528,528,528,528,528,528,528,528,528,512,512,512,512,512,512,
+    512,512,512,512,512,512,512,512,512,512,2099,2098,1827,1827,1555,1555,
+    1555,1555,1841,1841,1840,1840,1795,1795,1826,1826,1569,1569,1569,1569,1554,1554,
+    1554,1554,1568,1568,1568,1568,1538,1538,1538,1538,785,785,785,785,785,785,
+    785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,
+    785,785,785,785,785,785,785,785,785,785,784,784,784,784,784,784,
+    784,784,784,784,784,784,784,784,784,784,784,784,784,784,784,784,
+    784,784,784,784,784,784,784,784,784,784,769,769,769,769,769,769,
+    769,769,769,769,769,769,769,769,769,769,769,769,769,769,769,769,
+    769,769,769,769,769,769,769,769,769,769,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,1843,1840,1586,1586,1571,1571,
+    1539,1539,1329,1329,1329,1329,1299,1299,1299,1299,1314,1314,1314,1314,1312,1312,
+    1312,1312,1057,1057,1057,1057,1057,1057,1057,1057,1042,1042,1042,1042,1042,1042,
+    1042,1042,1026,1026,1026,1026,1026,1026,1026,1026,784,784,784,784,784,784,
+    784,784,784,784,784,784,784,784,784,784,529,529,529,529,529,529,
+    529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,
+    529,529,529,529,529,529,529,529,529,529,769,769,769,769,769,769,
+    769,769,769,769,769,769,769,769,769,769,768,768,768,768,768,768,
+    768,768,768,768,768,768,768,768,768,768,-2046,-2079,-2095,2129,2069,-2111,
+    2053,-2127,2114,2084,1857,1857,1812,1812,1796,1796,2112,2098,2083,2096,1841,1841,
+    1811,1811,1795,1795,1826,1826,1569,1569,1569,1569,1298,1298,1298,1298,1298,1298,
+    1298,1298,1568,1568,1568,1568,1538,1538,1538,1538,1041,1041,1041,1041,1041,1041,
+    1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,784,784,784,784,784,784,
+    784,784,784,784,784,784,784,784,784,784,784,784,784,784,784,784,
+    784,784,784,784,784,784,784,784,784,784,769,769,769,769,769,769,
+    769,769,769,769,769,769,769,769,769,769,769,769,769,769,769,769,
+    769,769,769,769,769,769,769,769,769,769,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,597,596,581,565,339,324,
+    338,293,336,323,308,307,-2045,-2110,-2143,2129,2069,-2159,-2175,2114,2084,2113,
+    1812,1812,2112,2052,2098,2083,2097,2067,2096,2051,1570,1570,1570,1570,1568,1568,
+    1568,1568,1538,1538,1538,1538,1057,1057,1057,1057,1057,1057,1057,1057,1057,1057,
+    1057,1057,1057,1057,1057,1057,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,
+    1042,1042,1042,1042,1042,1042,529,529,529,529,529,529,529,529,529,529,
+    529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,
+    529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,
+    529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,
+    529,529,529,529,529,529,784,784,784,784,784,784,784,784,784,784,
+    784,784,784,784,784,784,784,784,784,784,784,784,784,784,784,784,
+    784,784,784,784,784,784,769,769,769,769,769,769,769,769,769,769,
+    769,769,769,769,769,769,769,769,769,769,769,769,769,769,769,769,
+    769,769,769,769,769,769,512,512,512,512,512,512,512,512,512,512,
+    512,512,512,512,512,512,512,512,512,512,512,512,512,512,512,512,
+    512,512,512,512,512,512,512,512,512,512,512,512,512,512,512,512,
+    512,512,512,512,512,512,512,512,512,512,512,512,512,512,512,512,
+    512,512,512,512,512,512,853,837,596,596,309,309,309,309,595,580,
+    338,338,293,336,323,308,261,307,-2047,2131,2101,-2063,2116,2130,2085,2129,
+    1813,1813,1859,1859,1844,1844,2053,2112,1858,1858,1828,1828,1843,1843,1796,1796,
+    1601,1601,1601,1601,1556,1556,1556,1556,1586,1586,1586,1586,1571,1571,1571,1571,
+    1329,1329,1329,1329,1329,1329,1329,1329,1299,1299,1299,1299,1299,1299,1299,1299,
+    1584,1584,1584,1584,1539,1539,1539,1539,1314,1314,1314,1314,1314,1314,1314,1314,
+    1312,1312,1312,1312,1312,1312,1312,1312,1057,1057,1057,1057,1057,1057,1057,1057,
+    1057,1057,1057,1057,1057,1057,1057,1057,1042,1042,1042,1042,1042,1042,1042,1042,
+    1042,1042,1042,1042,1042,1042,1042,1042,1026,1026,1026,1026,1026,1026,1026,1026,
+    1026,1026,1026,1026,1026,1026,1026,1026,785,785,785,785,785,785,785,785,
+    785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,
+    785,785,785,785,785,785,785,785,784,784,784,784,784,784,784,784,
+    784,784,784,784,784,784,784,784,784,784,784,784,784,784,784,784,
+    784,784,784,784,784,784,784,784,769,769,769,769,769,769,769,769,
+    769,769,769,769,769,769,769,769,769,769,769,769,769,769,769,769,
+    769,769,769,769,769,769,769,769,768,768,768,768,768,768,768,768,
+    768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,
+    768,768,768,768,768,768,768,768,341,340,325,336,-2045,-2110,-2141,-2207,
+    -2222,-2254,-2286,2161,2071,-2319,-2334,-2366,2145,2070,2054,-2399,-2415,-2431,2113,2068,
+    2052,2098,2083,2096,1841,1841,1811,1811,1795,1795,1826,1826,1569,1569,1569,1569,
+    1554,1554,1554,1554,1568,1568,1568,1568,1538,1538,1538,1538,1041,1041,1041,1041,
+    1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,784,784,784,784,
+    784,784,784,784,784,784,784,784,784,784,784,784,784,784,784,784,
+    784,784,784,784,784,784,784,784,784,784,784,784,769,769,769,769,
+    769,769,769,769,769,769,769,769,769,769,769,769,769,769,769,769,
+    769,769,769,769,769,769,769,769,769,769,769,769,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,887,886,871,885,
+    855,870,628,628,583,613,598,627,567,567,612,612,853,837,566,566,
+    370,295,582,624,263,263,294,294,596,595,352,352,565,580,355,354,
+    594,549,337,337,277,277,579,564,336,261,322,292,307,320,-2046,-2077,
+    -2142,-2175,-2190,2162,2087,-2223,1815,1815,2161,2055,2147,2102,2054,-2239,-2255,2129,
+    1830,1830,2146,2144,1889,1889,1814,1814,2069,2115,2053,-2271,2114,2084,2113,2068,
+    2112,2052,1842,1842,1827,1827,1585,1585,1585,1585,1555,1555,1555,1555,1840,1840,
+    1795,1795,1570,1570,1570,1570,1298,1298,1298,1298,1298,1298,1298,1298,1057,1057,
+    1057,1057,1057,1057,1057,1057,1057,1057,1057,1057,1057,1057,1057,1057,1312,1312,
+    1312,1312,1312,1312,1312,1312,1282,1282,1282,1282,1282,1282,1282,1282,785,785,
+    785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,
+    785,785,785,785,785,785,785,785,785,785,785,785,785,785,784,784,
+    784,784,784,784,784,784,784,784,784,784,784,784,784,784,784,784,
+    784,784,784,784,784,784,784,784,784,784,784,784,784,784,769,769,
+    769,769,769,769,769,769,769,769,769,769,769,769,769,769,769,769,
+    769,769,769,769,769,769,769,769,769,769,769,769,769,769,512,512,
+    512,512,512,512,512,512,512,512,512,512,512,512,512,512,512,512,
+    512,512,512,512,512,512,512,512,512,512,512,512,512,512,512,512,
+    512,512,512,512,512,512,512,512,512,512,512,512,512,512,512,512,
+    512,512,512,512,512,512,512,512,512,512,512,512,512,512,631,630,
+    615,599,614,614,628,628,583,583,885,853,613,598,371,371,311,356,
+    596,581,595,565,326,368,324,338,293,336,308,307,-2046,-2079,-2095,-2111,
+    2149,2163,-2127,2162,2087,2148,2118,2161,2071,-2143,2147,2102,2132,2117,2116,-2159,
+    1890,1890,1830,1830,1814,1814,2145,2054,2131,2101,2130,2085,1873,1873,1813,1813,
+    1859,1859,1844,1844,2053,2112,1858,1858,1828,1828,1857,1857,1587,1587,1587,1587,
+    1556,1556,1556,1556,1586,1586,1586,1586,1571,1571,1571,1571,1796,1796,1840,1840,
+    1539,1539,1539,1539,1329,1329,1329,1329,1329,1329,1329,1329,1299,1299,1299,1299,
+    1299,1299,1299,1299,1314,1314,1314,1314,1314,1314,1314,1314,1057,1057,1057,1057,
+    1057,1057,1057,1057,1057,1057,1057,1057,1057,1057,1057,1057,1042,1042,1042,1042,
+    1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1312,1312,1312,1312,
+    1312,1312,1312,1312,1282,1282,1282,1282,1282,1282,1282,1282,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,785,785,785,785,
+    785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,
+    785,785,785,785,785,785,785,785,785,785,785,785,784,784,784,784,
+    784,784,784,784,784,784,784,784,784,784,784,784,784,784,784,784,
+    784,784,784,784,784,784,784,784,784,784,784,784,769,769,769,769,
+    769,769,769,769,769,769,769,769,769,769,769,769,769,769,769,769,
+    769,769,769,769,769,769,769,769,769,769,769,769,631,630,359,359,
+    373,343,358,372,327,342,311,341,368,263,352,336,-2041,-3339,-3595,-3852,
+    -3980,-4108,-4237,-4301,-4365,-4429,-4493,-4557,-4623,-4638,-4669,-4735,-4750,-4782,-4814,-4846,
+    2072,-4879,-4895,-4911,-4926,-4959,2129,2069,-4975,-4991,-5007,2113,1812,1812,2112,2052,
+    2098,2083,1841,1841,1811,1811,1840,1840,1795,1795,1826,1826,1569,1569,1569,1569,
+    1554,1554,1554,1554,1568,1568,1568,1568,1538,1538,1538,1538,1041,1041,1041,1041,
+    1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1040,1040,1040,1040,
+    1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,769,769,769,769,
+    769,769,769,769,769,769,769,769,769,769,769,769,769,769,769,769,
+    769,769,769,769,769,769,769,769,769,769,769,769,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,-3068,-3199,-3215,-3231,
+    -3247,-3262,1998,2013,-3295,2027,1982,2041,1951,1966,2011,1981,2040,1935,1996,-3311,
+    2024,-3327,1663,1663,1709,1709,2010,1995,1980,1903,1782,1782,1678,1678,1781,1781,
+    1753,1753,1693,1693,1631,1631,1662,1662,1738,1738,1723,1723,1780,1780,1615,1615,
+    1964,1902,1599,1599,1523,1523,1523,1523,1752,1752,1677,1677,1522,1522,1522,1522,
+    1327,1327,1327,1327,1766,1766,1737,1737,1520,1520,1520,1520,1692,1692,1765,1765,
+    1466,1466,1466,1466,1751,1751,1661,1661,1508,1508,1508,1508,1676,1676,1645,1645,
+    1507,1507,1507,1507,1435,1435,1435,1435,1721,1721,1706,1706,1265,1265,1265,1265,
+    1265,1265,1265,1265,1055,1055,1055,1055,1055,1055,1055,1055,1263,1231,991,991,
+    734,734,734,734,511,511,511,511,511,511,511,511,510,509,494,508,
+    493,507,447,492,461,461,762,670,431,476,490,489,503,487,1039,1039,
+    1451,1374,1358,1480,1494,1342,1070,1070,1506,1504,1249,1249,1054,1054,1294,1493,
+    1373,1479,1404,1492,1464,1419,1357,1449,1434,1478,1132,1132,1235,1235,1341,1463,
+    1234,1234,1069,1069,1233,1233,1147,1147,1477,1372,1433,1447,1084,1084,1402,1401,
+    1204,1204,797,797,797,797,1232,1232,1037,1037,1192,1192,1162,1162,1220,1100,
+    1206,1131,963,963,962,962,812,812,949,949,1115,1176,961,961,796,796,
+    1161,1216,780,780,1099,1190,1130,1175,947,947,827,827,1160,1189,946,946,
+    1114,1174,842,842,1159,1144,841,841,1143,1127,555,555,555,555,689,689,
+    539,539,944,779,873,932,931,826,917,857,674,674,554,554,673,673,
+    538,538,928,902,522,522,872,916,569,569,915,901,856,886,658,658,
+    553,553,885,855,643,643,568,568,870,884,839,869,854,823,401,281,
+    656,521,644,584,551,551,868,838,386,386,386,386,296,385,627,626,
+    369,369,279,279,597,624,519,611,566,596,581,610,550,595,384,264,
+    353,278,352,262,565,580,338,338,293,336,323,308,261,322,292,307,
+    -2043,-2299,-2556,-2684,-2812,-2941,-3005,-3068,-3197,-3261,-3325,-3389,-3454,-3485,-3549,-3614,
+    -3646,-3678,-3710,-3742,-3774,-3806,-3838,-3870,-3903,-3919,-3935,-3950,-3983,-3999,-4014,-4047,
+    -4063,-4079,2073,-4095,-4111,-4127,-4143,-4159,2178,2088,2177,2072,-4175,-4191,-4207,-4223,
+    2162,2087,2118,2161,2133,2071,-4239,2147,2102,2132,2117,2146,2086,2145,-4255,2131,
+    1814,1814,2101,2116,1874,1874,1829,1829,1873,1873,1813,1813,2128,2053,1859,1859,
+    1844,1844,1858,1858,1828,1828,1843,1843,1556,1556,1556,1556,1857,1857,1856,1856,
+    1586,1586,1586,1586,1571,1571,1571,1571,1796,1796,1840,1840,1585,1585,1585,1585,
+    1555,1555,1555,1555,1539,1539,1539,1539,1314,1314,1314,1314,1314,1314,1314,1314,
+    1313,1313,1313,1313,1313,1313,1313,1313,1298,1298,1298,1298,1298,1298,1298,1298,
+    1312,1312,1312,1312,1312,1312,1312,1312,1282,1282,1282,1282,1282,1282,1282,1282,
+    785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,
+    785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,785,
+    1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,
+    1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,
+    768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,
+    768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,
+    1535,1534,1519,1533,1262,1262,1503,1532,1487,1517,1502,1531,1215,1215,1516,1486,
+    1245,1245,1274,1274,1199,1199,1259,1259,1214,1214,1244,1244,1229,1229,1273,1273,
+    1183,1183,1198,1198,1243,1243,1213,1213,1272,1272,1167,1167,1228,1228,1257,1257,
+    1182,1182,1271,1271,1151,1151,1242,1242,1197,1197,1227,1227,1270,1270,1514,1520,
+    956,956,879,879,1256,1166,1269,1241,863,863,999,999,894,894,970,970,
+    940,940,955,955,1181,1240,1012,1012,847,847,1011,1011,831,831,909,909,
+    878,878,1010,1010,815,815,1254,1039,1009,1009,799,799,969,969,924,924,
+    997,954,939,862,983,893,996,846,968,908,995,982,877,830,953,923,
+    994,994,938,938,814,814,993,993,798,798,1248,1038,981,981,861,861,
+    967,892,980,952,589,589,907,937,922,966,876,979,573,573,557,557,
+    978,976,721,721,695,695,635,635,541,541,965,781,604,604,680,680,
+    650,708,588,694,619,619,921,960,707,707,572,572,679,679,634,634,
+    618,618,780,944,300,300,706,693,603,705,664,649,540,692,587,678,
+    691,663,315,315,633,648,690,677,299,299,602,689,283,283,523,662,
+    617,676,586,647,632,675,314,314,405,345,418,298,417,282,672,522,
+    390,390,360,404,329,403,313,313,631,656,389,344,402,374,359,297,
+    401,265,388,328,373,343,387,312,358,372,327,384,264,357,342,371,
+    311,356,368,263,352,262,-2045,-2109,-2174,2303,-2206,-2239,-2249,2095,-3327,2289,
+    2079,-3338,-3851,-4107,-4364,-4492,-4620,-4749,-4813,-4877,-4941,-5005,-5069,-5133,-5198,-5230,
+    -5263,-5278,-5310,-5343,2069,-5359,-5375,-5391,-5407,2113,2068,-5423,2098,2083,1841,1841,
+    1811,1811,2096,2051,1826,1826,1569,1569,1569,1569,1554,1554,1554,1554,1568,1568,
+    1568,1568,1538,1538,1538,1538,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,
+    1041,1041,1041,1041,1041,1041,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,
+    1040,1040,1040,1040,1040,1040,769,769,769,769,769,769,769,769,769,769,
+    769,769,769,769,769,769,769,769,769,769,769,769,769,769,769,769,
+    769,769,769,769,769,769,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,1022,1007,1021,991,1020,975,1019,959,762,762,
+    943,1017,927,911,760,760,759,639,758,623,757,607,500,500,335,319,
+    271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,
+    271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,
+    271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,
+    271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,
+    755,755,755,755,755,755,755,755,755,755,755,755,755,755,755,755,
+    755,755,755,755,755,755,755,755,755,755,755,755,755,755,755,755,
+    -3278,2029,1950,-3311,1774,1774,2014,1982,1771,1771,1756,1756,1997,1981,1770,1770,
+    1740,1740,2010,1965,2023,1994,1708,1708,1948,2007,1765,1765,1499,1499,1499,1499,
+    492,492,718,733,430,413,498,496,1513,1513,1739,1724,1768,1678,1753,1662,
+    1723,1752,1677,1766,1390,1390,1481,1481,1722,1707,1630,1661,1508,1508,1614,1736,
+    1420,1420,1507,1507,1494,1494,1645,1721,1691,1706,1310,1310,1357,1357,1675,1690,
+    1463,1463,1659,1549,1086,1086,1086,1086,1504,1504,1294,1294,1493,1493,1373,1373,
+    1479,1479,1404,1404,1492,1492,1464,1464,1449,1478,1388,1491,1477,1372,1232,1232,
+    1448,1418,1433,1476,1387,1447,1219,1219,1461,1432,1217,1217,1036,1036,1417,1431,
+    814,814,814,814,1250,1250,1249,1249,1085,1085,1234,1234,1069,1069,1053,1053,
+    1203,1203,1401,1416,977,977,977,977,1100,1100,1206,1206,1084,1084,1146,1146,
+    962,962,962,962,1068,1068,1115,1115,1052,1216,1204,1099,1190,1130,827,827,
+    1189,1114,946,946,811,811,945,945,795,795,1200,1035,1174,1129,1188,1098,
+    1159,1144,826,826,1187,1173,930,930,1113,1158,794,794,1128,1143,841,841,
+    1172,1141,886,886,554,554,554,554,673,673,928,778,915,825,901,856,
+    658,658,553,553,871,912,657,657,537,537,777,900,840,855,899,824,
+    870,898,552,552,884,839,641,641,536,536,520,520,896,869,627,627,
+    567,567,854,868,626,626,551,551,838,853,624,624,369,369,369,369,
+    279,279,519,611,566,596,581,610,294,353,278,278,608,518,309,309,
+    595,580,338,293,337,336,323,308,261,322,292,307,320,260,2302,2287,
+    2301,2271,2300,2255,2299,2239,1967,1967,2298,2297,1951,1951,1935,1935,2296,2295,
+    1919,1919,2038,2038,1903,1903,2037,2037,1887,1887,2036,2036,1871,1871,2035,2035,
+    1855,1855,2034,2034,1839,1839,1823,1823,2289,2063,-2045,-2109,-2173,-2237,1279,1279,
+    1279,1279,1279,1279,1279,1279,1279,1279,1279,1279,1279,1279,1279,1279,-2300,-2429,
+    -2493,-2557,-2622,-2654,-2686,-2718,-2750,-2782,-2814,-2846,-2878,-2909,-2974,-3006,-3038,-3069,
+    -3134,-3165,-3231,-3246,-3278,-3311,-3326,-3359,-3375,-3391,-3407,-3423,-3439,-3455,-3471,-3487,
+    -3503,-3519,-3535,-3551,-3567,-3583,-3599,-3615,-3630,-3663,-3678,2103,-3711,2087,2148,2118,
+    2133,2071,2147,2102,2132,2117,2146,2086,2145,2070,-3727,2131,2101,2116,2130,2085,
+    2129,-3743,1813,1813,2115,2100,1858,1858,1828,1828,1843,1843,1857,1857,1812,1812,
+    2112,2052,1842,1842,1827,1827,1585,1585,1585,1585,1555,1555,1555,1555,1840,1840,
+    1795,1795,1570,1570,1570,1570,1313,1313,1313,1313,1313,1313,1313,1313,1298,1298,
+    1298,1298,1298,1298,1298,1298,1568,1568,1568,1568,1538,1538,1538,1538,1041,1041,
+    1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1041,1040,1040,
+    1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1040,1025,1025,
+    1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1025,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,496,496,
+    496,496,1006,1005,990,1004,974,989,1003,958,988,973,1002,942,987,957,
+    972,1001,926,986,941,971,956,1000,910,985,925,999,894,970,940,940,
+    955,955,984,984,909,909,1248,1038,976,976,622,622,622,622,998,969,
+    668,668,741,741,683,683,606,606,954,983,637,637,590,590,712,712,
+    652,652,996,994,739,739,726,621,574,697,667,682,558,737,542,725,
+    605,711,636,724,696,651,589,681,666,710,620,723,573,722,557,721,
+    695,635,541,709,604,680,650,665,708,588,694,694,619,619,781,960,
+    707,707,572,679,634,706,556,693,603,705,664,649,540,692,780,944,
+    691,691,779,928,673,673,331,331,678,618,663,663,633,633,778,912,
+    521,521,315,392,690,677,299,299,602,689,539,662,361,330,676,647,
+    376,376,419,314,405,345,418,298,282,390,360,375,404,329,403,313,
+    389,344,402,374,359,297,401,281,388,328,373,343,387,312,358,386,
+    296,385,372,327,280,280,640,520,357,342,369,369,624,519,371,370,
+    352,262,336,261
+};
+
+static const int16_t g_huff_wide_index[32] = {
+    0,2,10,74,0,138,394,522,790,1064,1324,1630,1916,2188,0,2816,
+    3350,3350,3350,3350,3350,3350,3350,3350,4030,4030,4030,4030,4030,4030,4030,4030
+};
+
+/* first-level width per table_select; longest codewords: 0,3,6,6,0,8,7,10,11,9,11,11,10,19,0,13,17,17,17,17,17,17,17,17,12,12,12,12,12,12,12,12 */
+static const uint8_t g_huff_wide_bits[32] = {
+    1,3,6,6,1,8,7,8,8,8,8,8,8,8,1,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8
+};
+
+/* count1 table A, indexed by the next 6 bits: (xywv << 4) | 8 | length */
+static const uint8_t g_huff_wide_count1[64] = {
+    190,254,222,238,126,94,157,157,109,109,61,61,173,173,205,205,
+    44,44,44,44,28,28,28,28,76,76,76,76,140,140,140,140,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9
+};
+
+#endif /* MINIMP3_HUFF_WIDE_H */
@@ -0,0 +1,1049 @@
+/* Generated by tools/gen_pow43.py, do not edit.
+   pow(x, 4/3) for 129 <= x < MINIMP3_POW43_TABLE_SIZE, in 512-entry steps. */
+#ifndef MINIMP3_POW43_H
+#define MINIMP3_POW43_H
+
+static const float g_pow43_ext[] = {
+    651.807861f,658.553589f,665.31665f,672.096924f,678.894348f,685.708801f,692.540283f,699.388611f,
+    706.253723f,713.13562f,720.034119f,726.949158f,733.880737f,740.828674f,747.792969f,754.773499f,
+    761.770264f,768.783081f,775.81189f,782.85675f,789.917419f,796.993896f,804.086182f,811.194092f,
+    818.317627f,825.456665f,832.611206f,839.781189f,846.966431f,854.166992f,861.382751f,868.613647f,
+    875.859619f,883.120605f,890.396545f,897.687378f,904.993103f,912.313538f,919.648682f,926.998535f,
+    934.362915f,941.741882f,949.135376f,956.543213f,963.965454f,971.402039f,978.852844f,986.317871f,
+    993.796997f,1001.29028f,1008.79761f,1016.31891f,1023.85419f,1031.40332f,1038.96631f,1046.54309f,
+    1054.13354f,1061.73779f,1069.35559f,1076.98706f,1084.63196f,1092.29041f,1099.9624f,1107.64771f,
+    1115.34631f,1123.05835f,1130.78357f,1138.52197f,1146.27368f,1154.03833f,1161.81616f,1169.60706f,
+    1177.41101f,1185.22778f,1193.0575f,1200.90015f,1208.75549f,1216.62378f,1224.50476f,1232.39832f,
+    1240.30469f,1248.22363f,1256.15515f,1264.09912f,1272.05579f,1280.02478f,1288.00623f,1296.0f,
+    1304.00623f,1312.02466f,1320.05542f,1328.09839f,1336.15356f,1344.22083f,1352.30029f,1360.39185f,
+    1368.49548f,1376.61108f,1384.73865f,1392.87817f,1401.02954f,1409.19287f,1417.36804f,1425.55505f,
+    1433.75378f,1441.96423f,1450.1864f,1458.42017f,1466.66565f,1474.92273f,1483.19141f,1491.47156f,
+    1499.76331f,1508.06653f,1516.3811f,1524.70715f,1533.04456f,1541.39331f,1549.75342f,1558.12476f,
+    1566.50745f,1574.90137f,1583.3064f,1591.72266f,1600.15002f,1608.5885f,1617.03809f,1625.49866f,
+    1633.97034f,1642.453f,1650.94653f,1659.45117f,1667.96655f,1676.49292f,1685.03015f,1693.57812f,
+    1702.13696f,1710.70654f,1719.28687f,1727.87793f,1736.47974f,1745.09204f,1753.71521f,1762.34888f,
+    1770.99304f,1779.64795f,1788.31323f,1796.98914f,1805.67542f,1814.37219f,1823.07947f,1831.79712f,
+    1840.52515f,1849.26355f,1858.01233f,1866.77136f,1875.54065f,1884.32019f,1893.11011f,1901.91016f,
+    1910.72034f,1919.54077f,1928.37122f,1937.21191f,1946.06274f,1954.92358f,1963.79443f,1972.67529f,
+    1981.56628f,1990.46716f,1999.37805f,2008.29883f,2017.22961f,2026.17017f,2035.12073f,2044.08105f,
+    2053.05127f,2062.03125f,2071.021f,2080.02051f,2089.02979f,2098.04883f,2107.07764f,2116.11597f,
+    2125.16406f,2134.22168f,2143.28906f,2152.36597f,2161.45239f,2170.54858f,2179.65405f,2188.76929f,
+    2197.8938f,2207.02783f,2216.17139f,2225.32446f,2234.48682f,2243.65869f,2252.83984f,2262.03052f,
+    2271.23047f,2280.4397f,2289.6582f,2298.88599f,2308.12305f,2317.36963f,2326.625f,2335.88989f,
+    2345.16382f,2354.44702f,2363.7395f,2373.04102f,2382.35156f,2391.67114f,2401.0f,2410.33789f,
+    2419.68481f,2429.04077f,2438.40576f,2447.77979f,2457.1626f,2466.55444f,2475.95532f,2485.36523f,
+    2494.78394f,2504.21167f,2513.64795f,2523.09351f,2532.54761f,2542.01074f,2551.48242f,2560.96313f,
+    2570.45264f,2579.95093f,2589.45776f,2598.97339f,2608.4978f,2618.03101f,2627.57275f,2637.12329f,
+    2646.68237f,2656.25f,2665.82642f,2675.41138f,2685.00513f,2694.60718f,2704.21802f,2713.83716f,
+    2723.46509f,2733.10132f,2742.74609f,2752.39941f,2762.06128f,2771.73145f,2781.41016f,2791.09717f,
+    2800.79272f,2810.49658f,2820.20898f,2829.92969f,2839.65869f,2849.396f,2859.1416f,2868.89575f,
+    2878.65796f,2888.42847f,2898.20752f,2907.99438f,2917.78979f,2927.59351f,2937.40527f,2947.2251f,
+    2957.05347f,2966.88965f,2976.73413f,2986.58691f,2996.44775f,3006.31665f,3016.1936f,3026.07861f,
+    3035.97192f,3045.87305f,3055.78247f,3065.69971f,3075.62524f,3085.55859f,3095.5f,3105.44922f,
+    3115.40674f,3125.37183f,3135.34521f,3145.32642f,3155.31543f,3165.3125f,3175.31738f,3185.33032f,
+    3195.35107f,3205.37964f,3215.41602f,3225.46021f,3235.51221f,3245.57227f,3255.63989f,3265.71533f,
+    3275.79858f,3285.88965f,3295.98853f,3306.09497f,3316.20923f,3326.33105f,3336.46069f,3346.59814f,
+    3356.74316f,3366.896f,3377.0564f,3387.22437f,3397.3999f,3407.58325f,3417.77417f,3427.97266f,
+    3438.17871f,3448.39233f,3458.61377f,3468.84253f,3479.07886f,3489.32275f,3499.57422f,3509.83301f,
+    3520.09937f,3530.37329f,3540.65479f,3550.9436f,3561.23999f,3571.5437f,3581.85498f,3592.17358f,
+    3602.49951f,3612.83301f,3623.17383f,3633.52197f,3643.87769f,3654.24072f,3664.61084f,3674.98853f,
+    3685.37354f,3695.76587f,3706.16553f,3716.57251f,3726.98657f,3737.4082f,3747.83691f,3758.27295f,
+    3768.71631f,3779.16675f,3789.62451f,3800.08936f,3810.56152f,3821.04102f,3831.52759f,3842.02124f,
+    3852.52222f,3863.03027f,3873.54541f,3884.06787f,3894.59741f,3905.13403f,3915.67773f,3926.22852f,
+    3936.78638f,3947.35132f,3957.92358f,3968.50269f,3979.08887f,3989.68213f,4000.28247f,4010.88965f,
+    4021.50391f,4032.12524f,4042.75366f,4053.38892f,4064.03125f,4074.68066f,4085.33691f,4096.0f,
+    4106.66992f,4117.34717f,4128.03125f,4138.72217f,4149.41992f,4160.12451f,4170.83643f,4181.55469f,
+    4192.28027f,4203.01221f,4213.75146f,4224.49756f,4235.25f,4246.00977f,4256.77637f,4267.54932f,
+    4278.32959f,4289.11621f,4299.91016f,4310.71045f,4321.51758f,4332.33154f,4343.15234f,4353.97949f,
+    4364.81396f,4375.65479f,4386.50244f,4397.35645f,4408.21777f,4419.08545f,4429.95947f,4440.84082f,
+    4451.72852f,4462.62305f,4473.52393f,4484.43164f,4495.34619f,4506.26709f,4517.19482f,4528.12891f,
+    4539.06982f,4550.01709f,4560.97119f,4571.93164f,4582.89893f,4593.87256f,4604.85254f,4615.83936f,
+    4626.83301f,4637.83301f,4648.83936f,4659.85205f,4670.87158f,4681.89746f,4692.93018f,4703.96875f,
+    4715.01416f,4726.06641f,4737.12451f,4748.18945f,4759.26074f,4770.33838f,4781.42236f,4792.51318f,
+    4803.61035f,4814.71338f,4825.82324f,4836.93945f,4848.06201f,4859.19092f,4870.32666f,4881.46826f,
+    4892.61621f,4903.77051f,4914.93164f,4926.09863f,4937.27197f,4948.45166f,4959.63818f,4970.83057f,
+    4982.0293f,4993.23389f,5004.44531f,5015.66309f,5026.88672f,5038.11719f,5049.35352f,5060.59619f,
+    5071.84473f,5083.1001f,5094.36133f,5105.62891f,5116.90283f,5128.18262f,5139.46924f,5150.76172f,
+    5162.06006f,5173.36475f,5184.67578f,5195.99316f,5207.31641f,5218.646f,5229.98145f,5241.32324f,
+    5252.67139f,5264.02539f,5275.38525f,5286.75195f,5298.12402f,5309.50293f,5320.88721f,5332.27783f,
+    5343.6748f,5355.07764f,5366.48682f,5377.90186f,5389.32275f,5400.75f,5412.18311f,5423.62207f,
+    5435.06738f,5446.51904f,5457.97607f,5469.43945f,5480.90869f,5492.38428f,5503.86572f,5515.35303f,
+#if MINIMP3_POW43_TABLE_SIZE > 641
+    5526.84619f,5538.34521f,5549.85059f,5561.36182f,5572.87891f,5584.40234f,5595.93115f,5607.46631f,
+    5619.00732f,5630.5542f,5642.10693f,5653.66553f,5665.23047f,5676.80078f,5688.37744f,5699.95947f,
+    5711.54785f,5723.14209f,5734.74219f,5746.34766f,5757.95947f,5769.57715f,5781.20068f,5792.83008f,
+    5804.46484f,5816.10596f,5827.75244f,5839.40527f,5851.06348f,5862.72803f,5874.39795f,5886.07373f,
+    5897.75537f,5909.44287f,5921.13574f,5932.83496f,5944.53955f,5956.25f,5967.96631f,5979.68848f,
+    5991.41602f,6003.14941f,6014.88867f,6026.63379f,6038.38428f,6050.14111f,6061.90283f,6073.6709f,
+    6085.44434f,6097.22363f,6109.0083f,6120.79932f,6132.59521f,6144.39746f,6156.20508f,6168.01807f,
+    6179.8374f,6191.66162f,6203.49219f,6215.32812f,6227.16943f,6239.0166f,6250.86963f,6262.72803f,
+    6274.5918f,6286.46143f,6298.33691f,6310.21777f,6322.104f,6333.99609f,6345.89404f,6357.79688f,
+    6369.70557f,6381.62012f,6393.54004f,6405.46533f,6417.39648f,6429.33301f,6441.27539f,6453.22266f,
+    6465.17578f,6477.13477f,6489.09912f,6501.06885f,6513.04395f,6525.0249f,6537.01074f,6549.00293f,
+    6561.0f,6573.00293f,6585.01074f,6597.0249f,6609.04395f,6621.06836f,6633.09863f,6645.13428f,
+    6657.17529f,6669.22168f,6681.27344f,6693.33105f,6705.39355f,6717.46191f,6729.53564f,6741.61426f,
+    6753.69873f,6765.78857f,6777.88428f,6789.98486f,6802.09082f,6814.20215f,6826.31885f,6838.44141f,
+    6850.56885f,6862.70166f,6874.84033f,6886.98389f,6899.13281f,6911.28711f,6923.44678f,6935.61182f,
+    6947.78223f,6959.95801f,6972.13916f,6984.32568f,6996.51709f,7008.71436f,7020.9165f,7033.12451f,
+    7045.3374f,7057.55566f,7069.77881f,7082.00781f,7094.2417f,7106.48145f,7118.72607f,7130.97559f,
+    7143.23096f,7155.49121f,7167.75684f,7180.02783f,7192.3042f,7204.58545f,7216.87207f,7229.16406f,
+    7241.46143f,7253.76367f,7266.07129f,7278.38379f,7290.70166f,7303.0249f,7315.35352f,7327.68701f,
+    7340.02588f,7352.36963f,7364.71875f,7377.07324f,7389.43262f,7401.79736f,7414.16699f,7426.54199f,
+    7438.92236f,7451.30762f,7463.69824f,7476.09375f,7488.49414f,7500.90039f,7513.31104f,7525.72754f,
+    7538.14844f,7550.5752f,7563.00635f,7575.44287f,7587.88477f,7600.33154f,7612.78369f,7625.24072f,
+    7637.70264f,7650.16992f,7662.64209f,7675.11914f,7687.60156f,7700.08936f,7712.58154f,7725.07959f,
+    7737.58203f,7750.08984f,7762.60254f,7775.12012f,7787.64307f,7800.1709f,7812.7041f,7825.2417f,
+    7837.78467f,7850.33301f,7862.88574f,7875.44385f,7888.00684f,7900.57471f,7913.14795f,7925.72607f,
+    7938.30908f,7950.89697f,7963.48975f,7976.08789f,7988.69092f,8001.29883f,8013.91162f,8026.5293f,
+    8039.15234f,8051.77979f,8064.4126f,8077.05029f,8089.69287f,8102.34033f,8114.99316f,8127.65039f,
+    8140.31299f,8152.97998f,8165.65234f,8178.32959f,8191.01172f,8203.69824f,8216.39062f,8229.08691f,
+    8241.78906f,8254.49512f,8267.20703f,8279.92285f,8292.64453f,8305.37012f,8318.10156f,8330.83691f,
+    8343.57812f,8356.32324f,8369.07422f,8381.8291f,8394.58984f,8407.35449f,8420.12402f,8432.89941f,
+    8445.67871f,8458.46289f,8471.25195f,8484.0459f,8496.84473f,8509.64844f,8522.45703f,8535.27051f,
+    8548.08887f,8560.91113f,8573.73926f,8586.57227f,8599.40918f,8612.25098f,8625.09863f,8637.9502f,
+    8650.80664f,8663.66797f,8676.5332f,8689.4043f,8702.28027f,8715.16016f,8728.0459f,8740.93555f,
+    8753.83008f,8766.72949f,8779.63379f,8792.54199f,8805.45605f,8818.37402f,8831.29688f,8844.22461f,
+    8857.15723f,8870.09473f,8883.03711f,8895.9834f,8908.93457f,8921.89062f,8934.85156f,8947.81738f,
+    8960.78711f,8973.7627f,8986.74219f,8999.72656f,9012.71484f,9025.70898f,9038.70703f,9051.70996f,
+    9064.71777f,9077.73047f,9090.74707f,9103.76855f,9116.79492f,9129.82617f,9142.86133f,9155.90234f,
+    9168.94727f,9181.99609f,9195.05078f,9208.10938f,9221.17285f,9234.24121f,9247.31348f,9260.39062f,
+    9273.47266f,9286.55957f,9299.65039f,9312.74609f,9325.84668f,9338.95215f,9352.06152f,9365.17578f,
+    9378.29492f,9391.41797f,9404.5459f,9417.67871f,9430.81543f,9443.95703f,9457.10352f,9470.25391f,
+    9483.41016f,9496.56934f,9509.73438f,9522.90332f,9536.07715f,9549.25488f,9562.43848f,9575.625f,
+    9588.81738f,9602.01367f,9615.21484f,9628.41992f,9641.62988f,9654.84473f,9668.06348f,9681.28711f,
+    9694.51465f,9707.74707f,9720.98438f,9734.22656f,9747.47266f,9760.72266f,9773.97754f,9787.2373f,
+    9800.50195f,9813.77051f,9827.04297f,9840.32129f,9853.60254f,9866.88965f,9880.18066f,9893.47559f,
+    9906.77539f,9920.08008f,9933.38867f,9946.70215f,9960.01953f,9973.3418f,9986.66895f,10000.0f,
+    10013.3359f,10026.6758f,10040.0195f,10053.3691f,10066.7217f,10080.0801f,10093.4424f,10106.8086f,
+    10120.1797f,10133.5547f,10146.9346f,10160.3193f,10173.708f,10187.1006f,10200.498f,10213.9004f,
+    10227.3066f,10240.7168f,10254.1318f,10267.5518f,10280.9756f,10294.4033f,10307.8359f,10321.2734f,
+    10334.7148f,10348.1602f,10361.6104f,10375.0645f,10388.5234f,10401.9873f,10415.4541f,10428.9258f,
+    10442.4023f,10455.8828f,10469.3682f,10482.8574f,10496.3506f,10509.8486f,10523.3516f,10536.8574f,
+    10550.3691f,10563.8838f,10577.4033f,10590.9277f,10604.4561f,10617.9883f,10631.5254f,10645.0664f,
+    10658.6123f,10672.1621f,10685.7158f,10699.2744f,10712.8369f,10726.4043f,10739.9756f,10753.5508f,
+    10767.1309f,10780.7148f,10794.3027f,10807.8955f,10821.4932f,10835.0938f,10848.6992f,10862.3096f,
+    10875.9238f,10889.542f,10903.1641f,10916.791f,10930.4219f,10944.0576f,10957.6973f,10971.3408f,
+    10984.9893f,10998.6416f,11012.2979f,11025.959f,11039.624f,11053.293f,11066.9668f,11080.6445f,
+    11094.3262f,11108.0117f,11121.7021f,11135.3975f,11149.0957f,11162.7988f,11176.5059f,11190.2178f,
+    11203.9326f,11217.6533f,11231.377f,11245.1055f,11258.8379f,11272.5742f,11286.3145f,11300.0596f,
+    11313.8086f,11327.5625f,11341.3193f,11355.0811f,11368.8467f,11382.6172f,11396.3916f,11410.1699f,
+    11423.9521f,11437.7383f,11451.5293f,11465.3242f,11479.123f,11492.9268f,11506.7344f,11520.5459f,
+    11534.3613f,11548.1807f,11562.0049f,11575.833f,11589.665f,11603.502f,11617.3418f,11631.1865f,
+    11645.0352f,11658.8887f,11672.7451f,11686.6064f,11700.4717f,11714.3408f,11728.2139f,11742.0918f,
+    11755.9736f,11769.8594f,11783.749f,11797.6426f,11811.541f,11825.4424f,11839.3486f,11853.2588f,
+    11867.1738f,11881.0918f,11895.0146f,11908.9404f,11922.8711f,11936.8057f,11950.7451f,11964.6875f,
+    11978.6348f,11992.5859f,12006.54f,12020.5f,12034.4629f,12048.4297f,12062.4014f,12076.376f,
+#endif
+#if MINIMP3_POW43_TABLE_SIZE > 1153
+    12090.3555f,12104.3389f,12118.3262f,12132.3174f,12146.3135f,12160.3125f,12174.3164f,12188.3242f,
+    12202.335f,12216.3506f,12230.3711f,12244.3945f,12258.4219f,12272.4541f,12286.4893f,12300.5293f,
+    12314.5723f,12328.6201f,12342.6719f,12356.7275f,12370.7871f,12384.8516f,12398.9189f,12412.9902f,
+    12427.0664f,12441.1465f,12455.2295f,12469.3174f,12483.4092f,12497.5049f,12511.6045f,12525.708f,
+    12539.8154f,12553.9268f,12568.042f,12582.1611f,12596.2852f,12610.4121f,12624.5439f,12638.6787f,
+    12652.8184f,12666.9609f,12681.1084f,12695.2588f,12709.4141f,12723.5732f,12737.7363f,12751.9023f,
+    12766.0732f,12780.248f,12794.4268f,12808.6094f,12822.7959f,12836.9863f,12851.1807f,12865.3789f,
+    12879.5811f,12893.7871f,12907.9971f,12922.2109f,12936.4287f,12950.6504f,12964.876f,12979.1055f,
+    12993.3389f,13007.5762f,13021.8174f,13036.0625f,13050.3115f,13064.5645f,13078.8213f,13093.082f,
+    13107.3467f,13121.6152f,13135.8877f,13150.1641f,13164.4434f,13178.7275f,13193.0156f,13207.3066f,
+    13221.6025f,13235.9023f,13250.2051f,13264.5127f,13278.8232f,13293.1387f,13307.457f,13321.7793f,
+    13336.1064f,13350.4365f,13364.7705f,13379.1084f,13393.4502f,13407.7959f,13422.1455f,13436.499f,
+    13450.8555f,13465.2168f,13479.582f,13493.9502f,13508.3223f,13522.6992f,13537.0791f,13551.4629f,
+    13565.8506f,13580.2422f,13594.6377f,13609.0371f,13623.4404f,13637.8467f,13652.2578f,13666.6719f,
+    13681.0898f,13695.5117f,13709.9375f,13724.3672f,13738.8008f,13753.2383f,13767.6787f,13782.124f,
+    13796.5723f,13811.0244f,13825.4805f,13839.9404f,13854.4043f,13868.8721f,13883.3428f,13897.8184f,
+    13912.2969f,13926.7793f,13941.2656f,13955.7559f,13970.25f,13984.7471f,13999.249f,14013.7539f,
+    14028.2627f,14042.7754f,14057.292f,14071.8115f,14086.3359f,14100.8633f,14115.3945f,14129.9297f,
+    14144.4688f,14159.0107f,14173.5576f,14188.1074f,14202.6611f,14217.2188f,14231.7803f,14246.3447f,
+    14260.9141f,14275.4863f,14290.0625f,14304.6416f,14319.2256f,14333.8125f,14348.4033f,14362.998f,
+    14377.5967f,14392.1992f,14406.8047f,14421.4141f,14436.0273f,14450.6445f,14465.2646f,14479.8896f,
+    14494.5176f,14509.1494f,14523.7842f,14538.4238f,14553.0664f,14567.7129f,14582.3623f,14597.0166f,
+    14611.6738f,14626.335f,14641.0f,14655.6689f,14670.3408f,14685.0166f,14699.6963f,14714.3789f,
+    14729.0664f,14743.7568f,14758.4512f,14773.1484f,14787.8496f,14802.5547f,14817.2637f,14831.9766f,
+    14846.6924f,14861.4121f,14876.1357f,14890.8623f,14905.5938f,14920.3271f,14935.0654f,14949.8066f,
+    14964.5527f,14979.3008f,14994.0537f,15008.8096f,15023.5693f,15038.333f,15053.0996f,15067.8701f,
+    15082.6445f,15097.4229f,15112.2041f,15126.9893f,15141.7773f,15156.5703f,15171.3662f,15186.166f,
+    15200.9688f,15215.7754f,15230.5859f,15245.3994f,15260.2168f,15275.0381f,15289.8633f,15304.6914f,
+    15319.5234f,15334.3594f,15349.1982f,15364.041f,15378.8867f,15393.7373f,15408.5898f,15423.4473f,
+    15438.3076f,15453.1719f,15468.04f,15482.9111f,15497.7861f,15512.6641f,15527.5469f,15542.4326f,
+    15557.3213f,15572.2139f,15587.1104f,15602.0098f,15616.9141f,15631.8203f,15646.7314f,15661.6455f,
+    15676.5625f,15691.4844f,15706.4092f,15721.3369f,15736.2686f,15751.2041f,15766.1436f,15781.0859f,
+    15796.0312f,15810.9814f,15825.9336f,15840.8906f,15855.8506f,15870.8145f,15885.7812f,15900.752f,
+    15915.7266f,15930.7041f,15945.6855f,15960.6699f,15975.6582f,15990.6504f,16005.6455f,16020.6445f,
+    16035.6465f,16050.6523f,16065.6621f,16080.6748f,16095.6914f,16110.7109f,16125.7344f,16140.7617f,
+    16155.792f,16170.8262f,16185.8633f,16200.9043f,16215.9482f,16230.9961f,16246.0479f,16261.1025f,
+    16276.1611f,16291.2227f,16306.2881f,16321.3564f,16336.4287f,16351.5049f,16366.584f,16381.667f,
+    16396.752f,16411.8418f,16426.9355f,16442.0312f,16457.1328f,16472.2363f,16487.3418f,16502.4531f,
+    16517.5664f,16532.6836f,16547.8047f,16562.9297f,16578.0566f,16593.1875f,16608.3223f,16623.4609f,
+    16638.6016f,16653.7461f,16668.8945f,16684.0469f,16699.2031f,16714.3613f,16729.5234f,16744.6895f,
+    16759.8574f,16775.0293f,16790.207f,16805.3848f,16820.5684f,16835.7539f,16850.9434f,16866.1367f,
+    16881.334f,16896.5332f,16911.7363f,16926.9434f,16942.1523f,16957.3672f,16972.584f,16987.8047f,
+    17003.0273f,17018.2559f,17033.4863f,17048.7188f,17063.957f,17079.1973f,17094.4414f,17109.6895f,
+    17124.9395f,17140.1953f,17155.4531f,17170.7129f,17185.9785f,17201.2461f,17216.5176f,17231.793f,
+    17247.0703f,17262.3516f,17277.6367f,17292.9258f,17308.2168f,17323.5117f,17338.8105f,17354.1113f,
+    17369.416f,17384.7246f,17400.0371f,17415.3516f,17430.6719f,17445.9922f,17461.3184f,17476.6465f,
+    17491.9785f,17507.3145f,17522.6543f,17537.9961f,17553.3418f,17568.6895f,17584.043f,17599.3984f,
+    17614.7559f,17630.1191f,17645.4844f,17660.8535f,17676.2266f,17691.6016f,17706.9805f,17722.3633f,
+    17737.748f,17753.1367f,17768.5293f,17783.9258f,17799.3242f,17814.7266f,17830.1328f,17845.541f,
+    17860.9531f,17876.3691f,17891.7891f,17907.2109f,17922.6367f,17938.0645f,17953.498f,17968.9336f,
+    17984.3711f,17999.8145f,18015.2598f,18030.709f,18046.1602f,18061.6152f,18077.0742f,18092.5371f,
+    18108.002f,18123.4707f,18138.9434f,18154.418f,18169.8965f,18185.3789f,18200.8633f,18216.3516f,
+    18231.8438f,18247.3379f,18262.8379f,18278.3379f,18293.8438f,18309.3516f,18324.8633f,18340.3789f,
+    18355.8965f,18371.418f,18386.9414f,18402.4707f,18418.002f,18433.5352f,18449.0723f,18464.6133f,
+    18480.1582f,18495.7051f,18511.2559f,18526.8105f,18542.3672f,18557.9277f,18573.4922f,18589.0586f,
+    18604.6289f,18620.2031f,18635.7812f,18651.3613f,18666.9434f,18682.5312f,18698.1211f,18713.7129f,
+    18729.3105f,18744.9102f,18760.5117f,18776.1191f,18791.7285f,18807.3398f,18822.957f,18838.5762f,
+    18854.1973f,18869.8242f,18885.4531f,18901.084f,18916.7188f,18932.3574f,18948.0f,18963.6445f,
+    18979.293f,18994.9434f,19010.5996f,19026.2559f,19041.918f,19057.582f,19073.25f,19088.9199f,
+    19104.5938f,19120.2715f,19135.9512f,19151.6348f,19167.3223f,19183.0117f,19198.7051f,19214.4023f,
+    19230.1016f,19245.8047f,19261.5098f,19277.2207f,19292.9316f,19308.6484f,19324.3672f,19340.0879f,
+    19355.8145f,19371.543f,19387.2734f,19403.0098f,19418.7461f,19434.4883f,19450.2324f,19465.9805f,
+    19481.7305f,19497.4844f,19513.2422f,19529.002f,19544.7656f,19560.5332f,19576.3027f,19592.0762f,
+    19607.8516f,19623.6309f,19639.4141f,19655.1992f,19670.9883f,19686.7793f,19702.5762f,19718.373f,
+#endif
+#if MINIMP3_POW43_TABLE_SIZE > 1665
+    19734.1758f,19749.9805f,19765.7871f,19781.5996f,19797.4141f,19813.2305f,19829.0508f,19844.875f,
+    19860.7012f,19876.5312f,19892.3652f,19908.2012f,19924.041f,19939.8828f,19955.7285f,19971.5781f,
+    19987.4297f,20003.2852f,20019.1426f,20035.0039f,20050.8691f,20066.7363f,20082.6074f,20098.4824f,
+    20114.3594f,20130.2402f,20146.123f,20162.0098f,20177.8984f,20193.791f,20209.6875f,20225.5859f,
+    20241.4883f,20257.3945f,20273.3027f,20289.2148f,20305.1289f,20321.0469f,20336.9668f,20352.8926f,
+    20368.8184f,20384.75f,20400.6816f,20416.6191f,20432.5586f,20448.502f,20464.4473f,20480.3965f,
+    20496.3477f,20512.3027f,20528.2617f,20544.2227f,20560.1875f,20576.1543f,20592.125f,20608.0996f,
+    20624.0762f,20640.0547f,20656.0391f,20672.0254f,20688.0137f,20704.0059f,20720.002f,20736.0f,
+    20752.002f,20768.0059f,20784.0137f,20800.0254f,20816.0391f,20832.0547f,20848.0762f,20864.0996f,
+    20880.125f,20896.1543f,20912.1855f,20928.2227f,20944.2598f,20960.3027f,20976.3457f,20992.3945f,
+    21008.4453f,21024.498f,21040.5566f,21056.6152f,21072.6797f,21088.7441f,21104.8145f,21120.8867f,
+    21136.9609f,21153.0391f,21169.1211f,21185.2051f,21201.293f,21217.3828f,21233.4766f,21249.5742f,
+    21265.6738f,21281.7754f,21297.8828f,21313.9902f,21330.1035f,21346.2168f,21362.3359f,21378.457f,
+    21394.5801f,21410.707f,21426.8379f,21442.9707f,21459.1074f,21475.2461f,21491.3887f,21507.5332f,
+    21523.6816f,21539.834f,21555.9883f,21572.1445f,21588.3066f,21604.4688f,21620.6348f,21636.8047f,
+    21652.9785f,21669.1523f,21685.332f,21701.5137f,21717.6973f,21733.8848f,21750.0762f,21766.2695f,
+    21782.4668f,21798.666f,21814.8691f,21831.0742f,21847.2832f,21863.4941f,21879.709f,21895.9277f,
+    21912.1484f,21928.3711f,21944.5977f,21960.8281f,21977.0605f,21993.2969f,22009.5352f,22025.7773f,
+    22042.0215f,22058.2695f,22074.5195f,22090.7734f,22107.0293f,22123.2891f,22139.5527f,22155.8184f,
+    22172.0859f,22188.3574f,22204.6328f,22220.9102f,22237.1914f,22253.4746f,22269.7617f,22286.0508f,
+    22302.3438f,22318.6387f,22334.9375f,22351.2383f,22367.543f,22383.8496f,22400.1602f,22416.4727f,
+    22432.7891f,22449.1094f,22465.4316f,22481.7559f,22498.084f,22514.416f,22530.75f,22547.0859f,
+    22563.4258f,22579.7695f,22596.1152f,22612.4648f,22628.8164f,22645.1699f,22661.5273f,22677.8887f,
+    22694.252f,22710.6191f,22726.9883f,22743.3613f,22759.7363f,22776.1152f,22792.4961f,22808.8809f,
+    22825.2676f,22841.6582f,22858.0508f,22874.4473f,22890.8457f,22907.248f,22923.6523f,22940.0605f,
+    22956.4707f,22972.8848f,22989.3008f,23005.7207f,23022.1426f,23038.5684f,23054.9961f,23071.4277f,
+    23087.8613f,23104.2988f,23120.7383f,23137.1816f,23153.627f,23170.0762f,23186.5273f,23202.9824f,
+    23219.4395f,23235.9004f,23252.3633f,23268.8301f,23285.2988f,23301.7695f,23318.2461f,23334.7227f,
+    23351.2031f,23367.6875f,23384.1738f,23400.6641f,23417.1562f,23433.6523f,23450.1504f,23466.6504f,
+    23483.1543f,23499.6621f,23516.1719f,23532.6836f,23549.1992f,23565.7188f,23582.2402f,23598.7637f,
+    23615.291f,23631.8223f,23648.3535f,23664.8906f,23681.4297f,23697.9707f,23714.5156f,23731.0625f,
+    23747.6133f,23764.166f,23780.7227f,23797.2812f,23813.8438f,23830.4082f,23846.9746f,23863.5449f,
+    23880.1191f,23896.6953f,23913.2734f,23929.8555f,23946.4414f,23963.0293f,23979.6191f,23996.2129f,
+    24012.8086f,24029.4082f,24046.0098f,24062.6152f,24079.2227f,24095.834f,24112.4473f,24129.0645f,
+    24145.6836f,24162.3047f,24178.9297f,24195.5586f,24212.1895f,24228.8223f,24245.459f,24262.0977f,
+    24278.7402f,24295.3848f,24312.0332f,24328.6836f,24345.3359f,24361.9922f,24378.6523f,24395.3145f,
+    24411.9785f,24428.6465f,24445.3184f,24461.9902f,24478.668f,24495.3457f,24512.0273f,24528.7129f,
+    24545.4004f,24562.0918f,24578.7852f,24595.4805f,24612.1797f,24628.8809f,24645.5859f,24662.293f,
+    24679.0039f,24695.7168f,24712.4336f,24729.1523f,24745.873f,24762.5977f,24779.3242f,24796.0547f,
+    24812.7871f,24829.5234f,24846.2617f,24863.0039f,24879.748f,24896.4941f,24913.2441f,24929.9961f,
+    24946.752f,24963.5098f,24980.2715f,24997.0352f,25013.8027f,25030.5723f,25047.3438f,25064.1191f,
+    25080.8965f,25097.6777f,25114.4609f,25131.248f,25148.0371f,25164.8281f,25181.623f,25198.4219f,
+    25215.2207f,25232.0254f,25248.8301f,25265.6387f,25282.4512f,25299.2656f,25316.082f,25332.9023f,
+    25349.7246f,25366.5508f,25383.3789f,25400.209f,25417.043f,25433.8809f,25450.7188f,25467.5625f,
+    25484.4062f,25501.2539f,25518.1055f,25534.959f,25551.8145f,25568.6738f,25585.5352f,25602.4004f,
+    25619.2676f,25636.1367f,25653.0098f,25669.8848f,25686.7637f,25703.6445f,25720.5293f,25737.416f,
+    25754.3047f,25771.1973f,25788.0918f,25804.9902f,25821.8906f,25838.7949f,25855.6992f,25872.6094f,
+    25889.5195f,25906.4355f,25923.3516f,25940.2715f,25957.1953f,25974.1191f,25991.0488f,26007.9785f,
+    26024.9121f,26041.8496f,26058.7871f,26075.7305f,26092.6738f,26109.623f,26126.5723f,26143.5254f,
+    26160.4805f,26177.4395f,26194.4004f,26211.3652f,26228.3301f,26245.3008f,26262.2734f,26279.248f,
+    26296.2246f,26313.2051f,26330.1895f,26347.1738f,26364.1621f,26381.1543f,26398.1484f,26415.1445f,
+    26432.1445f,26449.1465f,26466.1523f,26483.1602f,26500.1699f,26517.1836f,26534.1992f,26551.2188f,
+    26568.2402f,26585.2637f,26602.291f,26619.3203f,26636.3516f,26653.3867f,26670.4238f,26687.4648f,
+    26704.5078f,26721.5547f,26738.6035f,26755.6543f,26772.709f,26789.7656f,26806.8242f,26823.8867f,
+    26840.9512f,26858.0195f,26875.0898f,26892.1621f,26909.2383f,26926.3164f,26943.3984f,26960.4824f,
+    26977.5684f,26994.6582f,27011.75f,27028.8438f,27045.9414f,27063.041f,27080.1445f,27097.25f,
+    27114.3574f,27131.4688f,27148.582f,27165.6992f,27182.8184f,27199.9395f,27217.0645f,27234.1914f,
+    27251.3203f,27268.4531f,27285.5879f,27302.7266f,27319.8672f,27337.0098f,27354.1562f,27371.3047f,
+    27388.4551f,27405.6094f,27422.7656f,27439.9258f,27457.0879f,27474.252f,27491.4199f,27508.5898f,
+    27525.7637f,27542.9375f,27560.1172f,27577.2969f,27594.4805f,27611.666f,27628.8555f,27646.0469f,
+    27663.2402f,27680.4375f,27697.6367f,27714.8398f,27732.0449f,27749.252f,27766.4629f,27783.6758f,
+    27800.8906f,27818.1094f,27835.3301f,27852.5527f,27869.7793f,27887.0078f,27904.2402f,27921.4727f,
+    27938.7109f,27955.9492f,27973.1914f,27990.4375f,28007.6836f,28024.9336f,28042.1875f,28059.4434f,
+    28076.7012f,28093.9609f,28111.2246f,28128.4902f,28145.7598f,28163.0312f,28180.3047f,28197.582f,
+#endif
+#if MINIMP3_POW43_TABLE_SIZE > 2177
+    28214.8613f,28232.1426f,28249.4277f,28266.7148f,28284.0039f,28301.2969f,28318.5918f,28335.8887f,
+    28353.1895f,28370.4922f,28387.7988f,28405.1074f,28422.418f,28439.7305f,28457.0469f,28474.3672f,
+    28491.6875f,28509.0117f,28526.3379f,28543.668f,28561.0f,28578.334f,28595.6719f,28613.0117f,
+    28630.3535f,28647.6992f,28665.0469f,28682.3984f,28699.75f,28717.1055f,28734.4648f,28751.8262f,
+    28769.1895f,28786.5547f,28803.9238f,28821.2949f,28838.6699f,28856.0469f,28873.4258f,28890.8066f,
+    28908.1914f,28925.5781f,28942.9688f,28960.3613f,28977.7559f,28995.1523f,29012.5527f,29029.9551f,
+    29047.3613f,29064.7695f,29082.1797f,29099.5938f,29117.0098f,29134.4277f,29151.8477f,29169.2715f,
+    29186.6973f,29204.127f,29221.5586f,29238.9922f,29256.4297f,29273.8672f,29291.3105f,29308.7539f,
+    29326.2012f,29343.6504f,29361.1035f,29378.5586f,29396.0156f,29413.4746f,29430.9375f,29448.4023f,
+    29465.8711f,29483.3398f,29500.8145f,29518.2891f,29535.7676f,29553.248f,29570.7305f,29588.2168f,
+    29605.7051f,29623.1973f,29640.6895f,29658.1855f,29675.6855f,29693.1855f,29710.6895f,29728.1973f,
+    29745.7051f,29763.2168f,29780.7305f,29798.248f,29815.7676f,29833.2891f,29850.8145f,29868.3418f,
+    29885.8711f,29903.4023f,29920.9375f,29938.4746f,29956.0156f,29973.5566f,29991.1035f,30008.6504f,
+    30026.2012f,30043.7539f,30061.3086f,30078.8672f,30096.4277f,30113.9902f,30131.5547f,30149.123f,
+    30166.6953f,30184.2676f,30201.8438f,30219.4219f,30237.002f,30254.5859f,30272.1719f,30289.7617f,
+    30307.3516f,30324.9453f,30342.543f,30360.1406f,30377.7422f,30395.3457f,30412.9531f,30430.5625f,
+    30448.1738f,30465.7871f,30483.4043f,30501.0234f,30518.6445f,30536.2695f,30553.8965f,30571.5254f,
+    30589.1562f,30606.791f,30624.4277f,30642.0684f,30659.7109f,30677.3555f,30695.002f,30712.6523f,
+    30730.3047f,30747.959f,30765.6152f,30783.2754f,30800.9375f,30818.6035f,30836.2695f,30853.9395f,
+    30871.6133f,30889.2871f,30906.9648f,30924.6445f,30942.3281f,30960.0137f,30977.7012f,30995.3906f,
+    31013.084f,31030.7793f,31048.4766f,31066.1777f,31083.8789f,31101.584f,31119.293f,31137.0039f,
+    31154.7168f,31172.4316f,31190.1484f,31207.8691f,31225.5918f,31243.3184f,31261.0469f,31278.7773f,
+    31296.5098f,31314.2441f,31331.9824f,31349.7227f,31367.4668f,31385.2129f,31402.9609f,31420.7109f,
+    31438.4629f,31456.2188f,31473.9766f,31491.7383f,31509.502f,31527.2676f,31545.0352f,31562.8047f,
+    31580.5781f,31598.3535f,31616.1328f,31633.9121f,31651.6953f,31669.4824f,31687.2695f,31705.0605f,
+    31722.8535f,31740.6484f,31758.4473f,31776.248f,31794.0508f,31811.8555f,31829.6641f,31847.4746f,
+    31865.2871f,31883.1035f,31900.9219f,31918.7422f,31936.5645f,31954.3906f,31972.2188f,31990.0488f,
+    32007.8809f,32025.7168f,32043.5547f,32061.3945f,32079.2383f,32097.084f,32114.9316f,32132.7812f,
+    32150.6348f,32168.4902f,32186.3477f,32204.207f,32222.0703f,32239.9355f,32257.8027f,32275.6738f,
+    32293.5449f,32311.4219f,32329.2988f,32347.1777f,32365.0605f,32382.9453f,32400.834f,32418.7227f,
+    32436.6152f,32454.5098f,32472.4082f,32490.3066f,32508.209f,32526.1152f,32544.0215f,32561.9316f,
+    32579.8438f,32597.7578f,32615.6758f,32633.5938f,32651.5156f,32669.4414f,32687.3672f,32705.2969f,
+    32723.2285f,32741.1621f,32759.0996f,32777.0391f,32794.9805f,32812.9258f,32830.8711f,32848.8203f,
+    32866.7695f,32884.7266f,32902.6797f,32920.6406f,32938.6016f,32956.5664f,32974.5312f,32992.5f,
+    33010.4688f,33028.4453f,33046.418f,33064.3984f,33082.3789f,33100.3633f,33118.3477f,33136.3359f,
+    33154.3281f,33172.3203f,33190.3164f,33208.3125f,33226.3125f,33244.3164f,33262.3203f,33280.3281f,
+    33298.3398f,33316.3516f,33334.3672f,33352.3828f,33370.4023f,33388.4258f,33406.4492f,33424.4766f,
+    33442.5078f,33460.5391f,33478.5742f,33496.6094f,33514.6484f,33532.6914f,33550.7344f,33568.7812f,
+    33586.832f,33604.8828f,33622.9336f,33640.9922f,33659.0508f,33677.1094f,33695.1758f,33713.2422f,
+    33731.3086f,33749.3789f,33767.4531f,33785.5273f,33803.6055f,33821.6875f,33839.7695f,33857.8555f,
+    33875.9414f,33894.0312f,33912.125f,33930.2188f,33948.3164f,33966.418f,33984.5195f,34002.625f,
+    34020.7305f,34038.8398f,34056.9531f,34075.0664f,34093.1836f,34111.3008f,34129.4219f,34147.5469f,
+    34165.6719f,34183.8008f,34201.9336f,34220.0664f,34238.2031f,34256.3398f,34274.4805f,34292.625f,
+    34310.7695f,34328.918f,34347.0664f,34365.2188f,34383.375f,34401.5312f,34419.6914f,34437.8555f,
+    34456.0195f,34474.1875f,34492.3555f,34510.5273f,34528.7031f,34546.8789f,34565.0586f,34583.2383f,
+    34601.4219f,34619.6094f,34637.7969f,34655.9883f,34674.1836f,34692.3789f,34710.5742f,34728.7773f,
+    34746.9805f,34765.1836f,34783.3906f,34801.6016f,34819.8125f,34838.0273f,34856.2461f,34874.4648f,
+    34892.6875f,34910.9102f,34929.1367f,34947.3672f,34965.5977f,34983.832f,35002.0703f,35020.3086f,
+    35038.5469f,35056.793f,35075.0391f,35093.2852f,35111.5352f,35129.7891f,35148.043f,35166.3008f,
+    35184.5625f,35202.8242f,35221.0898f,35239.3555f,35257.625f,35275.8945f,35294.1719f,35312.4453f,
+    35330.7266f,35349.0078f,35367.2891f,35385.5781f,35403.8633f,35422.1562f,35440.4492f,35458.7422f,
+    35477.043f,35495.3398f,35513.6445f,35531.9492f,35550.2578f,35568.5664f,35586.8789f,35605.1914f,
+    35623.5078f,35641.8281f,35660.1484f,35678.4727f,35696.7969f,35715.125f,35733.457f,35751.7891f,
+    35770.125f,35788.4648f,35806.8047f,35825.1445f,35843.4922f,35861.8398f,35880.1875f,35898.5391f,
+    35916.8945f,35935.25f,35953.6094f,35971.9688f,35990.3359f,36008.6992f,36027.0703f,36045.4375f,
+    36063.8125f,36082.1875f,36100.5664f,36118.9453f,36137.3281f,36155.7109f,36174.0977f,36192.4883f,
+    36210.8789f,36229.2734f,36247.6719f,36266.0703f,36284.4688f,36302.875f,36321.2773f,36339.6875f,
+    36358.0977f,36376.5117f,36394.9258f,36413.3438f,36431.7617f,36450.1836f,36468.6094f,36487.0352f,
+    36505.4648f,36523.8945f,36542.3281f,36560.7656f,36579.2031f,36597.6445f,36616.0859f,36634.5312f,
+    36652.9805f,36671.4297f,36689.8828f,36708.3359f,36726.793f,36745.25f,36763.7148f,36782.1758f,
+    36800.6445f,36819.1133f,36837.582f,36856.0547f,36874.5312f,36893.0078f,36911.4883f,36929.9688f,
+    36948.457f,36966.9414f,36985.4297f,37003.9219f,37022.418f,37040.9141f,37059.4102f,37077.9141f,
+    37096.4141f,37114.9219f,37133.4297f,37151.9375f,37170.4492f,37188.9648f,37207.4805f,37226.0f,
+    37244.5234f,37263.0469f,37281.5742f,37300.1016f,37318.6328f,37337.1641f,37355.6992f,37374.2383f,
+#endif
+#if MINIMP3_POW43_TABLE_SIZE > 2689
+    37392.7773f,37411.3203f,37429.8672f,37448.4102f,37466.9609f,37485.5117f,37504.0664f,37522.6211f,
+    37541.1797f,37559.7422f,37578.3047f,37596.8711f,37615.4375f,37634.0078f,37652.5781f,37671.1523f,
+    37689.7305f,37708.3086f,37726.8906f,37745.4727f,37764.0586f,37782.6484f,37801.2383f,37819.832f,
+    37838.4258f,37857.0234f,37875.6211f,37894.2227f,37912.8281f,37931.4336f,37950.043f,37968.6562f,
+    37987.2656f,38005.8828f,38024.5f,38043.1211f,38061.7422f,38080.3672f,38098.9961f,38117.625f,
+    38136.2539f,38154.8906f,38173.5234f,38192.1641f,38210.8047f,38229.4453f,38248.0938f,38266.7383f,
+    38285.3906f,38304.0391f,38322.6953f,38341.3516f,38360.0117f,38378.6719f,38397.3359f,38416.0f,
+    38434.668f,38453.3359f,38472.0117f,38490.6836f,38509.3633f,38528.0391f,38546.7227f,38565.4062f,
+    38584.0898f,38602.7812f,38621.4688f,38640.1641f,38658.8594f,38677.5547f,38696.2539f,38714.957f,
+    38733.6602f,38752.3672f,38771.0742f,38789.7852f,38808.5f,38827.2148f,38845.9336f,38864.6523f,
+    38883.375f,38902.0977f,38920.8242f,38939.5547f,38958.2852f,38977.0195f,38995.7539f,39014.4922f,
+    39033.2305f,39051.9727f,39070.7188f,39089.4648f,39108.2148f,39126.9648f,39145.7188f,39164.4766f,
+    39183.2344f,39201.9922f,39220.7539f,39239.5195f,39258.2891f,39277.0586f,39295.8281f,39314.6016f,
+    39333.3789f,39352.1562f,39370.9375f,39389.7188f,39408.5039f,39427.293f,39446.082f,39464.8711f,
+    39483.668f,39502.4648f,39521.2617f,39540.0625f,39558.8633f,39577.6719f,39596.4766f,39615.2852f,
+    39634.0977f,39652.9141f,39671.7305f,39690.5469f,39709.3672f,39728.1914f,39747.0156f,39765.8438f,
+    39784.6719f,39803.5039f,39822.3398f,39841.1758f,39860.0156f,39878.8555f,39897.6992f,39916.543f,
+    39935.3906f,39954.2422f,39973.0938f,39991.9453f,40010.8008f,40029.6602f,40048.5234f,40067.3867f,
+    40086.25f,40105.1172f,40123.9883f,40142.8594f,40161.7344f,40180.6094f,40199.4883f,40218.3672f,
+    40237.25f,40256.1367f,40275.0234f,40293.9141f,40312.8047f,40331.6992f,40350.5977f,40369.4961f,
+    40388.3945f,40407.2969f,40426.2031f,40445.1094f,40464.0195f,40482.9336f,40501.8477f,40520.7617f,
+    40539.6797f,40558.6016f,40577.5234f,40596.4492f,40615.375f,40634.3047f,40653.2383f,40672.1719f,
+    40691.1055f,40710.043f,40728.9844f,40747.9297f,40766.8711f,40785.8203f,40804.7695f,40823.7188f,
+    40842.6758f,40861.6289f,40880.5859f,40899.5469f,40918.5117f,40937.4766f,40956.4414f,40975.4102f,
+    40994.3828f,41013.3555f,41032.332f,41051.3086f,41070.2891f,41089.2695f,41108.2539f,41127.2422f,
+    41146.2305f,41165.2227f,41184.2148f,41203.2109f,41222.207f,41241.207f,41260.2109f,41279.2148f,
+    41298.2188f,41317.2266f,41336.2383f,41355.25f,41374.2656f,41393.2852f,41412.3047f,41431.3242f,
+    41450.3477f,41469.375f,41488.4023f,41507.4336f,41526.4648f,41545.5f,41564.5352f,41583.5742f,
+    41602.6172f,41621.6602f,41640.707f,41659.7539f,41678.8047f,41697.8555f,41716.9102f,41735.9648f,
+    41755.0234f,41774.0859f,41793.1484f,41812.2148f,41831.2812f,41850.3516f,41869.4219f,41888.4961f,
+    41907.5703f,41926.6484f,41945.7305f,41964.8125f,41983.8984f,42002.9844f,42022.0742f,42041.1641f,
+    42060.2578f,42079.3516f,42098.4492f,42117.5508f,42136.6523f,42155.7578f,42174.8633f,42193.9727f,
+    42213.082f,42232.1953f,42251.3086f,42270.4258f,42289.5469f,42308.668f,42327.793f,42346.918f,
+    42366.0469f,42385.1758f,42404.3086f,42423.4414f,42442.5781f,42461.7188f,42480.8594f,42500.0f,
+    42519.1484f,42538.293f,42557.4453f,42576.5938f,42595.75f,42614.9062f,42634.0625f,42653.2227f,
+    42672.3867f,42691.5508f,42710.7188f,42729.8867f,42749.0586f,42768.2305f,42787.4062f,42806.582f,
+    42825.7617f,42844.9453f,42864.1289f,42883.3164f,42902.5039f,42921.6953f,42940.8867f,42960.082f,
+    42979.2773f,42998.4766f,43017.6797f,43036.8828f,43056.0859f,43075.293f,43094.5039f,43113.7148f,
+    43132.9297f,43152.1445f,43171.3633f,43190.5859f,43209.8086f,43229.0312f,43248.2578f,43267.4883f,
+    43286.7188f,43305.9531f,43325.1875f,43344.4258f,43363.6641f,43382.9062f,43402.1484f,43421.3945f,
+    43440.6445f,43459.8945f,43479.1445f,43498.4023f,43517.6562f,43536.918f,43556.1758f,43575.4414f,
+    43594.707f,43613.9727f,43633.2422f,43652.5156f,43671.7891f,43691.0625f,43710.3398f,43729.6211f,
+    43748.9023f,43768.1875f,43787.4727f,43806.7617f,43826.0547f,43845.3477f,43864.6406f,43883.9375f,
+    43903.2383f,43922.5391f,43941.8438f,43961.1484f,43980.457f,43999.7656f,44019.0781f,44038.3906f,
+    44057.707f,44077.0273f,44096.3477f,44115.668f,44134.9922f,44154.3203f,44173.6484f,44192.9805f,
+    44212.3125f,44231.6484f,44250.9844f,44270.3242f,44289.668f,44309.0078f,44328.3555f,44347.7031f,
+    44367.0547f,44386.4062f,44405.7578f,44425.1172f,44444.4727f,44463.8359f,44483.1992f,44502.5625f,
+    44521.9297f,44541.2969f,44560.668f,44580.043f,44599.418f,44618.793f,44638.1758f,44657.5547f,
+    44676.9375f,44696.3242f,44715.7148f,44735.1016f,44754.4961f,44773.8906f,44793.2852f,44812.6836f,
+    44832.0859f,44851.4883f,44870.8906f,44890.2969f,44909.707f,44929.1172f,44948.5312f,44967.9453f,
+    44987.3633f,45006.7812f,45026.2031f,45045.6289f,45065.0547f,45084.4805f,45103.9102f,45123.3438f,
+    45142.7773f,45162.2148f,45181.6523f,45201.0938f,45220.5352f,45239.9805f,45259.4258f,45278.875f,
+    45298.3242f,45317.7773f,45337.2305f,45356.6875f,45376.1484f,45395.6094f,45415.0742f,45434.5391f,
+    45454.0039f,45473.4766f,45492.9453f,45512.4219f,45531.8945f,45551.375f,45570.8555f,45590.3359f,
+    45609.8203f,45629.3047f,45648.793f,45668.2852f,45687.7773f,45707.2734f,45726.7695f,45746.2656f,
+    45765.7695f,45785.2695f,45804.7734f,45824.2812f,45843.793f,45863.3008f,45882.8164f,45902.332f,
+    45921.8477f,45941.3672f,45960.8906f,45980.4141f,45999.9375f,46019.4648f,46038.9961f,46058.5273f,
+    46078.0625f,46097.5977f,46117.1367f,46136.6758f,46156.2188f,46175.7617f,46195.3086f,46214.8555f,
+    46234.4062f,46253.9609f,46273.5156f,46293.0703f,46312.6289f,46332.1914f,46351.7539f,46371.3203f,
+    46390.8867f,46410.4531f,46430.0273f,46449.5977f,46469.1758f,46488.75f,46508.332f,46527.9102f,
+    46547.4961f,46567.082f,46586.668f,46606.2578f,46625.8516f,46645.4453f,46665.0391f,46684.6367f,
+    46704.2383f,46723.8398f,46743.4453f,46763.0508f,46782.6562f,46802.2695f,46821.8789f,46841.4961f,
+    46861.1094f,46880.7305f,46900.3516f,46919.9727f,46939.5977f,46959.2227f,46978.8516f,46998.4844f,
+    47018.1172f,47037.75f,47057.3867f,47077.0273f,47096.668f,47116.3125f,47135.957f,47155.6016f,
+#endif
+#if MINIMP3_POW43_TABLE_SIZE > 3201
+    47175.2539f,47194.9023f,47214.5586f,47234.2109f,47253.8711f,47273.5273f,47293.1914f,47312.8555f,
+    47332.5195f,47352.1875f,47371.8555f,47391.5273f,47411.2031f,47430.8789f,47450.5547f,47470.2344f,
+    47489.918f,47509.6016f,47529.2891f,47548.9766f,47568.6641f,47588.3555f,47608.0508f,47627.7461f,
+    47647.4453f,47667.1445f,47686.8477f,47706.5508f,47726.2578f,47745.9688f,47765.6758f,47785.3906f,
+    47805.1055f,47824.8203f,47844.5391f,47864.2617f,47883.9844f,47903.707f,47923.4336f,47943.1641f,
+    47962.8945f,47982.625f,48002.3594f,48022.0977f,48041.8359f,48061.5781f,48081.3203f,48101.0664f,
+    48120.8125f,48140.5625f,48160.3125f,48180.0664f,48199.8203f,48219.5781f,48239.3359f,48259.0977f,
+    48278.8594f,48298.625f,48318.3945f,48338.1602f,48357.9336f,48377.707f,48397.4805f,48417.2578f,
+    48437.0391f,48456.8203f,48476.6016f,48496.3867f,48516.1758f,48535.9648f,48555.7578f,48575.5508f,
+    48595.3438f,48615.1445f,48634.9414f,48654.7422f,48674.5469f,48694.3516f,48714.1602f,48733.9688f,
+    48753.7812f,48773.5938f,48793.4102f,48813.2266f,48833.0469f,48852.8711f,48872.6914f,48892.5195f,
+    48912.3477f,48932.1758f,48952.0078f,48971.8398f,48991.6758f,49011.5156f,49031.3555f,49051.1953f,
+    49071.0391f,49090.8867f,49110.7344f,49130.582f,49150.4336f,49170.2891f,49190.1445f,49210.0039f,
+    49229.8633f,49249.7227f,49269.5859f,49289.4531f,49309.3203f,49329.1914f,49349.0625f,49368.9375f,
+    49388.8125f,49408.6914f,49428.5703f,49448.4531f,49468.3359f,49488.2227f,49508.1094f,49528.0f,
+    49547.8906f,49567.7852f,49587.6797f,49607.5781f,49627.4766f,49647.3789f,49667.2812f,49687.1875f,
+    49707.0977f,49727.0078f,49746.918f,49766.832f,49786.7461f,49806.6641f,49826.5859f,49846.5078f,
+    49866.4297f,49886.3555f,49906.2812f,49926.2109f,49946.1445f,49966.0781f,49986.0117f,50005.9492f,
+    50025.8906f,50045.832f,50065.7773f,50085.7227f,50105.668f,50125.6172f,50145.5703f,50165.5234f,
+    50185.4805f,50205.4375f,50225.3945f,50245.3555f,50265.3203f,50285.2852f,50305.2539f,50325.2227f,
+    50345.1953f,50365.168f,50385.1406f,50405.1211f,50425.0977f,50445.0781f,50465.0625f,50485.0469f,
+    50505.0352f,50525.0234f,50545.0156f,50565.0078f,50585.0039f,50605.0f,50625.0f,50645.0f,
+    50665.0039f,50685.0078f,50705.0156f,50725.0234f,50745.0352f,50765.0469f,50785.0625f,50805.0781f,
+    50825.0977f,50845.1211f,50865.1406f,50885.168f,50905.1953f,50925.2227f,50945.2539f,50965.2852f,
+    50985.3203f,51005.3555f,51025.3945f,51045.4336f,51065.4766f,51085.5234f,51105.5664f,51125.6172f,
+    51145.668f,51165.7188f,51185.7734f,51205.8281f,51225.8867f,51245.9453f,51266.0078f,51286.0742f,
+    51306.1406f,51326.207f,51346.2773f,51366.3477f,51386.4219f,51406.5f,51426.5742f,51446.6562f,
+    51466.7383f,51486.8203f,51506.9062f,51526.9922f,51547.082f,51567.1758f,51587.2695f,51607.3633f,
+    51627.4609f,51647.5586f,51667.6602f,51687.7656f,51707.8711f,51727.9766f,51748.0859f,51768.1953f,
+    51788.3086f,51808.4258f,51828.543f,51848.6602f,51868.7812f,51888.9023f,51909.0273f,51929.1562f,
+    51949.2852f,51969.4141f,51989.5469f,52009.6797f,52029.8164f,52049.957f,52070.0977f,52090.2383f,
+    52110.3828f,52130.5273f,52150.6758f,52170.8281f,52190.9766f,52211.1328f,52231.2891f,52251.4453f,
+    52271.6055f,52291.7656f,52311.9297f,52332.0977f,52352.2656f,52372.4336f,52392.6055f,52412.7773f,
+    52432.9531f,52453.1289f,52473.3086f,52493.4922f,52513.6719f,52533.8594f,52554.0469f,52574.2344f,
+    52594.4258f,52614.6172f,52634.8125f,52655.0078f,52675.207f,52695.4062f,52715.6094f,52735.8164f,
+    52756.0195f,52776.2305f,52796.4375f,52816.6523f,52836.8633f,52857.082f,52877.3008f,52897.5195f,
+    52917.7422f,52937.9648f,52958.1914f,52978.418f,52998.6484f,53018.8789f,53039.1133f,53059.3477f,
+    53079.582f,53099.8242f,53120.0625f,53140.3086f,53160.5508f,53180.7969f,53201.0469f,53221.2969f,
+    53241.5508f,53261.8047f,53282.0625f,53302.3203f,53322.582f,53342.8438f,53363.1055f,53383.3711f,
+    53403.6406f,53423.9102f,53444.1836f,53464.457f,53484.7305f,53505.0078f,53525.2891f,53545.5703f,
+    53565.8555f,53586.1406f,53606.4258f,53626.7148f,53647.0078f,53667.3008f,53687.5938f,53707.8906f,
+    53728.1914f,53748.4922f,53768.793f,53789.0977f,53809.4023f,53829.7109f,53850.0234f,53870.3359f,
+    53890.6484f,53910.9648f,53931.2812f,53951.6016f,53971.9258f,53992.2461f,54012.5742f,54032.9023f,
+    54053.2305f,54073.5625f,54093.8945f,54114.2305f,54134.5664f,54154.9062f,54175.2461f,54195.5898f,
+    54215.9336f,54236.2812f,54256.6289f,54276.9805f,54297.332f,54317.6875f,54338.043f,54358.3984f,
+    54378.7578f,54399.1211f,54419.4844f,54439.8516f,54460.2188f,54480.5859f,54500.9609f,54521.332f,
+    54541.707f,54562.0859f,54582.4648f,54602.8438f,54623.2266f,54643.6133f,54664.0f,54684.3867f,
+    54704.7773f,54725.168f,54745.5625f,54765.9609f,54786.3594f,54806.7578f,54827.1602f,54847.5625f,
+    54867.9688f,54888.375f,54908.7852f,54929.1953f,54949.6094f,54970.0234f,54990.4414f,55010.8594f,
+    55031.2812f,55051.7031f,55072.1289f,55092.5547f,55112.9844f,55133.4141f,55153.8438f,55174.2773f,
+    55194.7148f,55215.1523f,55235.5938f,55256.0352f,55276.4766f,55296.9219f,55317.3711f,55337.8203f,
+    55358.2695f,55378.7227f,55399.1758f,55419.6328f,55440.0938f,55460.5547f,55481.0156f,55501.4805f,
+    55521.9453f,55542.4141f,55562.8828f,55583.3555f,55603.8281f,55624.3047f,55644.7812f,55665.2617f,
+    55685.7422f,55706.2266f,55726.7109f,55747.1992f,55767.6875f,55788.1758f,55808.668f,55829.1641f,
+    55849.6602f,55870.1562f,55890.6562f,55911.1602f,55931.6641f,55952.168f,55972.6758f,55993.1875f,
+    56013.6953f,56034.2109f,56054.7266f,56075.2422f,56095.7617f,56116.2812f,56136.8047f,56157.3281f,
+    56177.8555f,56198.3828f,56218.9141f,56239.4453f,56259.9805f,56280.5156f,56301.0508f,56321.5898f,
+    56342.1328f,56362.6758f,56383.2188f,56403.7656f,56424.3164f,56444.8672f,56465.418f,56485.9727f,
+    56506.5312f,56527.0898f,56547.6484f,56568.2109f,56588.7734f,56609.3398f,56629.9062f,56650.4766f,
+    56671.0469f,56691.6211f,56712.1953f,56732.7734f,56753.3516f,56773.9297f,56794.5117f,56815.0977f,
+    56835.6836f,56856.2734f,56876.8633f,56897.4531f,56918.0469f,56938.6406f,56959.2383f,56979.8398f,
+    57000.4414f,57021.043f,57041.6484f,57062.2539f,57082.8633f,57103.4727f,57124.0859f,57144.6992f,
+    57165.3164f,57185.9336f,57206.5508f,57227.1758f,57247.7969f,57268.4219f,57289.0508f,57309.6797f,
+    57330.3086f,57350.9414f,57371.5742f,57392.2109f,57412.8516f,57433.4922f,57454.1328f,57474.7773f,
+#endif
+#if MINIMP3_POW43_TABLE_SIZE > 3713
+    57495.4219f,57516.0703f,57536.7188f,57557.3711f,57578.0234f,57598.6797f,57619.3359f,57639.9922f,
+    57660.6523f,57681.3164f,57701.9805f,57722.6445f,57743.3125f,57763.9844f,57784.6562f,57805.3281f,
+    57826.0039f,57846.6797f,57867.3594f,57888.0391f,57908.7227f,57929.4062f,57950.0938f,57970.7812f,
+    57991.4727f,58012.1641f,58032.8555f,58053.5547f,58074.25f,58094.9492f,58115.6523f,58136.3516f,
+    58157.0586f,58177.7656f,58198.4727f,58219.1836f,58239.8945f,58260.6094f,58281.3242f,58302.043f,
+    58322.7617f,58343.4844f,58364.207f,58384.9336f,58405.6602f,58426.3867f,58447.1172f,58467.8516f,
+    58488.5859f,58509.3203f,58530.0586f,58550.7969f,58571.5391f,58592.2812f,58613.0273f,58633.7734f,
+    58654.5234f,58675.2734f,58696.0273f,58716.7812f,58737.5391f,58758.2969f,58779.0547f,58799.8164f,
+    58820.582f,58841.3477f,58862.1133f,58882.8828f,58903.6523f,58924.4258f,58945.2031f,58965.9766f,
+    58986.7578f,59007.5352f,59028.3164f,59049.1016f,59069.8867f,59090.6758f,59111.4648f,59132.2539f,
+    59153.0469f,59173.8438f,59194.6367f,59215.4375f,59236.2383f,59257.0391f,59277.8438f,59298.6484f,
+    59319.457f,59340.2656f,59361.0781f,59381.8906f,59402.7031f,59423.5195f,59444.3398f,59465.1602f,
+    59485.9805f,59506.8047f,59527.6289f,59548.457f,59569.2891f,59590.1172f,59610.9531f,59631.7852f,
+    59652.625f,59673.4609f,59694.3008f,59715.1445f,59735.9883f,59756.832f,59777.6797f,59798.5312f,
+    59819.3828f,59840.2344f,59861.0898f,59881.9453f,59902.8047f,59923.6641f,59944.5273f,59965.3906f,
+    59986.2578f,60007.125f,60027.9922f,60048.8633f,60069.7383f,60090.6133f,60111.4883f,60132.3672f,
+    60153.2461f,60174.1289f,60195.0117f,60215.8984f,60236.7852f,60257.6758f,60278.5664f,60299.4609f,
+    60320.3555f,60341.25f,60362.1484f,60383.0508f,60403.9492f,60424.8555f,60445.7617f,60466.668f,
+    60487.5781f,60508.4883f,60529.3984f,60550.3164f,60571.2305f,60592.1484f,60613.0703f,60633.9922f,
+    60654.9141f,60675.8398f,60696.7656f,60717.6953f,60738.6289f,60759.5586f,60780.4961f,60801.4297f,
+    60822.3672f,60843.3086f,60864.25f,60885.1953f,60906.1406f,60927.0859f,60948.0352f,60968.9844f,
+    60989.9375f,61010.8906f,61031.8477f,61052.8047f,61073.7656f,61094.7266f,61115.6914f,61136.6562f,
+    61157.6211f,61178.5898f,61199.5625f,61220.5352f,61241.5078f,61262.4844f,61283.4609f,61304.4414f,
+    61325.4219f,61346.4062f,61367.3906f,61388.375f,61409.3633f,61430.3555f,61451.3477f,61472.3398f,
+    61493.3359f,61514.332f,61535.332f,61556.332f,61577.3359f,61598.3398f,61619.3477f,61640.3555f,
+    61661.3633f,61682.375f,61703.3906f,61724.4062f,61745.4219f,61766.4414f,61787.4609f,61808.4844f,
+    61829.5078f,61850.5352f,61871.5625f,61892.5898f,61913.6211f,61934.6562f,61955.6914f,61976.7266f,
+    61997.7656f,62018.8047f,62039.8477f,62060.8906f,62081.9375f,62102.9844f,62124.0352f,62145.0859f,
+    62166.1367f,62187.1914f,62208.25f,62229.3086f,62250.3672f,62271.4297f,62292.4922f,62313.5586f,
+    62334.625f,62355.6914f,62376.7617f,62397.8359f,62418.9102f,62439.9844f,62461.0625f,62482.1445f,
+    62503.2227f,62524.3086f,62545.3906f,62566.4766f,62587.5664f,62608.6562f,62629.75f,62650.8438f,
+    62671.9375f,62693.0352f,62714.1328f,62735.2344f,62756.3359f,62777.4414f,62798.5469f,62819.6562f,
+    62840.7656f,62861.875f,62882.9883f,62904.1055f,62925.2227f,62946.3398f,62967.4609f,62988.582f,
+    63009.707f,63030.832f,63051.9609f,63073.0898f,63094.2188f,63115.3516f,63136.4844f,63157.6211f,
+    63178.7617f,63199.8984f,63221.043f,63242.1836f,63263.3281f,63284.4766f,63305.625f,63326.7773f,
+    63347.9297f,63369.082f,63390.2383f,63411.3945f,63432.5547f,63453.7148f,63474.8789f,63496.043f,
+    63517.207f,63538.375f,63559.5469f,63580.7188f,63601.8906f,63623.0664f,63644.2422f,63665.4219f,
+    63686.6016f,63707.7852f,63728.9688f,63750.1523f,63771.3398f,63792.5312f,63813.7188f,63834.9141f,
+    63856.1094f,63877.3047f,63898.5f,63919.7031f,63940.9023f,63962.1055f,63983.3125f,64004.5195f,
+    64025.7266f,64046.9375f,64068.1484f,64089.3633f,64110.5781f,64131.793f,64153.0156f,64174.2344f,
+    64195.457f,64216.6797f,64237.9062f,64259.1367f,64280.3633f,64301.5977f,64322.8281f,64344.0625f,
+    64365.3008f,64386.5391f,64407.7773f,64429.0195f,64450.2656f,64471.5078f,64492.7578f,64514.0039f,
+    64535.2539f,64556.5078f,64577.7617f,64599.0195f,64620.2773f,64641.5352f,64662.7969f,64684.0586f,
+    64705.3242f,64726.5898f,64747.8594f,64769.1289f,64790.3984f,64811.6719f,64832.9453f,64854.2227f,
+    64875.5039f,64896.7812f,64918.0664f,64939.3477f,64960.6328f,64981.9219f,65003.2109f,65024.5f,
+    65045.793f,65067.0859f,65088.3828f,65109.6797f,65130.9805f,65152.2812f,65173.5859f,65194.8906f,
+    65216.1953f,65237.5039f,65258.8125f,65280.125f,65301.4375f,65322.7539f,65344.0703f,65365.3906f,
+    65386.7109f,65408.0312f,65429.3555f,65450.6797f,65472.0078f,65493.3359f,65514.668f,65536.0f,
+    65557.3359f,65578.6719f,65600.0078f,65621.3438f,65642.6875f,65664.0312f,65685.375f,65706.7188f,
+    65728.0703f,65749.4219f,65770.7734f,65792.125f,65813.4766f,65834.8359f,65856.1953f,65877.5547f,
+    65898.9141f,65920.2812f,65941.6484f,65963.0156f,65984.3828f,66005.75f,66027.125f,66048.5f,
+    66069.875f,66091.25f,66112.6328f,66134.0156f,66155.3984f,66176.7812f,66198.1641f,66219.5547f,
+    66240.9453f,66262.3359f,66283.7266f,66305.125f,66326.5156f,66347.9141f,66369.3203f,66390.7188f,
+    66412.125f,66433.5312f,66454.9375f,66476.3438f,66497.75f,66519.1641f,66540.5781f,66561.9922f,
+    66583.4141f,66604.8281f,66626.25f,66647.6719f,66669.1016f,66690.5234f,66711.9531f,66733.3828f,
+    66754.8125f,66776.2422f,66797.6797f,66819.1172f,66840.5547f,66861.9922f,66883.4375f,66904.875f,
+    66926.3203f,66947.7656f,66969.2188f,66990.6641f,67012.1172f,67033.5703f,67055.0234f,67076.4844f,
+    67097.9375f,67119.3984f,67140.8594f,67162.3281f,67183.7891f,67205.2578f,67226.7266f,67248.1953f,
+    67269.6719f,67291.1406f,67312.6172f,67334.0938f,67355.5781f,67377.0547f,67398.5391f,67420.0234f,
+    67441.5078f,67463.0f,67484.4844f,67505.9766f,67527.4688f,67548.9609f,67570.4609f,67591.9609f,
+    67613.4609f,67634.9609f,67656.4609f,67677.9688f,67699.4766f,67720.9844f,67742.4922f,67764.0f,
+    67785.5156f,67807.0312f,67828.5469f,67850.0625f,67871.5859f,67893.1094f,67914.6328f,67936.1562f,
+    67957.6875f,67979.2109f,68000.7422f,68022.2734f,68043.8047f,68065.3438f,68086.8828f,68108.4219f,
+    68129.9609f,68151.5f,68173.0469f,68194.5938f,68216.1406f,68237.6875f,68259.2422f,68280.7891f,
+#endif
+#if MINIMP3_POW43_TABLE_SIZE > 4225
+    68302.3438f,68323.8984f,68345.4609f,68367.0156f,68388.5781f,68410.1406f,68431.7031f,68453.2734f,
+    68474.8359f,68496.4062f,68517.9766f,68539.5547f,68561.125f,68582.7031f,68604.2812f,68625.8594f,
+    68647.4453f,68669.0234f,68690.6094f,68712.1953f,68733.7812f,68755.375f,68776.9688f,68798.5625f,
+    68820.1562f,68841.75f,68863.3516f,68884.9453f,68906.5469f,68928.1562f,68949.7578f,68971.3672f,
+    68992.9766f,69014.5859f,69036.1953f,69057.8125f,69079.4219f,69101.0391f,69122.6641f,69144.2812f,
+    69165.9062f,69187.5234f,69209.1484f,69230.7812f,69252.4062f,69274.0391f,69295.6719f,69317.3047f,
+    69338.9375f,69360.5781f,69382.2109f,69403.8516f,69425.5f,69447.1406f,69468.7891f,69490.4375f,
+    69512.0859f,69533.7344f,69555.3828f,69577.0391f,69598.6953f,69620.3516f,69642.0156f,69663.6719f,
+    69685.3359f,69707.0f,69728.6641f,69750.3359f,69772.0f,69793.6719f,69815.3438f,69837.0234f,
+    69858.6953f,69880.375f,69902.0547f,69923.7344f,69945.4141f,69967.1016f,69988.7891f,70010.4766f,
+    70032.1641f,70053.8516f,70075.5469f,70097.2422f,70118.9375f,70140.6328f,70162.3359f,70184.0391f,
+    70205.7422f,70227.4453f,70249.1484f,70270.8594f,70292.5625f,70314.2734f,70335.9922f,70357.7031f,
+    70379.4219f,70401.1406f,70422.8594f,70444.5781f,70466.3047f,70488.0234f,70509.75f,70531.4844f,
+    70553.2109f,70574.9453f,70596.6719f,70618.4062f,70640.1484f,70661.8828f,70683.625f,70705.3672f,
+    70727.1094f,70748.8516f,70770.6016f,70792.3438f,70814.0938f,70835.8438f,70857.6016f,70879.3516f,
+    70901.1094f,70922.8672f,70944.625f,70966.3906f,70988.1562f,71009.9141f,71031.6875f,71053.4531f,
+    71075.2188f,71096.9922f,71118.7656f,71140.5391f,71162.3203f,71184.0938f,71205.875f,71227.6562f,
+    71249.4375f,71271.2266f,71293.0078f,71314.7969f,71336.5859f,71358.375f,71380.1719f,71401.9688f,
+    71423.7656f,71445.5625f,71467.3594f,71489.1641f,71510.9609f,71532.7656f,71554.5781f,71576.3828f,
+    71598.1953f,71620.0078f,71641.8203f,71663.6328f,71685.4453f,71707.2656f,71729.0859f,71750.9062f,
+    71772.7266f,71794.5547f,71816.3828f,71838.2109f,71860.0391f,71881.8672f,71903.7031f,71925.5391f,
+    71947.375f,71969.2109f,71991.0469f,72012.8906f,72034.7344f,72056.5781f,72078.4219f,72100.2734f,
+    72122.125f,72143.9688f,72165.8281f,72187.6797f,72209.5391f,72231.3906f,72253.25f,72275.1172f,
+    72296.9766f,72318.8438f,72340.7031f,72362.5703f,72384.4453f,72406.3125f,72428.1875f,72450.0625f,
+    72471.9375f,72493.8125f,72515.6953f,72537.5703f,72559.4531f,72581.3438f,72603.2266f,72625.1172f,
+    72647.0f,72668.8906f,72690.7891f,72712.6797f,72734.5781f,72756.4688f,72778.375f,72800.2734f,
+    72822.1719f,72844.0781f,72865.9844f,72887.8906f,72909.7969f,72931.7109f,72953.625f,72975.5391f,
+    72997.4531f,73019.3672f,73041.2891f,73063.2109f,73085.1328f,73107.0547f,73128.9766f,73150.9062f,
+    73172.8359f,73194.7656f,73216.6953f,73238.6328f,73260.5625f,73282.5f,73304.4375f,73326.3828f,
+    73348.3203f,73370.2656f,73392.2109f,73414.1562f,73436.1016f,73458.0547f,73480.0078f,73501.9609f,
+    73523.9141f,73545.8672f,73567.8281f,73589.7891f,73611.75f,73633.7109f,73655.6797f,73677.6406f,
+    73699.6094f,73721.5781f,73743.5547f,73765.5234f,73787.5f,73809.4766f,73831.4531f,73853.4297f,
+    73875.4141f,73897.3984f,73919.3828f,73941.3672f,73963.3516f,73985.3438f,74007.3359f,74029.3281f,
+    74051.3203f,74073.3125f,74095.3125f,74117.3125f,74139.3125f,74161.3125f,74183.3203f,74205.3281f,
+    74227.3281f,74249.3438f,74271.3516f,74293.3594f,74315.375f,74337.3906f,74359.4062f,74381.4297f,
+    74403.4453f,74425.4688f,74447.4922f,74469.5156f,74491.5469f,74513.5703f,74535.6016f,74557.6328f,
+    74579.6641f,74601.7031f,74623.7422f,74645.7734f,74667.8203f,74689.8594f,74711.8984f,74733.9453f,
+    74755.9922f,74778.0391f,74800.0859f,74822.1406f,74844.1953f,74866.25f,74888.3047f,74910.3594f,
+    74932.4219f,74954.4844f,74976.5469f,74998.6094f,75020.6719f,75042.7422f,75064.8125f,75086.8828f,
+    75108.9531f,75131.0234f,75153.1016f,75175.1797f,75197.2578f,75219.3359f,75241.4219f,75263.5f,
+    75285.5859f,75307.6719f,75329.7656f,75351.8516f,75373.9453f,75396.0391f,75418.1328f,75440.2266f,
+    75462.3281f,75484.4297f,75506.5312f,75528.6328f,75550.7344f,75572.8438f,75594.9531f,75617.0625f,
+    75639.1719f,75661.2812f,75683.3984f,75705.5156f,75727.6328f,75749.75f,75771.875f,75793.9922f,
+    75816.1172f,75838.2422f,75860.3672f,75882.5f,75904.6328f,75926.7656f,75948.8984f,75971.0312f,
+    75993.1719f,76015.3047f,76037.4453f,76059.5859f,76081.7344f,76103.875f,76126.0234f,76148.1719f,
+    76170.3203f,76192.4688f,76214.625f,76236.7812f,76258.9375f,76281.0938f,76303.25f,76325.4141f,
+    76347.5781f,76369.7422f,76391.9062f,76414.0781f,76436.2422f,76458.4141f,76480.5859f,76502.7578f,
+    76524.9375f,76547.1172f,76569.2891f,76591.4688f,76613.6562f,76635.8359f,76658.0234f,76680.2109f,
+    76702.3984f,76724.5859f,76746.7812f,76768.9766f,76791.1641f,76813.3672f,76835.5625f,76857.7656f,
+    76879.9609f,76902.1641f,76924.3672f,76946.5781f,76968.7812f,76990.9922f,77013.2031f,77035.4141f,
+    77057.6328f,77079.8438f,77102.0625f,77124.2812f,77146.5f,77168.7266f,77190.9453f,77213.1719f,
+    77235.3984f,77257.625f,77279.8594f,77302.0938f,77324.3203f,77346.5547f,77368.7969f,77391.0312f,
+    77413.2734f,77435.5156f,77457.7578f,77480.0f,77502.25f,77524.4922f,77546.7422f,77568.9922f,
+    77591.25f,77613.5f,77635.7578f,77658.0156f,77680.2734f,77702.5312f,77724.7969f,77747.0547f,
+    77769.3203f,77791.5859f,77813.8594f,77836.125f,77858.3984f,77880.6719f,77902.9453f,77925.2266f,
+    77947.5f,77969.7812f,77992.0625f,78014.3438f,78036.625f,78058.9141f,78081.2031f,78103.4922f,
+    78125.7812f,78148.0703f,78170.3672f,78192.6641f,78214.9609f,78237.2578f,78259.5547f,78281.8594f,
+    78304.1641f,78326.4688f,78348.7734f,78371.0859f,78393.3906f,78415.7031f,78438.0156f,78460.3281f,
+    78482.6484f,78504.9688f,78527.2812f,78549.6016f,78571.9297f,78594.25f,78616.5781f,78638.9062f,
+    78661.2344f,78683.5625f,78705.8984f,78728.2266f,78750.5625f,78772.8984f,78795.2344f,78817.5781f,
+    78839.9219f,78862.2656f,78884.6094f,78906.9531f,78929.2969f,78951.6484f,78974.0f,78996.3516f,
+    79018.7109f,79041.0625f,79063.4219f,79085.7812f,79108.1406f,79130.5f,79152.8672f,79175.2266f,
+    79197.5938f,79219.9609f,79242.3359f,79264.7031f,79287.0781f,79309.4531f,79331.8281f,79354.2109f,
+    79376.5859f,79398.9688f,79421.3516f,79443.7344f,79466.1172f,79488.5078f,79510.8984f,79533.2891f,
+#endif
+#if MINIMP3_POW43_TABLE_SIZE > 4737
+    79555.6797f,79578.0703f,79600.4688f,79622.8594f,79645.2578f,79667.6641f,79690.0625f,79712.4688f,
+    79734.8672f,79757.2734f,79779.6797f,79802.0938f,79824.5f,79846.9141f,79869.3281f,79891.7422f,
+    79914.1641f,79936.5781f,79959.0f,79981.4219f,80003.8438f,80026.2734f,80048.6953f,80071.125f,
+    80093.5547f,80115.9844f,80138.4219f,80160.8516f,80183.2891f,80205.7266f,80228.1641f,80250.6094f,
+    80273.0469f,80295.4922f,80317.9375f,80340.3828f,80362.8359f,80385.2812f,80407.7344f,80430.1875f,
+    80452.6406f,80475.1016f,80497.5547f,80520.0156f,80542.4766f,80564.9453f,80587.4062f,80609.875f,
+    80632.3359f,80654.8047f,80677.2812f,80699.75f,80722.2266f,80744.6953f,80767.1719f,80789.6562f,
+    80812.1328f,80834.6172f,80857.1016f,80879.5859f,80902.0703f,80924.5547f,80947.0469f,80969.5391f,
+    80992.0312f,81014.5234f,81037.0156f,81059.5156f,81082.0156f,81104.5156f,81127.0156f,81149.5156f,
+    81172.0234f,81194.5312f,81217.0391f,81239.5469f,81262.0547f,81284.5703f,81307.0859f,81329.6016f,
+    81352.1172f,81374.6328f,81397.1562f,81419.6797f,81442.2031f,81464.7266f,81487.2578f,81509.7812f,
+    81532.3125f,81554.8438f,81577.375f,81599.9141f,81622.4453f,81644.9844f,81667.5234f,81690.0625f,
+    81712.6094f,81735.1484f,81757.6953f,81780.2422f,81802.7891f,81825.3438f,81847.8906f,81870.4453f,
+    81893.0f,81915.5547f,81938.1094f,81960.6719f,81983.2344f,82005.7969f,82028.3594f,82050.9219f,
+    82073.4922f,82096.0625f,82118.6328f,82141.2031f,82163.7734f,82186.3516f,82208.9297f,82231.5078f,
+    82254.0859f,82276.6641f,82299.25f,82321.8281f,82344.4141f,82367.0078f,82389.5938f,82412.1875f,
+    82434.7734f,82457.3672f,82479.9609f,82502.5625f,82525.1562f,82547.7578f,82570.3594f,82592.9609f,
+    82615.5625f,82638.1719f,82660.7812f,82683.3906f,82706.0f,82728.6094f,82751.2266f,82773.8359f,
+    82796.4531f,82819.0703f,82841.6953f,82864.3125f,82886.9375f,82909.5625f,82932.1875f,82954.8125f,
+    82977.4453f,83000.0703f,83022.7031f,83045.3359f,83067.9766f,83090.6094f,83113.25f,83135.8906f,
+    83158.5312f,83181.1719f,83203.8203f,83226.4609f,83249.1094f,83271.7578f,83294.4141f,83317.0625f,
+    83339.7188f,83362.3672f,83385.0312f,83407.6875f,83430.3438f,83453.0078f,83475.6719f,83498.3359f,
+    83521.0f,83543.6641f,83566.3359f,83589.0078f,83611.6797f,83634.3516f,83657.0312f,83679.7031f,
+    83702.3828f,83725.0625f,83747.7422f,83770.4297f,83793.1094f,83815.7969f,83838.4844f,83861.1719f,
+    83883.8672f,83906.5547f,83929.25f,83951.9453f,83974.6406f,83997.3359f,84020.0391f,84042.7422f,
+    84065.4453f,84088.1484f,84110.8516f,84133.5625f,84156.2656f,84178.9766f,84201.6875f,84224.4062f,
+    84247.1172f,84269.8359f,84292.5547f,84315.2734f,84337.9922f,84360.7188f,84383.4453f,84406.1641f,
+    84428.8984f,84451.625f,84474.3516f,84497.0859f,84519.8203f,84542.5547f,84565.2891f,84588.0312f,
+    84610.7656f,84633.5078f,84656.25f,84678.9922f,84701.7422f,84724.4844f,84747.2344f,84769.9844f,
+    84792.7422f,84815.4922f,84838.25f,84861.0f,84883.7578f,84906.5234f,84929.2812f,84952.0469f,
+    84974.8047f,84997.5703f,85020.3359f,85043.1094f,85065.875f,85088.6484f,85111.4219f,85134.1953f,
+    85156.9766f,85179.75f,85202.5312f,85225.3125f,85248.0938f,85270.875f,85293.6641f,85316.4453f,
+    85339.2344f,85362.0234f,85384.8203f,85407.6094f,85430.4062f,85453.2031f,85476.0f,85498.7969f,
+    85521.6016f,85544.3984f,85567.2031f,85590.0078f,85612.8125f,85635.625f,85658.4297f,85681.2422f,
+    85704.0547f,85726.8672f,85749.6875f,85772.5f,85795.3203f,85818.1406f,85840.9609f,85863.7891f,
+    85886.6094f,85909.4375f,85932.2656f,85955.0938f,85977.9219f,86000.7578f,86023.5938f,86046.4297f,
+    86069.2656f,86092.1016f,86114.9453f,86137.7812f,86160.625f,86183.4688f,86206.3203f,86229.1641f,
+    86252.0156f,86274.8672f,86297.7188f,86320.5703f,86343.4219f,86366.2812f,86389.1406f,86412.0f,
+    86434.8594f,86457.7188f,86480.5859f,86503.4531f,86526.3203f,86549.1875f,86572.0547f,86594.9297f,
+    86617.8047f,86640.6797f,86663.5547f,86686.4297f,86709.3125f,86732.1875f,86755.0703f,86777.9531f,
+    86800.8438f,86823.7266f,86846.6172f,86869.5078f,86892.3984f,86915.2891f,86938.1875f,86961.0781f,
+    86983.9766f,87006.875f,87029.7734f,87052.6797f,87075.5859f,87098.4844f,87121.3906f,87144.3047f,
+    87167.2109f,87190.125f,87213.0312f,87235.9453f,87258.8672f,87281.7812f,87304.6953f,87327.6172f,
+    87350.5391f,87373.4609f,87396.3906f,87419.3125f,87442.2422f,87465.1719f,87488.1016f,87511.0312f,
+    87533.9688f,87556.8984f,87579.8359f,87602.7734f,87625.7109f,87648.6562f,87671.5938f,87694.5391f,
+    87717.4844f,87740.4297f,87763.3828f,87786.3281f,87809.2812f,87832.2344f,87855.1875f,87878.1484f,
+    87901.1016f,87924.0625f,87947.0234f,87969.9844f,87992.9453f,88015.9141f,88038.8828f,88061.8516f,
+    88084.8203f,88107.7891f,88130.7578f,88153.7344f,88176.7109f,88199.6875f,88222.6641f,88245.6484f,
+    88268.625f,88291.6094f,88314.5938f,88337.5781f,88360.5703f,88383.5547f,88406.5469f,88429.5391f,
+    88452.5312f,88475.5234f,88498.5234f,88521.5234f,88544.5234f,88567.5234f,88590.5234f,88613.5234f,
+    88636.5312f,88659.5391f,88682.5469f,88705.5547f,88728.5703f,88751.5781f,88774.5938f,88797.6094f,
+    88820.625f,88843.6484f,88866.6641f,88889.6875f,88912.7109f,88935.7344f,88958.7656f,88981.7891f,
+    89004.8203f,89027.8516f,89050.8828f,89073.9141f,89096.9531f,89119.9844f,89143.0234f,89166.0625f,
+    89189.1094f,89212.1484f,89235.1953f,89258.2422f,89281.2891f,89304.3359f,89327.3828f,89350.4375f,
+    89373.4922f,89396.5391f,89419.6016f,89442.6562f,89465.7188f,89488.7734f,89511.8359f,89534.8984f,
+    89557.9688f,89581.0312f,89604.1016f,89627.1719f,89650.2422f,89673.3125f,89696.3828f,89719.4609f,
+    89742.5391f,89765.6172f,89788.6953f,89811.7734f,89834.8594f,89857.9453f,89881.0312f,89904.1172f,
+    89927.2031f,89950.2969f,89973.3906f,89996.4766f,90019.5781f,90042.6719f,90065.7656f,90088.8672f,
+    90111.9688f,90135.0703f,90158.1719f,90181.2812f,90204.3828f,90227.4922f,90250.6016f,90273.7109f,
+    90296.8281f,90319.9375f,90343.0547f,90366.1719f,90389.2891f,90412.4062f,90435.5312f,90458.6484f,
+    90481.7734f,90504.8984f,90528.0312f,90551.1562f,90574.2891f,90597.4219f,90620.5547f,90643.6875f,
+    90666.8203f,90689.9609f,90713.1016f,90736.2422f,90759.3828f,90782.5234f,90805.6719f,90828.8125f,
+    90851.9609f,90875.1094f,90898.2656f,90921.4141f,90944.5703f,90967.7266f,90990.8828f,91014.0391f,
+    91037.1953f,91060.3594f,91083.5234f,91106.6875f,91129.8516f,91153.0156f,91176.1875f,91199.3516f,
+#endif
+#if MINIMP3_POW43_TABLE_SIZE > 5249
+    91222.5234f,91245.7031f,91268.875f,91292.0469f,91315.2266f,91338.4062f,91361.5859f,91384.7656f,
+    91407.9531f,91431.1328f,91454.3203f,91477.5078f,91500.6953f,91523.8906f,91547.0781f,91570.2734f,
+    91593.4688f,91616.6641f,91639.8594f,91663.0625f,91686.2578f,91709.4609f,91732.6641f,91755.875f,
+    91779.0781f,91802.2891f,91825.5f,91848.7109f,91871.9219f,91895.1328f,91918.3516f,91941.5625f,
+    91964.7812f,91988.0078f,92011.2266f,92034.4453f,92057.6719f,92080.8984f,92104.125f,92127.3516f,
+    92150.5859f,92173.8125f,92197.0469f,92220.2812f,92243.5156f,92266.7578f,92289.9922f,92313.2344f,
+    92336.4766f,92359.7188f,92382.9609f,92406.2109f,92429.4609f,92452.7031f,92475.9609f,92499.2109f,
+    92522.4609f,92545.7188f,92568.9766f,92592.2344f,92615.4922f,92638.75f,92662.0156f,92685.2812f,
+    92708.5391f,92731.8125f,92755.0781f,92778.3438f,92801.6172f,92824.8906f,92848.1641f,92871.4375f,
+    92894.7188f,92917.9922f,92941.2734f,92964.5547f,92987.8359f,93011.125f,93034.4062f,93057.6953f,
+    93080.9844f,93104.2734f,93127.5625f,93150.8594f,93174.1484f,93197.4453f,93220.7422f,93244.0391f,
+    93267.3438f,93290.6406f,93313.9453f,93337.25f,93360.5547f,93383.8672f,93407.1719f,93430.4844f,
+    93453.7969f,93477.1094f,93500.4219f,93523.7422f,93547.0547f,93570.375f,93593.6953f,93617.0156f,
+    93640.3438f,93663.6641f,93686.9922f,93710.3203f,93733.6484f,93756.9844f,93780.3125f,93803.6484f,
+    93826.9844f,93850.3203f,93873.6562f,93896.9922f,93920.3359f,93943.6797f,93967.0234f,93990.3672f,
+    94013.7109f,94037.0625f,94060.4141f,94083.7578f,94107.1172f,94130.4688f,94153.8203f,94177.1797f,
+    94200.5391f,94223.8984f,94247.2578f,94270.6172f,94293.9844f,94317.3516f,94340.7188f,94364.0859f,
+    94387.4531f,94410.8281f,94434.1953f,94457.5703f,94480.9453f,94504.3281f,94527.7031f,94551.0859f,
+    94574.4688f,94597.8516f,94621.2344f,94644.6172f,94668.0078f,94691.3906f,94714.7812f,94738.1719f,
+    94761.5703f,94784.9609f,94808.3594f,94831.7578f,94855.1562f,94878.5547f,94901.9531f,94925.3594f,
+    94948.7656f,94972.1719f,94995.5781f,95018.9844f,95042.3906f,95065.8047f,95089.2188f,95112.6328f,
+    95136.0469f,95159.4688f,95182.8828f,95206.3047f,95229.7266f,95253.1484f,95276.5781f,95300.0f,
+    95323.4297f,95346.8594f,95370.2891f,95393.7188f,95417.1562f,95440.5859f,95464.0234f,95487.4609f,
+    95510.8984f,95534.3438f,95557.7812f,95581.2266f,95604.6719f,95628.1172f,95651.5625f,95675.0156f,
+    95698.4609f,95721.9141f,95745.3672f,95768.8203f,95792.2812f,95815.7344f,95839.1953f,95862.6562f,
+    95886.1172f,95909.5859f,95933.0469f,95956.5156f,95979.9844f,96003.4531f,96026.9219f,96050.3906f,
+    96073.8672f,96097.3438f,96120.8203f,96144.2969f,96167.7734f,96191.2578f,96214.7344f,96238.2188f,
+    96261.7031f,96285.1953f,96308.6797f,96332.1719f,96355.6562f,96379.1484f,96402.6484f,96426.1406f,
+    96449.6406f,96473.1328f,96496.6328f,96520.1328f,96543.6406f,96567.1406f,96590.6484f,96614.1484f,
+    96637.6562f,96661.1719f,96684.6797f,96708.1953f,96731.7031f,96755.2188f,96778.7344f,96802.2578f,
+    96825.7734f,96849.2969f,96872.8125f,96896.3359f,96919.8672f,96943.3906f,96966.9219f,96990.4453f,
+    97013.9766f,97037.5078f,97061.0469f,97084.5781f,97108.1172f,97131.6562f,97155.1953f,97178.7344f,
+    97202.2734f,97225.8203f,97249.3672f,97272.9062f,97296.4609f,97320.0078f,97343.5547f,97367.1094f,
+    97390.6641f,97414.2188f,97437.7734f,97461.3359f,97484.8906f,97508.4531f,97532.0156f,97555.5781f,
+    97579.1406f,97602.7109f,97626.2734f,97649.8438f,97673.4141f,97696.9844f,97720.5625f,97744.1328f,
+    97767.7109f,97791.2891f,97814.8672f,97838.4531f,97862.0312f,97885.6172f,97909.2031f,97932.7891f,
+    97956.375f,97979.9609f,98003.5547f,98027.1484f,98050.7344f,98074.3359f,98097.9297f,98121.5234f,
+    98145.125f,98168.7266f,98192.3281f,98215.9297f,98239.5391f,98263.1406f,98286.75f,98310.3594f,
+    98333.9688f,98357.5781f,98381.1953f,98404.8047f,98428.4219f,98452.0391f,98475.6562f,98499.2812f,
+    98522.8984f,98546.5234f,98570.1484f,98593.7734f,98617.3984f,98641.0312f,98664.6641f,98688.2891f,
+    98711.9219f,98735.5625f,98759.1953f,98782.8359f,98806.4688f,98830.1094f,98853.75f,98877.3984f,
+    98901.0391f,98924.6875f,98948.3359f,98971.9844f,98995.6328f,99019.2812f,99042.9375f,99066.5859f,
+    99090.2422f,99113.8984f,99137.5625f,99161.2188f,99184.8828f,99208.5469f,99232.2109f,99255.875f,
+    99279.5391f,99303.2109f,99326.875f,99350.5469f,99374.2188f,99397.8984f,99421.5703f,99445.25f,
+    99468.9297f,99492.6094f,99516.2891f,99539.9688f,99563.6562f,99587.3359f,99611.0234f,99634.7109f,
+    99658.3984f,99682.0938f,99705.7891f,99729.4766f,99753.1719f,99776.8672f,99800.5703f,99824.2656f,
+    99847.9688f,99871.6719f,99895.375f,99919.0781f,99942.7812f,99966.4922f,99990.2031f,100013.914f,
+    100037.625f,100061.336f,100085.055f,100108.766f,100132.484f,100156.203f,100179.922f,100203.648f,
+    100227.367f,100251.094f,100274.82f,100298.547f,100322.273f,100346.008f,100369.742f,100393.469f,
+    100417.203f,100440.945f,100464.68f,100488.414f,100512.156f,100535.898f,100559.641f,100583.383f,
+    100607.133f,100630.875f,100654.625f,100678.375f,100702.125f,100725.883f,100749.633f,100773.391f,
+    100797.148f,100820.906f,100844.664f,100868.422f,100892.188f,100915.953f,100939.719f,100963.484f,
+    100987.25f,101011.023f,101034.789f,101058.562f,101082.336f,101106.109f,101129.891f,101153.664f,
+    101177.445f,101201.227f,101225.008f,101248.789f,101272.578f,101296.359f,101320.148f,101343.938f,
+    101367.727f,101391.523f,101415.312f,101439.109f,101462.906f,101486.703f,101510.5f,101534.305f,
+    101558.102f,101581.906f,101605.711f,101629.516f,101653.32f,101677.133f,101700.938f,101724.75f,
+    101748.562f,101772.383f,101796.195f,101820.008f,101843.828f,101867.648f,101891.469f,101915.289f,
+    101939.117f,101962.945f,101986.766f,102010.594f,102034.422f,102058.258f,102082.086f,102105.922f,
+    102129.758f,102153.594f,102177.43f,102201.273f,102225.109f,102248.953f,102272.797f,102296.641f,
+    102320.484f,102344.336f,102368.18f,102392.031f,102415.883f,102439.734f,102463.594f,102487.445f,
+    102511.305f,102535.164f,102559.023f,102582.883f,102606.75f,102630.609f,102654.477f,102678.344f,
+    102702.211f,102726.086f,102749.953f,102773.828f,102797.703f,102821.578f,102845.453f,102869.328f,
+    102893.211f,102917.086f,102940.969f,102964.852f,102988.742f,103012.625f,103036.516f,103060.406f,
+    103084.297f,103108.188f,103132.078f,103155.977f,103179.867f,103203.766f,103227.664f,103251.562f,
+#endif
+#if MINIMP3_POW43_TABLE_SIZE > 5761
+    103275.469f,103299.367f,103323.273f,103347.18f,103371.086f,103394.992f,103418.906f,103442.812f,
+    103466.727f,103490.641f,103514.555f,103538.477f,103562.391f,103586.312f,103610.234f,103634.156f,
+    103658.078f,103682.008f,103705.93f,103729.859f,103753.789f,103777.719f,103801.648f,103825.586f,
+    103849.516f,103873.453f,103897.391f,103921.328f,103945.273f,103969.211f,103993.156f,104017.102f,
+    104041.047f,104064.992f,104088.938f,104112.891f,104136.844f,104160.797f,104184.75f,104208.703f,
+    104232.656f,104256.617f,104280.578f,104304.539f,104328.5f,104352.461f,104376.43f,104400.398f,
+    104424.359f,104448.336f,104472.305f,104496.273f,104520.25f,104544.219f,104568.195f,104592.172f,
+    104616.156f,104640.133f,104664.117f,104688.102f,104712.086f,104736.07f,104760.055f,104784.047f,
+    104808.031f,104832.023f,104856.016f,104880.008f,104904.008f,104928.0f,104952.0f,104976.0f,
+    105000.0f,105024.0f,105048.008f,105072.008f,105096.016f,105120.023f,105144.031f,105168.047f,
+    105192.055f,105216.07f,105240.086f,105264.102f,105288.117f,105312.133f,105336.156f,105360.172f,
+    105384.195f,105408.219f,105432.25f,105456.273f,105480.305f,105504.328f,105528.359f,105552.398f,
+    105576.43f,105600.461f,105624.5f,105648.539f,105672.578f,105696.617f,105720.656f,105744.703f,
+    105768.742f,105792.789f,105816.836f,105840.891f,105864.938f,105888.992f,105913.039f,105937.094f,
+    105961.148f,105985.211f,106009.266f,106033.328f,106057.383f,106081.445f,106105.516f,106129.578f,
+    106153.641f,106177.711f,106201.781f,106225.852f,106249.922f,106273.992f,106298.07f,106322.148f,
+    106346.227f,106370.305f,106394.383f,106418.461f,106442.547f,106466.633f,106490.719f,106514.805f,
+    106538.891f,106562.977f,106587.07f,106611.164f,106635.258f,106659.352f,106683.445f,106707.547f,
+    106731.648f,106755.742f,106779.844f,106803.953f,106828.055f,106852.164f,106876.266f,106900.375f,
+    106924.484f,106948.594f,106972.711f,106996.82f,107020.938f,107045.055f,107069.172f,107093.297f,
+    107117.414f,107141.539f,107165.656f,107189.781f,107213.914f,107238.039f,107262.164f,107286.297f,
+    107310.43f,107334.562f,107358.695f,107382.836f,107406.969f,107431.109f,107455.25f,107479.391f,
+    107503.531f,107527.672f,107551.82f,107575.969f,107600.117f,107624.266f,107648.414f,107672.57f,
+    107696.719f,107720.875f,107745.031f,107769.188f,107793.344f,107817.508f,107841.672f,107865.828f,
+    107889.992f,107914.164f,107938.328f,107962.5f,107986.664f,108010.836f,108035.008f,108059.18f,
+    108083.359f,108107.531f,108131.711f,108155.891f,108180.07f,108204.25f,108228.438f,108252.617f,
+    108276.805f,108300.992f,108325.18f,108349.375f,108373.562f,108397.758f,108421.953f,108446.148f,
+    108470.344f,108494.539f,108518.742f,108542.938f,108567.141f,108591.344f,108615.547f,108639.758f,
+    108663.961f,108688.172f,108712.383f,108736.594f,108760.805f,108785.023f,108809.234f,108833.453f,
+    108857.672f,108881.891f,108906.109f,108930.336f,108954.555f,108978.781f,109003.008f,109027.234f,
+    109051.461f,109075.695f,109099.93f,109124.156f,109148.391f,109172.633f,109196.867f,109221.102f,
+    109245.344f,109269.586f,109293.828f,109318.07f,109342.32f,109366.562f,109390.812f,109415.062f,
+    109439.312f,109463.562f,109487.812f,109512.07f,109536.328f,109560.586f,109584.844f,109609.102f,
+    109633.359f,109657.625f,109681.891f,109706.156f,109730.422f,109754.688f,109778.961f,109803.227f,
+    109827.5f,109851.773f,109876.047f,109900.328f,109924.602f,109948.883f,109973.164f,109997.445f,
+    110021.727f,110046.008f,110070.297f,110094.578f,110118.867f,110143.156f,110167.445f,110191.742f,
+    110216.031f,110240.328f,110264.625f,110288.922f,110313.219f,110337.523f,110361.82f,110386.125f,
+    110410.43f,110434.734f,110459.039f,110483.352f,110507.656f,110531.969f,110556.281f,110580.594f,
+    110604.906f,110629.227f,110653.547f,110677.859f,110702.18f,110726.508f,110750.828f,110775.148f,
+    110799.477f,110823.805f,110848.133f,110872.461f,110896.789f,110921.125f,110945.461f,110969.789f,
+    110994.125f,111018.469f,111042.805f,111067.148f,111091.484f,111115.828f,111140.172f,111164.516f,
+    111188.867f,111213.211f,111237.562f,111261.914f,111286.266f,111310.617f,111334.977f,111359.328f,
+    111383.688f,111408.047f,111432.406f,111456.766f,111481.133f,111505.492f,111529.859f,111554.227f,
+    111578.594f,111602.969f,111627.336f,111651.711f,111676.078f,111700.453f,111724.836f,111749.211f,
+    111773.586f,111797.969f,111822.352f,111846.734f,111871.117f,111895.5f,111919.891f,111944.273f,
+    111968.664f,111993.055f,112017.453f,112041.844f,112066.234f,112090.633f,112115.031f,112139.43f,
+    112163.828f,112188.234f,112212.633f,112237.039f,112261.445f,112285.852f,112310.258f,112334.664f,
+    112359.078f,112383.492f,112407.906f,112432.32f,112456.734f,112481.148f,112505.57f,112529.992f,
+    112554.406f,112578.836f,112603.258f,112627.68f,112652.109f,112676.539f,112700.969f,112725.398f,
+    112749.828f,112774.258f,112798.695f,112823.133f,112847.57f,112872.008f,112896.445f,112920.891f,
+    112945.328f,112969.773f,112994.219f,113018.664f,113043.109f,113067.562f,113092.016f,113116.461f,
+    113140.914f,113165.375f,113189.828f,113214.281f,113238.742f,113263.203f,113287.664f,113312.125f,
+    113336.586f,113361.055f,113385.516f,113409.984f,113434.453f,113458.93f,113483.398f,113507.867f,
+    113532.344f,113556.82f,113581.297f,113605.773f,113630.25f,113654.734f,113679.219f,113703.703f,
+    113728.188f,113752.672f,113777.156f,113801.648f,113826.133f,113850.625f,113875.117f,113899.617f,
+    113924.109f,113948.609f,113973.102f,113997.602f,114022.102f,114046.602f,114071.109f,114095.609f,
+    114120.117f,114144.625f,114169.133f,114193.641f,114218.156f,114242.664f,114267.18f,114291.695f,
+    114316.211f,114340.727f,114365.25f,114389.766f,114414.289f,114438.812f,114463.336f,114487.859f,
+    114512.391f,114536.914f,114561.445f,114585.977f,114610.508f,114635.039f,114659.578f,114684.109f,
+    114708.648f,114733.188f,114757.727f,114782.273f,114806.812f,114831.359f,114855.898f,114880.445f,
+    114904.992f,114929.547f,114954.094f,114978.648f,115003.203f,115027.758f,115052.312f,115076.867f,
+    115101.422f,115125.984f,115150.547f,115175.109f,115199.672f,115224.234f,115248.805f,115273.367f,
+    115297.938f,115322.508f,115347.078f,115371.648f,115396.227f,115420.805f,115445.375f,115469.953f,
+    115494.531f,115519.117f,115543.695f,115568.281f,115592.867f,115617.453f,115642.039f,115666.625f,
+#endif
+#if MINIMP3_POW43_TABLE_SIZE > 6273
+    115691.219f,115715.805f,115740.398f,115764.992f,115789.586f,115814.18f,115838.781f,115863.383f,
+    115887.977f,115912.578f,115937.188f,115961.789f,115986.391f,116011.0f,116035.609f,116060.219f,
+    116084.828f,116109.438f,116134.055f,116158.664f,116183.281f,116207.898f,116232.516f,116257.141f,
+    116281.758f,116306.383f,116331.008f,116355.633f,116380.258f,116404.883f,116429.516f,116454.141f,
+    116478.773f,116503.406f,116528.039f,116552.672f,116577.312f,116601.953f,116626.586f,116651.227f,
+    116675.875f,116700.516f,116725.156f,116749.805f,116774.453f,116799.102f,116823.75f,116848.398f,
+    116873.055f,116897.703f,116922.359f,116947.016f,116971.672f,116996.336f,117020.992f,117045.656f,
+    117070.32f,117094.984f,117119.648f,117144.312f,117168.977f,117193.648f,117218.32f,117242.992f,
+    117267.664f,117292.336f,117317.016f,117341.688f,117366.367f,117391.047f,117415.727f,117440.414f,
+    117465.094f,117489.781f,117514.469f,117539.156f,117563.844f,117588.531f,117613.227f,117637.914f,
+    117662.609f,117687.305f,117712.0f,117736.695f,117761.398f,117786.094f,117810.797f,117835.5f,
+    117860.203f,117884.914f,117909.617f,117934.328f,117959.031f,117983.742f,118008.461f,118033.172f,
+    118057.883f,118082.602f,118107.32f,118132.039f,118156.758f,118181.477f,118206.195f,118230.922f,
+    118255.648f,118280.375f,118305.102f,118329.828f,118354.562f,118379.289f,118404.023f,118428.758f,
+    118453.492f,118478.227f,118502.969f,118527.703f,118552.445f,118577.188f,118601.93f,118626.672f,
+    118651.422f,118676.164f,118700.914f,118725.664f,118750.414f,118775.164f,118799.922f,118824.672f,
+    118849.43f,118874.188f,118898.945f,118923.703f,118948.469f,118973.227f,118997.992f,119022.758f,
+    119047.523f,119072.289f,119097.062f,119121.828f,119146.602f,119171.375f,119196.148f,119220.922f,
+    119245.695f,119270.477f,119295.258f,119320.031f,119344.812f,119369.602f,119394.383f,119419.172f,
+    119443.953f,119468.742f,119493.531f,119518.32f,119543.117f,119567.906f,119592.703f,119617.5f,
+    119642.297f,119667.094f,119691.891f,119716.695f,119741.492f,119766.297f,119791.102f,119815.906f,
+    119840.719f,119865.523f,119890.336f,119915.148f,119939.961f,119964.773f,119989.586f,120014.406f,
+    120039.219f,120064.039f,120088.859f,120113.68f,120138.508f,120163.328f,120188.156f,120212.977f,
+    120237.805f,120262.633f,120287.469f,120312.297f,120337.133f,120361.969f,120386.805f,120411.641f,
+    120436.477f,120461.312f,120486.156f,120511.0f,120535.844f,120560.688f,120585.531f,120610.375f,
+    120635.227f,120660.078f,120684.93f,120709.781f,120734.633f,120759.484f,120784.344f,120809.203f,
+    120834.055f,120858.922f,120883.781f,120908.641f,120933.508f,120958.367f,120983.234f,121008.102f,
+    121032.969f,121057.844f,121082.711f,121107.586f,121132.461f,121157.336f,121182.211f,121207.086f,
+    121231.969f,121256.852f,121281.727f,121306.609f,121331.5f,121356.383f,121381.266f,121406.156f,
+    121431.047f,121455.938f,121480.828f,121505.719f,121530.617f,121555.508f,121580.406f,121605.305f,
+    121630.203f,121655.102f,121680.008f,121704.914f,121729.812f,121754.719f,121779.625f,121804.539f,
+    121829.445f,121854.359f,121879.266f,121904.18f,121929.094f,121954.016f,121978.93f,122003.852f,
+    122028.766f,122053.688f,122078.609f,122103.531f,122128.461f,122153.383f,122178.312f,122203.242f,
+    122228.172f,122253.102f,122278.031f,122302.969f,122327.906f,122352.836f,122377.773f,122402.719f,
+    122427.656f,122452.594f,122477.539f,122502.484f,122527.43f,122552.375f,122577.32f,122602.273f,
+    122627.219f,122652.172f,122677.125f,122702.078f,122727.039f,122751.992f,122776.953f,122801.906f,
+    122826.867f,122851.828f,122876.797f,122901.758f,122926.727f,122951.688f,122976.656f,123001.625f,
+    123026.602f,123051.57f,123076.547f,123101.516f,123126.492f,123151.469f,123176.445f,123201.43f,
+    123226.406f,123251.391f,123276.375f,123301.359f,123326.344f,123351.328f,123376.32f,123401.305f,
+    123426.297f,123451.289f,123476.281f,123501.281f,123526.273f,123551.273f,123576.273f,123601.273f,
+    123626.273f,123651.273f,123676.273f,123701.281f,123726.289f,123751.297f,123776.305f,123801.312f,
+    123826.32f,123851.336f,123876.352f,123901.367f,123926.383f,123951.398f,123976.414f,124001.438f,
+    124026.453f,124051.477f,124076.5f,124101.531f,124126.555f,124151.578f,124176.609f,124201.641f,
+    124226.672f,124251.703f,124276.734f,124301.773f,124326.805f,124351.844f,124376.883f,124401.922f,
+    124426.969f,124452.008f,124477.055f,124502.094f,124527.141f,124552.188f,124577.242f,124602.289f,
+    124627.344f,124652.391f,124677.445f,124702.5f,124727.562f,124752.617f,124777.672f,124802.734f,
+    124827.797f,124852.859f,124877.922f,124902.992f,124928.055f,124953.125f,124978.195f,125003.266f,
+    125028.336f,125053.406f,125078.484f,125103.555f,125128.633f,125153.711f,125178.789f,125203.867f,
+    125228.953f,125254.031f,125279.117f,125304.203f,125329.289f,125354.375f,125379.469f,125404.555f,
+    125429.648f,125454.742f,125479.836f,125504.93f,125530.023f,125555.125f,125580.227f,125605.328f,
+    125630.43f,125655.531f,125680.633f,125705.742f,125730.844f,125755.953f,125781.062f,125806.172f,
+    125831.281f,125856.398f,125881.508f,125906.625f,125931.742f,125956.859f,125981.977f,126007.102f,
+    126032.219f,126057.344f,126082.469f,126107.594f,126132.719f,126157.852f,126182.977f,126208.109f,
+    126233.242f,126258.375f,126283.508f,126308.641f,126333.781f,126358.914f,126384.055f,126409.195f,
+    126434.336f,126459.484f,126484.625f,126509.773f,126534.922f,126560.062f,126585.219f,126610.367f,
+    126635.516f,126660.672f,126685.828f,126710.977f,126736.133f,126761.297f,126786.453f,126811.617f,
+    126836.773f,126861.938f,126887.102f,126912.266f,126937.438f,126962.602f,126987.773f,127012.945f,
+    127038.117f,127063.289f,127088.461f,127113.633f,127138.812f,127163.992f,127189.172f,127214.352f,
+    127239.531f,127264.719f,127289.898f,127315.086f,127340.273f,127365.461f,127390.648f,127415.836f,
+    127441.031f,127466.219f,127491.414f,127516.609f,127541.805f,127567.008f,127592.203f,127617.406f,
+    127642.609f,127667.812f,127693.016f,127718.219f,127743.422f,127768.633f,127793.844f,127819.055f,
+    127844.266f,127869.477f,127894.688f,127919.906f,127945.125f,127970.344f,127995.562f,128020.781f,
+    128046.0f,128071.227f,128096.445f,128121.672f,128146.898f,128172.125f,128197.352f,128222.586f,
+    128247.82f,128273.047f,128298.281f,128323.516f,128348.758f,128373.992f,128399.234f,128424.469f,
+#endif
+#if MINIMP3_POW43_TABLE_SIZE > 6785
+    128449.711f,128474.953f,128500.195f,128525.445f,128550.688f,128575.938f,128601.188f,128626.438f,
+    128651.688f,128676.938f,128702.195f,128727.445f,128752.703f,128777.961f,128803.219f,128828.477f,
+    128853.742f,128879.0f,128904.266f,128929.531f,128954.797f,128980.062f,129005.336f,129030.602f,
+    129055.875f,129081.148f,129106.422f,129131.695f,129156.969f,129182.25f,129207.523f,129232.805f,
+    129258.086f,129283.367f,129308.656f,129333.938f,129359.227f,129384.508f,129409.797f,129435.086f,
+    129460.383f,129485.672f,129510.961f,129536.258f,129561.555f,129586.852f,129612.148f,129637.445f,
+    129662.75f,129688.055f,129713.352f,129738.656f,129763.961f,129789.273f,129814.578f,129839.891f,
+    129865.203f,129890.508f,129915.828f,129941.141f,129966.453f,129991.773f,130017.086f,130042.406f,
+    130067.727f,130093.047f,130118.375f,130143.695f,130169.023f,130194.352f,130219.68f,130245.008f,
+    130270.336f,130295.664f,130321.0f,130346.336f,130371.672f,130397.008f,130422.344f,130447.68f,
+    130473.023f,130498.367f,130523.703f,130549.047f,130574.398f,130599.742f,130625.086f,130650.438f,
+    130675.789f,130701.141f,130726.492f,130751.844f,130777.203f,130802.555f,130827.914f,130853.273f,
+    130878.633f,130903.992f,130929.352f,130954.719f,130980.086f,131005.445f,131030.812f,131056.188f,
+    131081.547f,131106.922f,131132.297f,131157.672f,131183.047f,131208.422f,131233.797f,131259.172f,
+    131284.547f,131309.938f,131335.312f,131360.703f,131386.078f,131411.469f,131436.859f,131462.25f,
+    131487.641f,131513.031f,131538.422f,131563.812f,131589.203f,131614.594f,131640.0f,131665.391f,
+    131690.797f,131716.188f,131741.594f,131767.0f,131792.406f,131817.812f,131843.219f,131868.625f,
+    131894.031f,131919.438f,131944.844f,131970.266f,131995.672f,132021.094f,132046.5f,132071.922f,
+    132097.344f,132122.766f,132148.188f,132173.609f,132199.031f,132224.453f,132249.875f,132275.312f,
+    132300.734f,132326.172f,132351.594f,132377.031f,132402.469f,132427.891f,132453.328f,132478.766f,
+    132504.203f,132529.641f,132555.094f,132580.531f,132605.969f,132631.422f,132656.859f,132682.312f,
+    132707.75f,132733.203f,132758.656f,132784.109f,132809.562f,132835.016f,132860.469f,132885.922f,
+    132911.391f,132936.844f,132962.297f,132987.766f,133013.219f,133038.688f,133064.156f,133089.625f,
+    133115.094f,133140.562f,133166.031f,133191.5f,133216.969f,133242.438f,133267.922f,133293.391f,
+    133318.875f,133344.344f,133369.828f,133395.312f,133420.797f,133446.281f,133471.766f,133497.25f,
+    133522.734f,133548.219f,133573.703f,133599.203f,133624.688f,133650.188f,133675.688f,133701.172f,
+    133726.672f,133752.172f,133777.672f,133803.172f,133828.672f,133854.172f,133879.672f,133905.188f,
+    133930.688f,133956.203f,133981.703f,134007.219f,134032.734f,134058.234f,134083.75f,134109.266f,
+    134134.781f,134160.297f,134185.812f,134211.344f,134236.859f,134262.375f,134287.906f,134313.438f,
+    134338.953f,134364.484f,134390.016f,134415.547f,134441.078f,134466.609f,134492.141f,134517.672f,
+    134543.203f,134568.75f,134594.281f,134619.812f,134645.359f,134670.906f,134696.438f,134721.984f,
+    134747.531f,134773.078f,134798.625f,134824.172f,134849.719f,134875.281f,134900.828f,134926.391f,
+    134951.938f,134977.5f,135003.047f,135028.609f,135054.172f,135079.734f,135105.297f,135130.859f,
+    135156.422f,135181.984f,135207.547f,135233.125f,135258.688f,135284.266f,135309.828f,135335.406f,
+    135360.984f,135386.562f,135412.125f,135437.703f,135463.281f,135488.875f,135514.453f,135540.031f,
+    135565.609f,135591.203f,135616.781f,135642.375f,135667.969f,135693.547f,135719.141f,135744.734f,
+    135770.328f,135795.922f,135821.516f,135847.125f,135872.719f,135898.312f,135923.922f,135949.516f,
+    135975.125f,136000.734f,136026.328f,136051.938f,136077.547f,136103.156f,136128.766f,136154.375f,
+    136179.984f,136205.609f,136231.219f,136256.844f,136282.453f,136308.078f,136333.688f,136359.312f,
+    136384.938f,136410.562f,136436.188f,136461.812f,136487.438f,136513.062f,136538.703f,136564.328f,
+    136589.953f,136615.594f,136641.234f,136666.859f,136692.5f,136718.141f,136743.781f,136769.422f,
+    136795.062f,136820.703f,136846.344f,136871.984f,136897.641f,136923.281f,136948.938f,136974.578f,
+    137000.234f,137025.891f,137051.547f,137077.203f,137102.859f,137128.516f,137154.172f,137179.828f,
+    137205.484f,137231.156f,137256.812f,137282.484f,137308.141f,137333.812f,137359.484f,137385.156f,
+    137410.812f,137436.484f,137462.156f,137487.844f,137513.516f,137539.188f,137564.875f,137590.547f,
+    137616.219f,137641.906f,137667.594f,137693.281f,137718.953f,137744.641f,137770.328f,137796.016f,
+    137821.703f,137847.406f,137873.094f,137898.781f,137924.484f,137950.172f,137975.875f,138001.578f,
+    138027.266f,138052.969f,138078.672f,138104.375f,138130.078f,138155.781f,138181.484f,138207.203f,
+    138232.906f,138258.609f,138284.328f,138310.047f,138335.75f,138361.469f,138387.188f,138412.906f,
+    138438.625f,138464.344f,138490.062f,138515.781f,138541.5f,138567.234f,138592.953f,138618.688f,
+    138644.406f,138670.141f,138695.875f,138721.594f,138747.328f,138773.062f,138798.797f,138824.531f,
+    138850.281f,138876.016f,138901.75f,138927.5f,138953.234f,138978.984f,139004.719f,139030.469f,
+    139056.219f,139081.969f,139107.719f,139133.469f,139159.219f,139184.969f,139210.719f,139236.484f,
+    139262.234f,139288.0f,139313.75f,139339.516f,139365.281f,139391.031f,139416.797f,139442.562f,
+    139468.328f,139494.094f,139519.875f,139545.641f,139571.406f,139597.188f,139622.953f,139648.734f,
+    139674.5f,139700.281f,139726.062f,139751.844f,139777.625f,139803.406f,139829.188f,139854.969f,
+    139880.75f,139906.531f,139932.328f,139958.109f,139983.906f,140009.688f,140035.484f,140061.281f,
+    140087.078f,140112.875f,140138.672f,140164.469f,140190.266f,140216.062f,140241.859f,140267.672f,
+    140293.469f,140319.281f,140345.078f,140370.891f,140396.703f,140422.516f,140448.328f,140474.141f,
+    140499.953f,140525.766f,140551.578f,140577.391f,140603.219f,140629.031f,140654.859f,140680.672f,
+    140706.5f,140732.328f,140758.156f,140783.969f,140809.797f,140835.625f,140861.469f,140887.297f,
+    140913.125f,140938.953f,140964.797f,140990.625f,141016.469f,141042.312f,141068.141f,141093.984f,
+    141119.828f,141145.672f,141171.516f,141197.359f,141223.203f,141249.062f,141274.906f,141300.75f,
+    141326.609f,141352.453f,141378.312f,141404.172f,141430.031f,141455.875f,141481.734f,141507.594f,
+#endif
+#if MINIMP3_POW43_TABLE_SIZE > 7297
+    141533.469f,141559.328f,141585.188f,141611.047f,141636.922f,141662.781f,141688.656f,141714.516f,
+    141740.391f,141766.266f,141792.141f,141818.016f,141843.891f,141869.766f,141895.641f,141921.516f,
+    141947.391f,141973.281f,141999.156f,142025.047f,142050.922f,142076.812f,142102.703f,142128.594f,
+    142154.484f,142180.375f,142206.266f,142232.156f,142258.047f,142283.938f,142309.844f,142335.734f,
+    142361.641f,142387.531f,142413.438f,142439.344f,142465.234f,142491.141f,142517.047f,142542.953f,
+    142568.859f,142594.781f,142620.688f,142646.594f,142672.516f,142698.422f,142724.344f,142750.25f,
+    142776.172f,142802.094f,142828.016f,142853.938f,142879.859f,142905.781f,142931.703f,142957.625f,
+    142983.547f,143009.484f,143035.406f,143061.344f,143087.266f,143113.203f,143139.141f,143165.078f,
+    143191.016f,143216.953f,143242.891f,143268.828f,143294.766f,143320.703f,143346.656f,143372.594f,
+    143398.547f,143424.484f,143450.438f,143476.391f,143502.344f,143528.297f,143554.25f,143580.203f,
+    143606.156f,143632.109f,143658.062f,143684.031f,143709.984f,143735.938f,143761.906f,143787.875f,
+    143813.828f,143839.797f,143865.766f,143891.734f,143917.703f,143943.672f,143969.641f,143995.625f,
+    144021.594f,144047.562f,144073.547f,144099.516f,144125.5f,144151.484f,144177.453f,144203.438f,
+    144229.422f,144255.406f,144281.391f,144307.375f,144333.375f,144359.359f,144385.344f,144411.344f,
+    144437.328f,144463.328f,144489.328f,144515.312f,144541.312f,144567.312f,144593.312f,144619.312f,
+    144645.312f,144671.312f,144697.328f,144723.328f,144749.328f,144775.344f,144801.344f,144827.359f,
+    144853.375f,144879.391f,144905.391f,144931.406f,144957.422f,144983.453f,145009.469f,145035.484f,
+    145061.5f,145087.531f,145113.547f,145139.578f,145165.594f,145191.625f,145217.656f,145243.688f,
+    145269.719f,145295.734f,145321.781f,145347.812f,145373.844f,145399.875f,145425.922f,145451.953f,
+    145478.0f,145504.031f,145530.078f,145556.109f,145582.156f,145608.203f,145634.25f,145660.297f,
+    145686.344f,145712.391f,145738.453f,145764.5f,145790.547f,145816.609f,145842.656f,145868.719f,
+    145894.781f,145920.844f,145946.891f,145972.953f,145999.016f,146025.078f,146051.156f,146077.219f,
+    146103.281f,146129.359f,146155.422f,146181.484f,146207.562f,146233.641f,146259.719f,146285.781f,
+    146311.859f,146337.938f,146364.016f,146390.094f,146416.188f,146442.266f,146468.344f,146494.438f,
+    146520.516f,146546.609f,146572.688f,146598.781f,146624.875f,146650.969f,146677.062f,146703.156f,
+    146729.25f,146755.344f,146781.438f,146807.531f,146833.641f,146859.734f,146885.844f,146911.938f,
+    146938.047f,146964.156f,146990.266f,147016.359f,147042.469f,147068.578f,147094.703f,147120.812f,
+    147146.922f,147173.031f,147199.156f,147225.266f,147251.391f,147277.516f,147303.625f,147329.75f,
+    147355.875f,147382.0f,147408.125f,147434.25f,147460.375f,147486.5f,147512.641f,147538.766f,
+    147564.891f,147591.031f,147617.172f,147643.297f,147669.438f,147695.578f,147721.719f,147747.859f,
+    147774.0f,147800.141f,147826.281f,147852.422f,147878.578f,147904.719f,147930.875f,147957.016f,
+    147983.172f,148009.328f,148035.469f,148061.625f,148087.781f,148113.938f,148140.094f,148166.25f,
+    148192.422f,148218.578f,148244.734f,148270.906f,148297.062f,148323.234f,148349.406f,148375.562f,
+    148401.734f,148427.906f,148454.078f,148480.25f,148506.422f,148532.594f,148558.781f,148584.953f,
+    148611.125f,148637.312f,148663.484f,148689.672f,148715.859f,148742.047f,148768.219f,148794.406f,
+    148820.594f,148846.781f,148872.984f,148899.172f,148925.359f,148951.547f,148977.75f,149003.938f,
+    149030.141f,149056.344f,149082.531f,149108.734f,149134.938f,149161.141f,149187.344f,149213.547f,
+    149239.75f,149265.969f,149292.172f,149318.375f,149344.594f,149370.797f,149397.016f,149423.234f,
+    149449.453f,149475.656f,149501.875f,149528.094f,149554.312f,149580.547f,149606.766f,149632.984f,
+    149659.203f,149685.438f,149711.656f,149737.891f,149764.125f,149790.344f,149816.578f,149842.812f,
+    149869.047f,149895.281f,149921.516f,149947.75f,149973.984f,150000.234f,150026.469f,150052.719f,
+    150078.953f,150105.203f,150131.438f,150157.688f,150183.938f,150210.188f,150236.438f,150262.688f,
+    150288.938f,150315.188f,150341.453f,150367.703f,150393.953f,150420.219f,150446.469f,150472.734f,
+    150499.0f,150525.25f,150551.516f,150577.781f,150604.047f,150630.312f,150656.578f,150682.859f,
+    150709.125f,150735.391f,150761.672f,150787.938f,150814.219f,150840.5f,150866.766f,150893.047f,
+    150919.328f,150945.609f,150971.891f,150998.172f,151024.453f,151050.75f,151077.031f,151103.312f,
+    151129.609f,151155.891f,151182.188f,151208.484f,151234.766f,151261.062f,151287.359f,151313.656f,
+    151339.953f,151366.25f,151392.547f,151418.859f,151445.156f,151471.453f,151497.766f,151524.062f,
+    151550.375f,151576.688f,151603.0f,151629.297f,151655.609f,151681.922f,151708.234f,151734.562f,
+    151760.875f,151787.188f,151813.5f,151839.828f,151866.141f,151892.469f,151918.797f,151945.109f,
+    151971.438f,151997.766f,152024.094f,152050.422f,152076.75f,152103.078f,152129.422f,152155.75f,
+    152182.078f,152208.422f,152234.75f,152261.094f,152287.438f,152313.766f,152340.109f,152366.453f,
+    152392.797f,152419.141f,152445.484f,152471.828f,152498.188f,152524.531f,152550.875f,152577.234f,
+    152603.578f,152629.938f,152656.297f,152682.656f,152709.0f,152735.359f,152761.719f,152788.078f,
+    152814.453f,152840.812f,152867.172f,152893.531f,152919.906f,152946.266f,152972.641f,152999.016f,
+    153025.375f,153051.75f,153078.125f,153104.5f,153130.875f,153157.25f,153183.625f,153210.0f,
+    153236.391f,153262.766f,153289.141f,153315.531f,153341.922f,153368.297f,153394.688f,153421.078f,
+    153447.469f,153473.859f,153500.25f,153526.641f,153553.031f,153579.422f,153605.812f,153632.219f,
+    153658.609f,153685.016f,153711.406f,153737.812f,153764.219f,153790.625f,153817.031f,153843.438f,
+    153869.844f,153896.25f,153922.656f,153949.062f,153975.484f,154001.891f,154028.297f,154054.719f,
+    154081.141f,154107.547f,154133.969f,154160.391f,154186.812f,154213.234f,154239.656f,154266.078f,
+    154292.5f,154318.922f,154345.359f,154371.781f,154398.219f,154424.641f,154451.078f,154477.516f,
+    154503.938f,154530.375f,154556.812f,154583.25f,154609.688f,154636.125f,154662.578f,154689.016f,
+    154715.453f,154741.906f,154768.344f,154794.797f,154821.234f,154847.688f,154874.141f,154900.594f,
+#endif
+#if MINIMP3_POW43_TABLE_SIZE > 7809
+    154927.047f,154953.5f,154979.953f,155006.406f,155032.859f,155059.312f,155085.781f,155112.234f,
+    155138.703f,155165.156f,155191.625f,155218.094f,155244.562f,155271.016f,155297.484f,155323.953f,
+    155350.438f,155376.906f,155403.375f,155429.844f,155456.328f,155482.797f,155509.281f,155535.75f,
+    155562.234f,155588.719f,155615.188f,155641.672f,155668.156f,155694.641f,155721.125f,155747.625f,
+    155774.109f,155800.594f,155827.094f,155853.578f,155880.078f,155906.562f,155933.062f,155959.562f,
+    155986.047f,156012.547f,156039.047f,156065.547f,156092.047f,156118.562f,156145.062f,156171.562f,
+    156198.078f,156224.578f,156251.094f,156277.594f,156304.109f,156330.625f,156357.141f,156383.641f,
+    156410.156f,156436.672f,156463.203f,156489.719f,156516.234f,156542.75f,156569.281f,156595.797f,
+    156622.328f,156648.844f,156675.375f,156701.906f,156728.438f,156754.969f,156781.5f,156808.031f,
+    156834.562f,156861.094f,156887.625f,156914.172f,156940.703f,156967.25f,156993.781f,157020.328f,
+    157046.859f,157073.406f,157099.953f,157126.5f,157153.047f,157179.594f,157206.141f,157232.688f,
+    157259.25f,157285.797f,157312.344f,157338.906f,157365.453f,157392.016f,157418.578f,157445.141f,
+    157471.688f,157498.25f,157524.812f,157551.375f,157577.953f,157604.516f,157631.078f,157657.641f,
+    157684.219f,157710.781f,157737.359f,157763.922f,157790.5f,157817.078f,157843.656f,157870.234f,
+    157896.812f,157923.391f,157949.969f,157976.547f,158003.125f,158029.719f,158056.297f,158082.891f,
+    158109.469f,158136.062f,158162.656f,158189.234f,158215.828f,158242.422f,158269.016f,158295.609f,
+    158322.203f,158348.812f,158375.406f,158402.0f,158428.609f,158455.203f,158481.812f,158508.406f,
+    158535.016f,158561.625f,158588.234f,158614.844f,158641.453f,158668.062f,158694.672f,158721.281f,
+    158747.891f,158774.516f,158801.125f,158827.75f,158854.359f,158880.984f,158907.609f,158934.219f,
+    158960.844f,158987.469f,159014.094f,159040.719f,159067.344f,159093.969f,159120.609f,159147.234f,
+    159173.875f,159200.5f,159227.141f,159253.766f,159280.406f,159307.047f,159333.688f,159360.312f,
+    159386.953f,159413.609f,159440.25f,159466.891f,159493.531f,159520.188f,159546.828f,159573.469f,
+    159600.125f,159626.781f,159653.422f,159680.078f,159706.734f,159733.391f,159760.047f,159786.703f,
+    159813.359f,159840.016f,159866.688f,159893.344f,159920.0f,159946.672f,159973.328f,160000.0f,
+    160026.672f,160053.328f,160080.0f,160106.672f,160133.344f,160160.016f,160186.688f,160213.375f,
+    160240.047f,160266.719f,160293.406f,160320.078f,160346.766f,160373.438f,160400.125f,160426.812f,
+    160453.5f,160480.188f,160506.859f,160533.562f,160560.25f,160586.938f,160613.625f,160640.312f,
+    160667.016f,160693.703f,160720.406f,160747.109f,160773.797f,160800.5f,160827.203f,160853.906f,
+    160880.609f,160907.312f,160934.016f,160960.719f,160987.422f,161014.141f,161040.844f,161067.547f,
+    161094.266f,161120.984f,161147.688f,161174.406f,161201.125f,161227.844f,161254.562f,161281.281f,
+    161308.0f,161334.719f,161361.438f,161388.172f,161414.891f,161441.625f,161468.344f,161495.078f,
+    161521.797f,161548.531f,161575.266f,161602.0f,161628.734f,161655.469f,161682.203f,161708.938f,
+    161735.672f,161762.422f,161789.156f,161815.891f,161842.641f,161869.391f,161896.125f,161922.875f,
+    161949.625f,161976.375f,162003.125f,162029.875f,162056.625f,162083.375f,162110.125f,162136.875f,
+    162163.641f,162190.391f,162217.156f,162243.906f,162270.672f,162297.438f,162324.188f,162350.953f,
+    162377.719f,162404.484f,162431.25f,162458.031f,162484.797f,162511.562f,162538.328f,162565.109f,
+    162591.875f,162618.656f,162645.438f,162672.203f,162698.984f,162725.766f,162752.547f,162779.328f,
+    162806.109f,162832.891f,162859.672f,162886.453f,162913.25f,162940.031f,162966.828f,162993.609f,
+    163020.406f,163047.203f,163073.984f,163100.781f,163127.578f,163154.375f,163181.172f,163207.969f,
+    163234.766f,163261.578f,163288.375f,163315.172f,163341.984f,163368.797f,163395.594f,163422.406f,
+    163449.219f,163476.016f,163502.828f,163529.641f,163556.453f,163583.266f,163610.094f,163636.906f,
+    163663.719f,163690.547f,163717.359f,163744.188f,163771.0f,163797.828f,163824.656f,163851.469f,
+    163878.297f,163905.125f,163931.953f,163958.781f,163985.609f,164012.453f,164039.281f,164066.109f,
+    164092.953f,164119.781f,164146.625f,164173.469f,164200.297f,164227.141f,164253.984f,164280.828f,
+    164307.672f,164334.516f,164361.359f,164388.203f,164415.062f,164441.906f,164468.75f,164495.609f,
+    164522.453f,164549.312f,164576.172f,164603.031f,164629.875f,164656.734f,164683.594f,164710.453f,
+    164737.312f,164764.188f,164791.047f,164817.906f,164844.781f,164871.641f,164898.516f,164925.375f,
+    164952.25f,164979.125f,165006.0f,165032.875f,165059.734f,165086.625f,165113.5f,165140.375f,
+    165167.25f,165194.125f,165221.016f,165247.891f,165274.781f,165301.656f,165328.547f,165355.438f,
+    165382.328f,165409.203f,165436.094f,165462.984f,165489.875f,165516.781f,
+#endif
+};
+
+#endif /* MINIMP3_POW43_H */
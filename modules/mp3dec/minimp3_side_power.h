@@ -0,0 +1,33 @@
+/* Generated by tools/gen_side_power.py from minimp3.h, do not edit.
+   Per-table line statistics for mp3dec_frame_power(), see the script. */
+#ifndef MINIMP3_SIDE_POWER_H
+#define MINIMP3_SIDE_POWER_H
+
+/* mean |q|^(8/3) per line: big_values tables 0..31, then count1 tables A and B */
+static const float g_side_energy[34] = {
+    0, 0.3125f, 0.7277f, 0.9152f, 0, 1.111f, 2.704f, 2.818f,
+    2.895f, 6.199f, 5.648f, 10.07f, 14.25f, 21.63f, 0, 67.3f,
+    16.44f, 16.44f, 16.44f, 16.44f, 16.44f, 16.44f, 16.44f, 16.44f,
+    92.59f, 92.59f, 92.59f, 92.59f, 92.59f, 92.59f, 92.59f, 92.59f,
+    0.2109f, 0.5f
+};
+/* mean bits per line, same order */
+static const float g_side_bits[34] = {
+    0, 1.188f, 1.492f, 1.805f, 0, 1.566f, 2.387f, 1.735f,
+    2.186f, 2.749f, 1.804f, 2.566f, 3.099f, 2.089f, 0, 3.647f,
+    2.144f, 2.167f, 2.19f, 2.213f, 2.259f, 2.305f, 2.351f, 2.42f,
+    4.703f, 4.853f, 5.002f, 5.152f, 5.301f, 5.45f, 5.749f, 6.048f,
+    0.9219f, 1.5f
+};
+/* (15 + 2^linbits/2)^(8/3) for tables 16..31 */
+static const float g_side_peak[16] = {
+    1625.0f, 1911.0f, 2570.0f, 4278.0f, 2.877e4f, 5.592e5f, 1.812e7f, 4.337e9f,
+    4278.0f, 9483.0f, 2.877e4f, 1.149e5f, 5.592e5f, 3.076e6f, 1.107e8f, 4.337e9f
+};
+/* mean attenuation of a partition by scalefac_scale and scalefactor bits (0..5) */
+static const float g_side_scf[2][6] = {
+    { 1.0f, 0.75f, 0.4688f, 0.249f, 0.125f, 0.0625f },
+    { 1.0f, 0.625f, 0.332f, 0.1667f, 0.08333f, 0.04167f }
+};
+
+#endif /* MINIMP3_SIDE_POWER_H */
@@ -1,46 +1,95 @@
-#define MINIMP3_IMPLEMENTATION
-#include "minimp3.h"
+#include "mp3dec_core.h"
+#include "mp3dec_mixer.h"
+#include "mp3dec_playlist.h"
 #include "py/runtime.h"
 #include "py/objstr.h"
 #include "py/stream.h"
+#include "py/mphal.h"
+#include "py/mperrno.h"
 #include <string.h>
 
+// MicroPython binding of the streaming decoder core (mp3dec_core.c), the
+// mixer (mp3dec_mixer.c) and the playlist (mp3dec_playlist.c): this file only
+// converts arguments, owns the buffers and calls the Python stream.
+
 // --- Object Structure ---
 typedef struct _mp3dec_obj_t {
     mp_obj_base_t base;
-    mp3dec_t mp3d;
-    mp3dec_frame_info_t info;
-    mp_obj_t stream;      
-    uint8_t *file_buf;    
-    size_t file_buf_size;
-    size_t buf_valid;
-    int volume;
-    float current_sec; // Track playback time
-    bool force_mono;   // New: Force stereo to mono mix
+    mp_obj_t stream;
+    mp3dec_core_t core;
 } mp3dec_obj_t;
 
 const mp_obj_type_t mp3dec_type;
 
+// --- Stream Callbacks ---
+// Exceptions raised by the stream propagate out of the core unchanged.
+// readinto() returning None (non-blocking socket, no data yet) is not the end.
+static size_t mp3dec_stream_read(void *ctx, uint8_t *buf, size_t len) {
+    mp3dec_obj_t *self = ctx;
+    mp_obj_t read_method[2] = {
+        mp_load_attr(self->stream, MP_QSTR_readinto),
+        mp_obj_new_bytearray_by_ref(len, buf)
+    };
+    mp_obj_t res = mp_call_method_n_kw(0, 0, read_method);
+    if (res == mp_const_none) return MP3DEC_IO_AGAIN;
+    return mp_obj_get_int(res);
+}
+
+static int mp3dec_stream_seek(void *ctx, size_t offset) {
+    mp3dec_obj_t *self = ctx;
+    // stream.seek(offset, 0)
+    mp_obj_t seek_method[3] = {
+        mp_load_attr(self->stream, MP_QSTR_seek),
+        mp_obj_new_int(offset),
+        mp_obj_new_int(0) // 0 = SEEK_SET (absolute)
+    };
+    mp_call_method_n_kw(0, 0, seek_method);
+    return 0;
+}
+
+static uint32_t mp3dec_ticks_us(void) {
+    return mp_hal_ticks_us();
+}
+
+// Raise for a negative MP3DEC_CORE_ERR_* result
+static void mp3dec_check(int err) {
+    if (err == MP3DEC_CORE_ERR_SNAPSHOT) {
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid snapshot"));
+    }
+    if (err < 0) {
+        mp_raise_OSError(MP_EIO);
+    }
+}
+
 // --- Constructor ---
-// Usage: MP3Decoder(stream, buf_size=8192)
+// Usage: MP3Decoder(source, buf_size=8192)
+// source is a stream positioned at the start of the file, or a buffer holding
+// the whole file (bytes, bytearray, memoryview, e.g. a sound effect in PSRAM).
+// A buffer is decoded in place: no input buffer is allocated, nothing is
+// copied and seeks are free. It must not be resized while the decoder uses it.
+// Streams: buf_size below 4096 selects small-buffer mode: down to 1536 bytes
+// (one maximum MPEG-1 Layer III frame). Larger frames (Layer II, high bitrate
+// MPEG-2/2.5) need buf_size of at least their size plus 4.
 static mp_obj_t mp3dec_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
     mp_arg_check_num(n_args, n_kw, 1, 2, false); // Allow 1 or 2 args
-    
+
     mp3dec_obj_t *self = m_new_obj(mp3dec_obj_t);
     self->base.type = &mp3dec_type;
-    
-    mp3dec_init(&self->mp3d);
-    self->stream = args[0];
-    
+    self->stream = args[0]; // Also keeps an in-memory source alive
+
+    const mp3dec_core_io_t io = { mp3dec_stream_read, mp3dec_stream_seek, mp3dec_ticks_us, self };
+    mp3dec_checkpoint_t *cp = m_new(mp3dec_checkpoint_t, MP3DEC_DEFAULT_CP_MAX);
+    mp_buffer_info_t bufinfo;
+    if (mp_get_buffer(args[0], &bufinfo, MP_BUFFER_READ)) {
+        mp3dec_core_init_mem(&self->core, &io, bufinfo.buf, bufinfo.len, cp, MP3DEC_DEFAULT_CP_MAX);
+        return MP_OBJ_FROM_PTR(self);
+    }
+
     // Configurable buffer size (Default 8KB)
-    self->file_buf_size = (n_args > 1) ? mp_obj_get_int(args[1]) : 8192;
-    if (self->file_buf_size < 1024) self->file_buf_size = 1024; // Safety minimum
-    
-    self->file_buf = m_new(uint8_t, self->file_buf_size);
-    self->buf_valid = 0;
-    self->volume = 100;
-    self->current_sec = 0.0f;
-    self->force_mono = false;
+    size_t buf_size = (n_args > 1) ? mp_obj_get_int(args[1]) : MP3DEC_DEFAULT_BUF_SIZE;
+    if (buf_size < MP3DEC_MIN_BUF_SIZE) buf_size = MP3DEC_MIN_BUF_SIZE; // Safety minimum
+
+    mp3dec_core_init(&self->core, &io, m_new(uint8_t, buf_size), buf_size, cp, MP3DEC_DEFAULT_CP_MAX);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -48,249 +97,402 @@ static mp_obj_t mp3dec_make_new(const mp_obj_type_t *type, size_t n_args, size_t
 // --- Method: decode ---
 static mp_obj_t mp3dec_decode(mp_obj_t self_in, mp_obj_t out_buf_in) {
     mp3dec_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    
+
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(out_buf_in, &bufinfo, MP_BUFFER_WRITE);
-    short * pcm = (short *)bufinfo.buf;
-
-    while (1) {
-        // 1. Refill Buffer if needed
-        if (self->buf_valid < self->file_buf_size - 512) { // 512 is safe margin for headers
-            size_t bytes_to_read = self->file_buf_size - self->buf_valid;
-            
-            // Shift remaining data to start
-            if (self->buf_valid > 0) {
-                memmove(self->file_buf, self->file_buf + (self->file_buf_size - bytes_to_read - self->buf_valid), self->buf_valid);
-            }
-            
-            // Read from Python Stream
-            mp_obj_t read_method[2] = {
-                mp_load_attr(self->stream, MP_QSTR_readinto), 
-                mp_obj_new_bytearray_by_ref(bytes_to_read, self->file_buf + self->buf_valid)
-            };
-            mp_obj_t res = mp_call_method_n_kw(0, 0, read_method);
-            size_t bytes_read = mp_obj_get_int(res);
-            self->buf_valid += bytes_read;
-            
-            // End of File
-            if (bytes_read == 0 && self->buf_valid == 0) return MP_OBJ_NEW_SMALL_INT(0); 
-        }
 
-        // 2. Decode Frame
-        int samples = mp3dec_decode_frame(&self->mp3d, self->file_buf, self->buf_valid, pcm, &self->info);
-        
-        // 3. Consume Bytes
-        size_t consumed = self->info.frame_bytes;
-        if (consumed == 0) consumed = 1; // Prevent infinite loop on bad data
-        if (consumed > self->buf_valid) consumed = self->buf_valid; // Safety
-
-        self->buf_valid -= consumed;
-        memmove(self->file_buf, self->file_buf + consumed, self->buf_valid);
-
-        if (samples > 0) {
-            // Update internal timer
-            if (self->info.hz > 0) {
-                self->current_sec += (float)samples / (float)self->info.hz;
-            }
-
-            int output_samples = samples * self->info.channels;
-
-            // 4. Post-Processing: Volume & Mono Mixing
-            // Optimization: Combine loops if volume != 100
-            if (self->force_mono && self->info.channels == 2) {
-                // Mix Stereo -> Mono (Average L+R)
-                for (int i = 0; i < samples; i++) {
-                    int32_t mixed = ((int32_t)pcm[i*2] + (int32_t)pcm[i*2+1]) / 2;
-                    if (self->volume < 100) mixed = mixed * self->volume / 100;
-                    pcm[i] = (short)mixed; // Store continuously
-                }
-                return MP_OBJ_NEW_SMALL_INT(samples * 2); // Return bytes (samples * 1 channel * 2 bytes)
-            } 
-            else if (self->volume < 100) {
-                // Just Volume
-                for (int i = 0; i < output_samples; i++) {
-                    pcm[i] = (short)((int32_t)pcm[i] * self->volume / 100);
-                }
-            }
-
-            // Return number of bytes written to PCM buffer
-            // (Samples * Channels * 2 bytes_per_short)
-            return MP_OBJ_NEW_SMALL_INT(output_samples * 2);
-        }
-    }
+    // Returns bytes written to the PCM buffer, 0 at End of File,
+    // None while a live stream is buffering
+    int res = mp3dec_core_decode(&self->core, (int16_t *)bufinfo.buf);
+    if (res == MP3DEC_CORE_BUFFERING) return mp_const_none;
+    return MP_OBJ_NEW_SMALL_INT(res);
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(mp3dec_decode_obj, mp3dec_decode);
 
 // --- Method: seek ---
 // Usage: decoder.seek(byte_offset, time_seconds)
-static mp_obj_t mp3dec_seek(mp_obj_t self_in, mp_obj_t byte_offset_in, mp_obj_t time_sec_in) {
-    mp3dec_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    
-    // 1. Get arguments from Python
-    int offset = mp_obj_get_int(byte_offset_in);
-    float new_time = mp_obj_get_float(time_sec_in);
-
-    // 2. Perform the physical seek on the stream
-    // stream.seek(offset, 0)
-    mp_obj_t seek_method[3] = {
-        mp_load_attr(self->stream, MP_QSTR_seek),
-        mp_obj_new_int(offset),
-        mp_obj_new_int(0) // 0 = SEEK_SET (absolute)
-    };
-    mp_call_method_n_kw(0, 0, seek_method);
+//        decoder.seek(time_seconds)   (same as scan(time_seconds))
+static mp_obj_t mp3dec_seek(size_t n_args, const mp_obj_t *args) {
+    mp3dec_obj_t *self = MP_OBJ_TO_PTR(args[0]);
 
-    // 3. Reset Decoder State (Critical)
-    // We clear the internal buffer so we don't play leftover audio from the old position
-    self->buf_valid = 0;
-    mp3dec_init(&self->mp3d); 
-    
-    // 4. Force the internal timer to the new time
-    self->current_sec = new_time;
+    if (n_args == 2) {
+        int res = mp3dec_core_scan(&self->core, false, 0, 0.0f, mp_obj_get_float(args[1]));
+        mp3dec_check(res);
+        return mp_obj_new_bool(res);
+    }
 
+    int offset = mp_obj_get_int(args[1]);
+    float new_time = mp_obj_get_float(args[2]);
+    mp3dec_check(mp3dec_core_seek(&self->core, offset, new_time));
     return mp_const_true;
 }
-static MP_DEFINE_CONST_FUN_OBJ_3(mp3dec_seek_obj, mp3dec_seek);
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp3dec_seek_obj, 2, 3, mp3dec_seek);
 
 // --- Method: tell ---
 // Returns current playback position in seconds
 static mp_obj_t mp3dec_tell(mp_obj_t self_in) {
     mp3dec_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    return mp_obj_new_float(self->current_sec);
+    return mp_obj_new_float(self->core.current_sec);
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(mp3dec_tell_obj, mp3dec_tell);
 
+// --- Method: snapshot ---
+// Usage: state = decoder.snapshot()
+// Captures everything needed to continue on the exact next sample after a
+// power cycle: stream offset, sample position and the mp3dec_t history.
+// At most 6.7 KB (the reservoir part varies), so store it in a file or flash.
+static mp_obj_t mp3dec_snapshot(mp_obj_t self_in) {
+    mp3dec_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    vstr_t vstr;
+    vstr_init_len(&vstr, mp3dec_core_snapshot_size(&self->core));
+    mp3dec_core_snapshot(&self->core, (uint8_t *)vstr.buf);
+    return mp_obj_new_bytes_from_vstr(&vstr);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(mp3dec_snapshot_obj, mp3dec_snapshot);
+
+// --- Method: restore ---
+// Usage: decoder.restore(state)
+// The decoder must be reading the same file the snapshot was taken from.
+// Seeks the stream and reloads the decoder history; no scan, no pre-roll.
+// Raises ValueError (leaving the decoder as it was) for an invalid snapshot.
+static mp_obj_t mp3dec_restore(mp_obj_t self_in, mp_obj_t state_in) {
+    mp3dec_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(state_in, &bufinfo, MP_BUFFER_READ);
+    mp3dec_check(mp3dec_core_restore(&self->core, (const uint8_t *)bufinfo.buf, bufinfo.len));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(mp3dec_restore_obj, mp3dec_restore);
+
 // --- Settings ---
 static mp_obj_t mp3dec_set_volume(mp_obj_t self_in, mp_obj_t vol_in) {
     mp3dec_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    int vol = mp_obj_get_int(vol_in);
-    self->volume = (vol < 0) ? 0 : (vol > 100 ? 100 : vol);
+    mp3dec_core_set_volume(&self->core, mp_obj_get_int(vol_in));
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(mp3dec_set_volume_obj, mp3dec_set_volume);
 
 static mp_obj_t mp3dec_set_mono(mp_obj_t self_in, mp_obj_t enable_in) {
     mp3dec_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    self->force_mono = mp_obj_is_true(enable_in);
+    self->core.force_mono = mp_obj_is_true(enable_in);
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(mp3dec_set_mono_obj, mp3dec_set_mono);
 
+// Usage: decoder.set_sync_matches(n)
+// Frame headers that must follow a candidate before sync is accepted (1..10).
+// 10 (default) is strict, for network streams; 1-2 for trusted local files
+// starts playback after reading only the first few frames.
+static mp_obj_t mp3dec_set_sync_matches(mp_obj_t self_in, mp_obj_t n_in) {
+    mp3dec_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp3dec_core_set_sync_matches(&self->core, mp_obj_get_int(n_in));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(mp3dec_set_sync_matches_obj, mp3dec_set_sync_matches);
+
+// Usage: decoder.set_governor(target, max_quality=3)
+// Let decode() trade quality for speed when decoding takes more than target
+// (0..1) of real time: 1 drops subbands above ~14 kHz, 2 also mixes stereo to
+// mono before synthesis, 3 keeps only subbands below ~7 kHz (Layer III).
+// target=0 turns the governor off; max_quality then sets a fixed level.
+static mp_obj_t mp3dec_set_governor(size_t n_args, const mp_obj_t *args) {
+    mp3dec_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    float target = mp_obj_get_float(args[1]);
+    int max_quality = (n_args > 2) ? mp_obj_get_int(args[2]) : MP3D_QUALITY_LOWEST;
+    mp3dec_core_set_governor(&self->core, target, max_quality);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp3dec_set_governor_obj, 2, 3, mp3dec_set_governor);
+
+// Usage: decoder.set_live(metaint=0, low=0, high=0)
+// Internet radio, before the first decode(): the stream is a socket (blocking
+// or not) positioned at the start of the response body. metaint is the
+// icy-metaint response header when the request sent "Icy-MetaData: 1"; the
+// metadata blocks are stripped and get_title() returns the latest title.
+// decode() returns None until the buffer holds high bytes (default 3/4 of
+// buf_size), and again after it ran below low bytes (default one frame)
+// with nothing to read; stats() counts these underruns.
+static mp_obj_t mp3dec_set_live(size_t n_args, const mp_obj_t *args) {
+    mp3dec_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    int metaint = (n_args > 1) ? mp_obj_get_int(args[1]) : 0;
+    int low = (n_args > 2) ? mp_obj_get_int(args[2]) : 0;
+    int high = (n_args > 3) ? mp_obj_get_int(args[3]) : 0;
+    mp3dec_core_set_live(&self->core, metaint > 0 ? metaint : 0, low > 0 ? low : 0, high > 0 ? high : 0);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp3dec_set_live_obj, 1, 4, mp3dec_set_live);
+
+// Usage: decoder.set_gapless(True)
+// Before the first decode(): drop the Xing/Info frame and, for LAME-encoded
+// files, the encoder delay and padding, so consecutive tracks join without a
+// gap. Files without the tag decode unchanged.
+static mp_obj_t mp3dec_set_gapless(mp_obj_t self_in, mp_obj_t enable_in) {
+    mp3dec_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp3dec_core_set_gapless(&self->core, mp_obj_is_true(enable_in));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(mp3dec_set_gapless_obj, mp3dec_set_gapless);
+
+// Usage: decoder.set_spectrum(bars=16, range_db=60)
+// Visualizer tap: decode() adds up the energy of the 32 subbands before
+// synthesis, so a spectrum costs almost nothing (no FFT). bars (1..32,
+// 0: off) groups the subbands with quadratic spacing, one per bar at the
+// bottom (689 Hz each at 44.1 kHz) and wider towards the top;
+// get_spectrum() reads the levels.
+static mp_obj_t mp3dec_set_spectrum(size_t n_args, const mp_obj_t *args) {
+    mp3dec_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    int bars = (n_args > 1) ? mp_obj_get_int(args[1]) : 16;
+    int range_db = (n_args > 2) ? mp_obj_get_int(args[2]) : 60;
+    mp3dec_core_set_spectrum(&self->core, bars, range_db);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp3dec_set_spectrum_obj, 1, 3, mp3dec_set_spectrum);
+
+// Usage: decoder.set_eq(gains_db) or decoder.set_eq(preset)
+// Equalizer on the 32 subbands, before synthesis: one multiply per sample,
+// changes ramped over a few granules. gains_db is a sequence of 1..32 gains
+// (dB, +-24) over groups of subbands spaced quadratically like the spectrum
+// bars: 32 is one per subband (689 Hz each at 44.1 kHz), fewer group the
+// top more. preset is
+// one of EQ_FLAT, EQ_BASS, EQ_TREBLE, EQ_VOCAL, EQ_ROCK. Boosts can clip:
+// lower the volume to make room.
+static mp_obj_t mp3dec_set_eq(mp_obj_t self_in, mp_obj_t gains_in) {
+    mp3dec_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (mp_obj_is_int(gains_in)) {
+        mp3dec_core_set_eq_preset(&self->core, mp_obj_get_int(gains_in));
+        return mp_const_none;
+    }
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_get_array(gains_in, &len, &items);
+    if (len > MP3DEC_SPECTRUM_BANDS) mp_raise_ValueError(MP_ERROR_TEXT("up to 32 gains"));
+    float db[MP3DEC_SPECTRUM_BANDS];
+    for (size_t i = 0; i < len; i++) db[i] = mp_obj_get_float(items[i]);
+    mp3dec_core_set_eq(&self->core, db, (int)len);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(mp3dec_set_eq_obj, mp3dec_set_eq);
+
+// Usage: decoder.set_tone(bass_db, treble_db)
+// Shelves on top of set_eq(): bass below ~1 kHz, treble above ~4 kHz
+static mp_obj_t mp3dec_set_tone(mp_obj_t self_in, mp_obj_t bass_in, mp_obj_t treble_in) {
+    mp3dec_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp3dec_core_set_tone(&self->core, mp_obj_get_float(bass_in), mp_obj_get_float(treble_in));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(mp3dec_set_tone_obj, mp3dec_set_tone);
+
+// Usage: n = decoder.get_spectrum(buf)
+// Levels since the previous call, 0..255 over -range_db..0 dBFS, written to
+// buf (bytearray of at least bars + 4): the bars, then peak L, RMS L, peak R
+// and RMS R (R = L for mono). Returns the bytes written, 0 with the tap off.
+static mp_obj_t mp3dec_get_spectrum(mp_obj_t self_in, mp_obj_t buf_in) {
+    mp3dec_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
+    int bars = self->core.spectrum.bars;
+    if (bars && bufinfo.len < (size_t)bars + MP3DEC_SPECTRUM_LEVELS) {
+        mp_raise_ValueError(MP_ERROR_TEXT("buffer too small"));
+    }
+    return MP_OBJ_NEW_SMALL_INT(mp3dec_core_read_spectrum(&self->core, bufinfo.buf, bufinfo.len));
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(mp3dec_get_spectrum_obj, mp3dec_get_spectrum);
+
 // --- Getters ---
 static mp_obj_t mp3dec_get_sample_rate(mp_obj_t self_in) {
     mp3dec_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    return MP_OBJ_NEW_SMALL_INT(self->info.hz);
+    return MP_OBJ_NEW_SMALL_INT(self->core.info.hz);
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(mp3dec_get_sample_rate_obj, mp3dec_get_sample_rate);
 
 static mp_obj_t mp3dec_get_bitrate(mp_obj_t self_in) {
     mp3dec_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    return MP_OBJ_NEW_SMALL_INT(self->info.bitrate_kbps);
+    return MP_OBJ_NEW_SMALL_INT(self->core.info.bitrate_kbps);
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(mp3dec_get_bitrate_obj, mp3dec_get_bitrate);
 
 static mp_obj_t mp3dec_get_channels(mp_obj_t self_in) {
     mp3dec_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    return MP_OBJ_NEW_SMALL_INT(self->info.channels);
+    return MP_OBJ_NEW_SMALL_INT(self->core.info.channels);
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(mp3dec_get_channels_obj, mp3dec_get_channels);
 
-// --- Method: scan (Precision Version) ---
-// Usage: decoder.scan(start_byte, start_time, target_time)
-static mp_obj_t mp3dec_scan(size_t n_args, const mp_obj_t *args) {
-    mp3dec_obj_t *self = MP_OBJ_TO_PTR(args[0]);
-    int start_offset = mp_obj_get_int(args[1]);
-    float start_time = mp_obj_get_float(args[2]); // NEW ARG
-    float target_sec = mp_obj_get_float(args[3]);
-
-    float scanned_time = self->current_sec;
-    bool perform_seek = false;
-
-    // DECISION LOGIC:
-    // 1. If going backwards (Target < Current), we MUST seek.
-    if (target_sec < scanned_time) perform_seek = true;
-    
-    // 2. If Python gave us a specific Checkpoint (start_time > 0), we MUST seek to it.
-    //    (Unless we are already past it and close to target, but relying on the checkpoint is safer)
-    if (start_time > 0.1f) perform_seek = true;
-    
-    // 3. If we are lost (Current == 0), we MUST seek.
-    if (scanned_time == 0.0f) perform_seek = true;
-
-    // EXECUTE SEEK
-    if (perform_seek) {
-        mp_obj_t seek_args[3] = {
-            mp_load_attr(self->stream, MP_QSTR_seek),
-            mp_obj_new_int(start_offset),
-            mp_obj_new_int(0)
-        };
-        mp_call_method_n_kw(0, 0, seek_args);
-
-        self->buf_valid = 0;
-        mp3dec_init(&self->mp3d);
-        
-        // CRITICAL FIX: Initialize time to the checkpoint time, not 0!
-        scanned_time = start_time;
-    }
+// Usage: decoder.get_title()
+// Latest ICY StreamTitle of a live stream, None before the first one
+static mp_obj_t mp3dec_get_title(mp_obj_t self_in) {
+    mp3dec_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    const char *title = self->core.live.title;
+    if (!title[0]) return mp_const_none;
+    return mp_obj_new_str(title, strlen(title));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(mp3dec_get_title_obj, mp3dec_get_title);
 
-    // FAST SCAN LOOP
-    while (1) {
-        if (self->buf_valid < self->file_buf_size - 512) {
-            size_t bytes_to_read = self->file_buf_size - self->buf_valid;
-            if (self->buf_valid > 0) {
-                memmove(self->file_buf, self->file_buf + (self->file_buf_size - bytes_to_read - self->buf_valid), self->buf_valid);
-            }
-            mp_obj_t read_method[2] = {
-                mp_load_attr(self->stream, MP_QSTR_readinto), 
-                mp_obj_new_bytearray_by_ref(bytes_to_read, self->file_buf + self->buf_valid)
-            };
-            mp_obj_t res = mp_call_method_n_kw(0, 0, read_method);
-            size_t bytes_read = mp_obj_get_int(res);
-            self->buf_valid += bytes_read;
-            if (bytes_read == 0 && self->buf_valid == 0) break; 
-        }
+// Usage: load, quality = decoder.get_load()
+// Average decode time per frame as a fraction of its duration, and the
+// quality level in use (0 = full)
+static mp_obj_t mp3dec_get_load(mp_obj_t self_in) {
+    mp3dec_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_obj_t items[2] = { mp_obj_new_float(self->core.load), MP_OBJ_NEW_SMALL_INT(self->core.mp3d.quality) };
+    return mp_obj_new_tuple(2, items);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(mp3dec_get_load_obj, mp3dec_get_load);
 
-        int samples = mp3dec_decode_frame(&self->mp3d, self->file_buf, self->buf_valid, NULL, &self->info);
-
-        if (samples > 0) {
-            if (self->info.hz > 0) {
-                float frame_dur = (float)samples / (float)self->info.hz;
-                if (scanned_time + frame_dur >= target_sec) {
-                    self->current_sec = scanned_time;
-                    return mp_const_true; 
-                }
-                scanned_time += frame_dur;
-            }
-            size_t consumed = self->info.frame_bytes;
-            if (consumed > self->buf_valid) consumed = self->buf_valid;
-            self->buf_valid -= consumed;
-            memmove(self->file_buf, self->file_buf + consumed, self->buf_valid);
+// --- Method: set_checkpoints ---
+// Usage: decoder.set_checkpoints(interval_sec, max_entries=64)
+// max_entries bounds the table memory (8 bytes each); when it fills up every
+// other entry is dropped and the interval doubles. max_entries=0 disables it.
+static mp_obj_t mp3dec_set_checkpoints(size_t n_args, const mp_obj_t *args) {
+    mp3dec_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    float interval = mp_obj_get_float(args[1]);
+    int max_entries = (n_args > 2) ? mp_obj_get_int(args[2]) : MP3DEC_DEFAULT_CP_MAX;
+    if (max_entries < 0) max_entries = 0;
+    if (max_entries == 1) max_entries = 2; // Decimation needs room for two entries
+
+    mp3dec_checkpoint_t *cp = self->core.cp;
+    if ((size_t)max_entries != self->core.cp_max) {
+        if (max_entries == 0) {
+            m_del(mp3dec_checkpoint_t, cp, self->core.cp_max);
+            cp = NULL;
         } else {
-            if (self->buf_valid > 0) {
-                self->buf_valid--;
-                memmove(self->file_buf, self->file_buf + 1, self->buf_valid);
-            } else {
-                break;
-            }
+            cp = m_renew(mp3dec_checkpoint_t, cp, self->core.cp_max, max_entries);
         }
     }
-    
-    self->current_sec = scanned_time;
-    return mp_const_false;
+    mp3dec_core_set_checkpoints(&self->core, cp, max_entries, interval);
+    return mp_const_none;
 }
-// CHANGED: Use MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN because we handle args manually now
-static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp3dec_scan_obj, 4, 4, mp3dec_scan);
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp3dec_set_checkpoints_obj, 2, 3, mp3dec_set_checkpoints);
+
+// --- Method: stats ---
+// Usage: decoder.stats(reset=False)
+// Decode health counters for this decoder: frames decoded by decode(),
+// frames muted for a missing bit reservoir, sync losses, bytes skipped while
+// resyncing, mid-stream format changes, the stream reads behind them, the
+// bytes moved by buffer compaction and, for live streams, underruns and the
+// ICY metadata bytes stripped. Bench builds add stack_peak and the heap
+// this decoder holds: obj_bytes (object with the minimp3 state), buf_bytes
+// (input buffer, 0 for in-memory sources) and cp_bytes (checkpoint table).
+static mp_obj_t mp3dec_stats(size_t n_args, const mp_obj_t *args) {
+    mp3dec_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp3dec_stats_t *st = &self->core.stats;
+    mp_obj_t dict = mp_obj_new_dict(12);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_frames), mp_obj_new_int_from_uint(st->frames));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_reservoir_miss), mp_obj_new_int_from_uint(st->reservoir_miss));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_sync_losses), mp_obj_new_int_from_uint(st->sync_losses));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_bytes_skipped), mp_obj_new_int_from_uint(st->bytes_skipped));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_format_changes), mp_obj_new_int_from_uint(st->format_changes));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_bytes_read), mp_obj_new_int_from_uint(st->bytes_read));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_refills), mp_obj_new_int_from_uint(st->refills));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_avg_refill), mp_obj_new_int_from_uint(st->refills ? st->bytes_read / st->refills : 0));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_bytes_moved), mp_obj_new_int_from_uint(st->bytes_moved));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_underruns), mp_obj_new_int_from_uint(st->underruns));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_meta_bytes), mp_obj_new_int_from_uint(st->meta_bytes));
+#ifdef MP3DEC_BENCH
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_stack_peak), mp_obj_new_int_from_uint(st->stack_peak));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_obj_bytes), mp_obj_new_int_from_uint(sizeof(mp3dec_obj_t)));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_buf_bytes), mp_obj_new_int_from_uint(self->core.in_memory ? 0 : self->core.file_buf_size));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_cp_bytes), mp_obj_new_int_from_uint(self->core.cp_max * sizeof(mp3dec_checkpoint_t)));
+#endif // MP3DEC_BENCH
+    if ((n_args > 1) && mp_obj_is_true(args[1])) {
+        mp3dec_core_reset_stats(&self->core);
+    }
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp3dec_stats_obj, 1, 2, mp3dec_stats);
+
+#ifdef MINIMP3_PROFILE
+// --- Method: get_profile ---
+// Usage: decoder.get_profile(reset=False)
+// Clock ticks spent per decoding stage since the last reset, summed over all
+// decoders (build with MP3DEC_PROFILE). 'clock_hz' is the tick rate; 0 means
+// CPU cycles, so divide by machine.freq().
+static const qstr mp3dec_profile_names[MP3D_PROF_STAGES] = {
+    MP_QSTR_refill, MP_QSTR_sync, MP_QSTR_side_info, MP_QSTR_scalefactors, MP_QSTR_huffman,
+    MP_QSTR_stereo, MP_QSTR_imdct, MP_QSTR_synth, MP_QSTR_post,
+};
+
+static mp_obj_t mp3dec_get_profile(size_t n_args, const mp_obj_t *args) {
+    bool reset = (n_args > 1) && mp_obj_is_true(args[1]);
+    mp_obj_t dict = mp_obj_new_dict(MP3D_PROF_STAGES + 1);
+    for (int i = 0; i < MP3D_PROF_STAGES; i++) {
+        mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(mp3dec_profile_names[i]), mp_obj_new_int_from_ull(mp3d_profile_ticks[i]));
+    }
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_clock_hz), mp_obj_new_int_from_uint(mp3dec_core_profile_hz()));
+    if (reset) memset(mp3d_profile_ticks, 0, sizeof(mp3d_profile_ticks));
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp3dec_get_profile_obj, 1, 2, mp3dec_get_profile);
+#endif // MINIMP3_PROFILE
+
+// --- Method: scan (Precision Version) ---
+// Usage: decoder.scan(target_time)
+//        decoder.scan(start_byte, start_time, target_time)
+// Returns True once positioned on the frame containing target_time, False at End of File
+static mp_obj_t mp3dec_scan(size_t n_args, const mp_obj_t *args) {
+    mp3dec_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    int res;
+    if (n_args == 2) {
+        res = mp3dec_core_scan(&self->core, false, 0, 0.0f, mp_obj_get_float(args[1]));
+    } else if (n_args == 4) {
+        int start_offset = mp_obj_get_int(args[1]);
+        float start_time = mp_obj_get_float(args[2]);
+        float target_sec = mp_obj_get_float(args[3]);
+        res = mp3dec_core_scan(&self->core, true, start_offset, start_time, target_sec);
+    } else {
+        mp_raise_TypeError(MP_ERROR_TEXT("scan(target) or scan(start_byte, start_time, target)"));
+    }
+    mp3dec_check(res);
+    return mp_obj_new_bool(res);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp3dec_scan_obj, 2, 4, mp3dec_scan);
+
+// Usage: n = decoder.overview(buf, interval=0, range_db=60)
+// Loudness overview (a waveform display) without decoding: one level per
+// interval seconds from each frame's side info, 0..255 over -range_db..0
+// dBFS like get_spectrum(), written to buf (bytearray). interval 0 fits the
+// whole file into buf (len(buf)/2..len(buf) levels). Many times faster than
+// decode(), within a few dB of the decoded level. Rewinds to the start
+// (checkpoints recorded on the way); returns the levels written.
+static mp_obj_t mp3dec_overview(size_t n_args, const mp_obj_t *args) {
+    mp3dec_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_WRITE);
+    float interval = (n_args > 2) ? mp_obj_get_float(args[2]) : 0.0f;
+    int range_db = (n_args > 3) ? mp_obj_get_int(args[3]) : 60;
+    int res = mp3dec_core_overview(&self->core, bufinfo.buf, bufinfo.len, interval, range_db);
+    mp3dec_check(res);
+    return MP_OBJ_NEW_SMALL_INT(res);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp3dec_overview_obj, 2, 4, mp3dec_overview);
 
 // --- Module Map ---
 static const mp_rom_map_elem_t mp3dec_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_decode), MP_ROM_PTR(&mp3dec_decode_obj) },
     { MP_ROM_QSTR(MP_QSTR_scan), MP_ROM_PTR(&mp3dec_scan_obj) },    // <--- Added this
+    { MP_ROM_QSTR(MP_QSTR_overview), MP_ROM_PTR(&mp3dec_overview_obj) },
     { MP_ROM_QSTR(MP_QSTR_seek), MP_ROM_PTR(&mp3dec_seek_obj) },
     { MP_ROM_QSTR(MP_QSTR_tell), MP_ROM_PTR(&mp3dec_tell_obj) },
+    { MP_ROM_QSTR(MP_QSTR_snapshot), MP_ROM_PTR(&mp3dec_snapshot_obj) },
+    { MP_ROM_QSTR(MP_QSTR_restore), MP_ROM_PTR(&mp3dec_restore_obj) },
     { MP_ROM_QSTR(MP_QSTR_set_volume), MP_ROM_PTR(&mp3dec_set_volume_obj) },
     { MP_ROM_QSTR(MP_QSTR_set_mono), MP_ROM_PTR(&mp3dec_set_mono_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_sync_matches), MP_ROM_PTR(&mp3dec_set_sync_matches_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_checkpoints), MP_ROM_PTR(&mp3dec_set_checkpoints_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_governor), MP_ROM_PTR(&mp3dec_set_governor_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_live), MP_ROM_PTR(&mp3dec_set_live_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_gapless), MP_ROM_PTR(&mp3dec_set_gapless_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_spectrum), MP_ROM_PTR(&mp3dec_set_spectrum_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_eq), MP_ROM_PTR(&mp3dec_set_eq_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_tone), MP_ROM_PTR(&mp3dec_set_tone_obj) },
     { MP_ROM_QSTR(MP_QSTR_get_sample_rate), MP_ROM_PTR(&mp3dec_get_sample_rate_obj) },
     { MP_ROM_QSTR(MP_QSTR_get_bitrate), MP_ROM_PTR(&mp3dec_get_bitrate_obj) },
     { MP_ROM_QSTR(MP_QSTR_get_channels), MP_ROM_PTR(&mp3dec_get_channels_obj) },
+    { MP_ROM_QSTR(MP_QSTR_get_load), MP_ROM_PTR(&mp3dec_get_load_obj) },
+    { MP_ROM_QSTR(MP_QSTR_get_title), MP_ROM_PTR(&mp3dec_get_title_obj) },
+    { MP_ROM_QSTR(MP_QSTR_get_spectrum), MP_ROM_PTR(&mp3dec_get_spectrum_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&mp3dec_stats_obj) },
+#ifdef MINIMP3_PROFILE
+    { MP_ROM_QSTR(MP_QSTR_get_profile), MP_ROM_PTR(&mp3dec_get_profile_obj) },
+#endif // MINIMP3_PROFILE
 };
 static MP_DEFINE_CONST_DICT(mp3dec_locals_dict, mp3dec_locals_dict_table);
 
@@ -302,9 +504,354 @@ MP_DEFINE_CONST_OBJ_TYPE(
     locals_dict, &mp3dec_locals_dict
 );
 
+// --- Mixer ---
+// Usage: mixer = Mixer(channels=2)
+//        voice = mixer.add(decoder, gain=1.0, pan=0.0)
+//        n = mixer.mix(out_buf)
+// Mixes up to 8 decoders (e.g. music plus sound effects) into out_buf, one
+// buffer of int16 frames of `channels` samples per call. Mono and stereo
+// decoders are adapted to the output, summed in 32 bits and saturated once.
+// A voice is released when its decoder reaches the end (or has another
+// sample rate than the mixer); decoders keep their own volume/mono
+// settings and must not be decoded directly while they are voices.
+typedef struct _mp3dec_mixer_obj_t {
+    mp_obj_base_t base;
+    mp_obj_t decoders[MP3DEC_MIXER_MAX_VOICES]; // Keeps the voices alive (MP_OBJ_NULL: free)
+    int16_t *pcm[MP3DEC_MIXER_MAX_VOICES];      // Frame buffers, allocated on first use of a voice
+    mp3dec_mixer_t mixer;
+} mp3dec_mixer_obj_t;
+
+const mp_obj_type_t mp3dec_mixer_type;
+
+static mp_obj_t mp3dec_mix_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 0, 1, false);
+    mp3dec_mixer_obj_t *self = m_new_obj(mp3dec_mixer_obj_t);
+    memset(self, 0, sizeof(*self));
+    self->base.type = &mp3dec_mixer_type;
+    mp3dec_mixer_init(&self->mixer, (n_args > 0) ? mp_obj_get_int(args[0]) : 2);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static int mp3dec_mix_voice_arg(mp_obj_t voice_in) {
+    int voice = mp_obj_get_int(voice_in);
+    if (voice < 0 || voice >= MP3DEC_MIXER_MAX_VOICES) {
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid voice"));
+    }
+    return voice;
+}
+
+// Forget the decoders of voices the mixer released
+static void mp3dec_mix_sync(mp3dec_mixer_obj_t *self) {
+    for (int i = 0; i < MP3DEC_MIXER_MAX_VOICES; i++) {
+        if (!self->mixer.voices[i].core) self->decoders[i] = MP_OBJ_NULL;
+    }
+}
+
+// Usage: mixer.add(decoder, gain=1.0, pan=0.0)
+// Returns the voice number for set_gain()/set_matrix()/remove()
+static mp_obj_t mp3dec_mix_add(size_t n_args, const mp_obj_t *args) {
+    mp3dec_mixer_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    if (!mp_obj_is_type(args[1], &mp3dec_type)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("expected an MP3Decoder"));
+    }
+    mp3dec_obj_t *dec = MP_OBJ_TO_PTR(args[1]);
+    mp3dec_mix_sync(self);
+    for (int i = 0; i < MP3DEC_MIXER_MAX_VOICES; i++) {
+        if (self->decoders[i] == args[1]) mp_raise_ValueError(MP_ERROR_TEXT("decoder already playing"));
+    }
+
+    // A frame buffer first, a free voice's if it has one; the mixer says
+    // which voice it took, and that voice keeps the buffer
+    int slot = 0;
+    while (slot < MP3DEC_MIXER_MAX_VOICES && self->decoders[slot] != MP_OBJ_NULL) slot++;
+    if (slot == MP3DEC_MIXER_MAX_VOICES) mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("no free voice"));
+    if (!self->pcm[slot]) self->pcm[slot] = m_new(int16_t, MINIMP3_MAX_SAMPLES_PER_FRAME);
+    int16_t *pcm = self->pcm[slot];
+    int voice = mp3dec_mixer_add(&self->mixer, &dec->core, pcm);
+    if (voice < 0) mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("no free voice"));
+    self->pcm[slot] = self->pcm[voice]; // Free in the mixer, so unused
+    self->pcm[voice] = pcm;
+    self->decoders[voice] = args[1];
+
+    float gain = (n_args > 2) ? mp_obj_get_float(args[2]) : 1.0f;
+    float pan = (n_args > 3) ? mp_obj_get_float(args[3]) : 0.0f;
+    mp3dec_mixer_set_gain(&self->mixer, voice, gain, pan);
+    return MP_OBJ_NEW_SMALL_INT(voice);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp3dec_mix_add_obj, 2, 4, mp3dec_mix_add);
+
+static mp_obj_t mp3dec_mix_remove(mp_obj_t self_in, mp_obj_t voice_in) {
+    mp3dec_mixer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    int voice = mp3dec_mix_voice_arg(voice_in);
+    mp3dec_mixer_remove(&self->mixer, voice);
+    self->decoders[voice] = MP_OBJ_NULL;
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(mp3dec_mix_remove_obj, mp3dec_mix_remove);
+
+// Usage: mixer.set_gain(voice, gain, pan=0.0)
+// gain 0..2, pan -1 (left only) .. 1 (right only)
+static mp_obj_t mp3dec_mix_set_gain(size_t n_args, const mp_obj_t *args) {
+    mp3dec_mixer_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    float pan = (n_args > 3) ? mp_obj_get_float(args[3]) : 0.0f;
+    mp3dec_mixer_set_gain(&self->mixer, mp3dec_mix_voice_arg(args[1]), mp_obj_get_float(args[2]), pan);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp3dec_mix_set_gain_obj, 3, 4, mp3dec_mix_set_gain);
+
+// Usage: mixer.set_matrix(voice, ll, lr, rl, rr)
+// Channel mapping: left = ll*L + lr*R, right = rl*L + rr*R (-2..2 each),
+// e.g. (0, 1, 1, 0) swaps the channels, (0.5, 0.5, 0.5, 0.5) mixes to mono
+static mp_obj_t mp3dec_mix_set_matrix(size_t n_args, const mp_obj_t *args) {
+    mp3dec_mixer_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp3dec_mixer_set_matrix(&self->mixer, mp3dec_mix_voice_arg(args[1]), mp_obj_get_float(args[2]),
+        mp_obj_get_float(args[3]), mp_obj_get_float(args[4]), mp_obj_get_float(args[5]));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp3dec_mix_set_matrix_obj, 6, 6, mp3dec_mix_set_matrix);
+
+// Usage: mixer.mix(out_buf)
+// Returns bytes written: all of out_buf (whole frames) while voices play,
+// less where the last one ended, 0 when none is left
+static mp_obj_t mp3dec_mix_mix(mp_obj_t self_in, mp_obj_t out_buf_in) {
+    mp3dec_mixer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(out_buf_in, &bufinfo, MP_BUFFER_WRITE);
+    size_t frame_bytes = self->mixer.channels * sizeof(int16_t);
+    size_t frames = mp3dec_mixer_mix(&self->mixer, (int16_t *)bufinfo.buf, bufinfo.len / frame_bytes);
+    mp3dec_mix_sync(self);
+    return MP_OBJ_NEW_SMALL_INT(frames * frame_bytes);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(mp3dec_mix_mix_obj, mp3dec_mix_mix);
+
+// Number of voices playing
+static mp_obj_t mp3dec_mix_active(mp_obj_t self_in) {
+    mp3dec_mixer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(mp3dec_mixer_active(&self->mixer));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(mp3dec_mix_active_obj, mp3dec_mix_active);
+
+// Output sample rate (set by the first voice, 0 before any audio)
+static mp_obj_t mp3dec_mix_get_sample_rate(mp_obj_t self_in) {
+    mp3dec_mixer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(self->mixer.hz);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(mp3dec_mix_get_sample_rate_obj, mp3dec_mix_get_sample_rate);
+
+// Usage: mixer.stats(reset=False)
+// Sample frames mixed, output samples clipped and voices dropped for their sample rate
+static mp_obj_t mp3dec_mix_stats(size_t n_args, const mp_obj_t *args) {
+    mp3dec_mixer_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp3dec_mixer_t *m = &self->mixer;
+    mp_obj_t dict = mp_obj_new_dict(3);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_frames), mp_obj_new_int_from_uint(m->frames));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_clipped), mp_obj_new_int_from_uint(m->clipped));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_rate_drops), mp_obj_new_int_from_uint(m->rate_drops));
+    if ((n_args > 1) && mp_obj_is_true(args[1])) {
+        m->frames = m->clipped = m->rate_drops = 0;
+    }
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp3dec_mix_stats_obj, 1, 2, mp3dec_mix_stats);
+
+static const mp_rom_map_elem_t mp3dec_mix_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_add), MP_ROM_PTR(&mp3dec_mix_add_obj) },
+    { MP_ROM_QSTR(MP_QSTR_remove), MP_ROM_PTR(&mp3dec_mix_remove_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_gain), MP_ROM_PTR(&mp3dec_mix_set_gain_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_matrix), MP_ROM_PTR(&mp3dec_mix_set_matrix_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mix), MP_ROM_PTR(&mp3dec_mix_mix_obj) },
+    { MP_ROM_QSTR(MP_QSTR_active), MP_ROM_PTR(&mp3dec_mix_active_obj) },
+    { MP_ROM_QSTR(MP_QSTR_get_sample_rate), MP_ROM_PTR(&mp3dec_mix_get_sample_rate_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&mp3dec_mix_stats_obj) },
+};
+static MP_DEFINE_CONST_DICT(mp3dec_mix_locals_dict, mp3dec_mix_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    mp3dec_mixer_type,
+    MP_QSTR_Mixer,
+    MP_TYPE_FLAG_NONE,
+    make_new, mp3dec_mix_make_new,
+    locals_dict, &mp3dec_mix_locals_dict
+);
+
+// --- Playlist ---
+// Usage: playlist = Playlist(channels=2)
+//        playlist.append(MP3Decoder(open('a.mp3', 'rb')))
+//        n = playlist.decode(out_buf)
+// Plays the appended decoders one after the other into out_buf, with no gap
+// between tracks and no work for Python at a transition: the next decoder is
+// read, synced and primed while the current one plays, and its first samples
+// follow the last ones of the current track in the same buffer. Decoders are
+// switched to gapless mode (see set_gapless()); set_crossfade() overlaps the
+// tracks instead. Up to 4 tracks are queued after the current one; append
+// more as pending() goes down.
+#define MP3DEC_PLAYLIST_SLOTS (MP3DEC_PLAYLIST_MAX + 2) // Queue, current and fading track
+
+typedef struct _mp3dec_playlist_obj_t {
+    mp_obj_base_t base;
+    mp_obj_t decoders[MP3DEC_PLAYLIST_SLOTS]; // Keeps the tracks alive (MP_OBJ_NULL: free)
+    int16_t *pcm[MP3DEC_PLAYLIST_SLOTS];      // Frame buffers, allocated on first use of a slot
+    mp3dec_playlist_t playlist;
+} mp3dec_playlist_obj_t;
+
+const mp_obj_type_t mp3dec_playlist_type;
+
+static mp_obj_t mp3dec_pl_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 0, 1, false);
+    mp3dec_playlist_obj_t *self = m_new_obj(mp3dec_playlist_obj_t);
+    memset(self, 0, sizeof(*self));
+    self->base.type = &mp3dec_playlist_type;
+    mp3dec_playlist_init(&self->playlist, (n_args > 0) ? mp_obj_get_int(args[0]) : 2);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+// Forget the decoders of tracks that finished or were skipped
+static void mp3dec_pl_sync(mp3dec_playlist_obj_t *self) {
+    for (int i = 0; i < MP3DEC_PLAYLIST_SLOTS; i++) {
+        if (self->decoders[i] == MP_OBJ_NULL) continue;
+        mp3dec_obj_t *dec = MP_OBJ_TO_PTR(self->decoders[i]);
+        if (!mp3dec_playlist_uses(&self->playlist, &dec->core)) self->decoders[i] = MP_OBJ_NULL;
+    }
+}
+
+// Usage: playlist.append(decoder)
+// decoder: a new MP3Decoder, not decoded yet
+static mp_obj_t mp3dec_pl_append(mp_obj_t self_in, mp_obj_t dec_in) {
+    mp3dec_playlist_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (!mp_obj_is_type(dec_in, &mp3dec_type)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("expected an MP3Decoder"));
+    }
+    mp3dec_obj_t *dec = MP_OBJ_TO_PTR(dec_in);
+    mp3dec_pl_sync(self);
+    if (mp3dec_playlist_uses(&self->playlist, &dec->core)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("decoder already queued"));
+    }
+    if (self->playlist.queued == MP3DEC_PLAYLIST_MAX) {
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("playlist full"));
+    }
+
+    int slot = 0;
+    while (self->decoders[slot] != MP_OBJ_NULL) slot++; // Queue + 2 slots: one is free
+    if (!self->pcm[slot]) self->pcm[slot] = m_new(int16_t, MINIMP3_MAX_SAMPLES_PER_FRAME);
+    mp3dec_playlist_append(&self->playlist, &dec->core, self->pcm[slot]);
+    self->decoders[slot] = dec_in;
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(mp3dec_pl_append_obj, mp3dec_pl_append);
+
+// Usage: playlist.set_crossfade(seconds)
+// Overlap the end of a track with the start of the next on an equal-power
+// curve (0: gapless join, the default). Needs the track length from the
+// LAME/Xing tag: untagged tracks are joined without a crossfade.
+static mp_obj_t mp3dec_pl_set_crossfade(mp_obj_t self_in, mp_obj_t sec_in) {
+    mp3dec_playlist_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp3dec_playlist_set_crossfade(&self->playlist, mp_obj_get_float(sec_in));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(mp3dec_pl_set_crossfade_obj, mp3dec_pl_set_crossfade);
+
+// Usage: playlist.decode(out_buf)
+// Returns bytes written: all of out_buf (whole frames) while tracks play,
+// less at the end of the playlist or before a track with another sample rate
+// (get_sample_rate() changes with the next call), 0 when nothing is left
+static mp_obj_t mp3dec_pl_decode(mp_obj_t self_in, mp_obj_t out_buf_in) {
+    mp3dec_playlist_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(out_buf_in, &bufinfo, MP_BUFFER_WRITE);
+    size_t frame_bytes = self->playlist.mixer.channels * sizeof(int16_t);
+    size_t frames = mp3dec_playlist_decode(&self->playlist, (int16_t *)bufinfo.buf, bufinfo.len / frame_bytes);
+    mp3dec_pl_sync(self);
+    return MP_OBJ_NEW_SMALL_INT(frames * frame_bytes);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(mp3dec_pl_decode_obj, mp3dec_pl_decode);
+
+// End the current track now; decode() continues with the next one
+static mp_obj_t mp3dec_pl_skip(mp_obj_t self_in) {
+    mp3dec_playlist_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp3dec_playlist_skip(&self->playlist);
+    mp3dec_pl_sync(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(mp3dec_pl_skip_obj, mp3dec_pl_skip);
+
+// Number of tracks queued after the current one
+static mp_obj_t mp3dec_pl_pending(mp_obj_t self_in) {
+    mp3dec_playlist_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(self->playlist.queued);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(mp3dec_pl_pending_obj, mp3dec_pl_pending);
+
+// The decoder of the current track (e.g. for tell() or get_title()), None
+// before the first and after the last
+static mp_obj_t mp3dec_pl_current(mp_obj_t self_in) {
+    mp3dec_playlist_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp3dec_core_t *core = mp3dec_playlist_current(&self->playlist);
+    for (int i = 0; core && i < MP3DEC_PLAYLIST_SLOTS; i++) {
+        if (self->decoders[i] == MP_OBJ_NULL) continue;
+        mp3dec_obj_t *dec = MP_OBJ_TO_PTR(self->decoders[i]);
+        if (&dec->core == core) return self->decoders[i];
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(mp3dec_pl_current_obj, mp3dec_pl_current);
+
+// Output sample rate (the current track's, 0 before any audio)
+static mp_obj_t mp3dec_pl_get_sample_rate(mp_obj_t self_in) {
+    mp3dec_playlist_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(self->playlist.mixer.hz);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(mp3dec_pl_get_sample_rate_obj, mp3dec_pl_get_sample_rate);
+
+// Usage: playlist.stats(reset=False)
+// Tracks started, crossfades, sample frames written, samples clipped (in
+// crossfades) and tracks cut short by a sample rate change mid-track
+static mp_obj_t mp3dec_pl_stats(size_t n_args, const mp_obj_t *args) {
+    mp3dec_playlist_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp3dec_playlist_t *pl = &self->playlist;
+    mp_obj_t dict = mp_obj_new_dict(5);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_tracks), mp_obj_new_int_from_uint(pl->tracks));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_crossfades), mp_obj_new_int_from_uint(pl->crossfades));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_frames), mp_obj_new_int_from_uint(pl->mixer.frames));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_clipped), mp_obj_new_int_from_uint(pl->mixer.clipped));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_rate_drops), mp_obj_new_int_from_uint(pl->mixer.rate_drops));
+    if ((n_args > 1) && mp_obj_is_true(args[1])) {
+        pl->tracks = pl->crossfades = 0;
+        pl->mixer.frames = pl->mixer.clipped = pl->mixer.rate_drops = 0;
+    }
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp3dec_pl_stats_obj, 1, 2, mp3dec_pl_stats);
+
+static const mp_rom_map_elem_t mp3dec_pl_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_append), MP_ROM_PTR(&mp3dec_pl_append_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_crossfade), MP_ROM_PTR(&mp3dec_pl_set_crossfade_obj) },
+    { MP_ROM_QSTR(MP_QSTR_decode), MP_ROM_PTR(&mp3dec_pl_decode_obj) },
+    { MP_ROM_QSTR(MP_QSTR_skip), MP_ROM_PTR(&mp3dec_pl_skip_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pending), MP_ROM_PTR(&mp3dec_pl_pending_obj) },
+    { MP_ROM_QSTR(MP_QSTR_current), MP_ROM_PTR(&mp3dec_pl_current_obj) },
+    { MP_ROM_QSTR(MP_QSTR_get_sample_rate), MP_ROM_PTR(&mp3dec_pl_get_sample_rate_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&mp3dec_pl_stats_obj) },
+};
+static MP_DEFINE_CONST_DICT(mp3dec_pl_locals_dict, mp3dec_pl_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    mp3dec_playlist_type,
+    MP_QSTR_Playlist,
+    MP_TYPE_FLAG_NONE,
+    make_new, mp3dec_pl_make_new,
+    locals_dict, &mp3dec_pl_locals_dict
+);
+
 static const mp_rom_map_elem_t mp3dec_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_mp3dec) },
     { MP_ROM_QSTR(MP_QSTR_MP3Decoder), MP_ROM_PTR(&mp3dec_type) },
+    { MP_ROM_QSTR(MP_QSTR_Mixer), MP_ROM_PTR(&mp3dec_mixer_type) },
+    { MP_ROM_QSTR(MP_QSTR_Playlist), MP_ROM_PTR(&mp3dec_playlist_type) },
+    { MP_ROM_QSTR(MP_QSTR_EQ_FLAT), MP_ROM_INT(MP3DEC_EQ_FLAT) },
+    { MP_ROM_QSTR(MP_QSTR_EQ_BASS), MP_ROM_INT(MP3DEC_EQ_BASS) },
+    { MP_ROM_QSTR(MP_QSTR_EQ_TREBLE), MP_ROM_INT(MP3DEC_EQ_TREBLE) },
+    { MP_ROM_QSTR(MP_QSTR_EQ_VOCAL), MP_ROM_INT(MP3DEC_EQ_VOCAL) },
+    { MP_ROM_QSTR(MP_QSTR_EQ_ROCK), MP_ROM_INT(MP3DEC_EQ_ROCK) },
 };
 static MP_DEFINE_CONST_DICT(mp3dec_globals, mp3dec_globals_table);
 
@@ -0,0 +1,1144 @@
+#define MINIMP3_IMPLEMENTATION
+#include "mp3dec_core.h"
+#include <string.h>
+
+#ifdef MP3DEC_BENCH
+#define MP3DEC_NOINLINE __attribute__((noinline))
+#endif // MP3DEC_BENCH
+
+// --- Init ---
+void mp3dec_core_init(mp3dec_core_t *self, const mp3dec_core_io_t *io, uint8_t *buf, size_t buf_size,
+    mp3dec_checkpoint_t *cp, size_t cp_max) {
+    memset(self, 0, sizeof(*self));
+    mp3dec_init(&self->mp3d);
+    self->io = *io;
+
+    self->file_buf = buf;
+    self->file_buf_size = buf_size;
+    self->small_buf = buf_size < MP3DEC_SMALL_BUF_SIZE;
+    self->volume = 100;
+    self->pos_exact = true;
+
+    self->cp = cp;
+    self->cp_max = cp_max;
+    self->cp_interval = MP3DEC_DEFAULT_CP_INTERVAL;
+    self->gov_max = MP3D_QUALITY_LOWEST;
+}
+
+void mp3dec_core_init_mem(mp3dec_core_t *self, const mp3dec_core_io_t *io, const uint8_t *data, size_t len,
+    mp3dec_checkpoint_t *cp, size_t cp_max) {
+    mp3dec_core_init(self, io, (uint8_t *)data, len, cp, cp_max); // Never written in memory mode
+    self->in_memory = true;
+    self->small_buf = false; // The whole sync chain is always in view
+    self->buf_valid = len;
+    self->stream_pos = len;
+}
+
+// --- Stream Helpers ---
+// While hunting for sync keep the buffer nearly full so the frame chain check
+// sees plenty of frames. Once locked, wait until half of it is used: each
+// byte is then moved at most once by the compaction in mp3dec_refill().
+static size_t mp3dec_frame_need(mp3dec_core_t *self);
+
+static bool mp3dec_need_refill(mp3dec_core_t *self) {
+    size_t low_water = self->file_buf_size - self->file_buf_size / 16; // Safe margin for headers (512 of 8 KB)
+    size_t need = mp3dec_frame_need(self);
+    if (need) {
+        size_t half = self->file_buf_size / 2;
+        if (need < low_water) low_water = (need > half) ? need : half;
+    }
+    return self->buf_valid < low_water;
+}
+
+// Locked: bytes needed for the next frame plus the header after it
+// (0 if not locked or the buffer does not start with a matching header)
+static size_t mp3dec_frame_need(mp3dec_core_t *self) {
+    const uint8_t *next = self->file_buf + self->buf_pos;
+    if (self->mp3d.header[0] != 0xff || self->buf_valid < HDR_SIZE || !hdr_compare(self->mp3d.header, next)) {
+        return 0;
+    }
+    return hdr_frame_bytes(next, self->mp3d.free_format_bytes) + hdr_padding(next) + HDR_SIZE;
+}
+
+// Pull StreamTitle='...'; out of the head of a finished ICY metadata block
+static void mp3dec_icy_parse(mp3dec_live_t *live) {
+    static const char key[] = "StreamTitle='";
+    const size_t key_len = sizeof(key) - 1;
+    for (size_t i = 0; i + key_len <= live->meta_len; i++) {
+        if (memcmp(live->meta + i, key, key_len) != 0) continue;
+        size_t start = i + key_len, end = start;
+        // The title may contain quotes: it ends at "';" (or where the kept head ends)
+        while (end < live->meta_len && !(live->meta[end] == '\''
+               && (end + 1 == live->meta_len || live->meta[end + 1] == ';'))) {
+            end++;
+        }
+        size_t n = end - start;
+        if (n > MP3DEC_ICY_TITLE_MAX) n = MP3DEC_ICY_TITLE_MAX;
+        memcpy(live->title, live->meta + start, n);
+        live->title[n] = '\0';
+        return;
+    }
+}
+
+// ICY streams: drop the metadata blocks (a length byte, then 16 * length
+// bytes) from n bytes just read to buf, in place. Returns the audio bytes left.
+static size_t mp3dec_icy_strip(mp3dec_core_t *self, uint8_t *buf, size_t n) {
+    mp3dec_live_t *live = &self->live;
+    size_t in = 0, out = 0;
+    while (in < n) {
+        size_t run = n - in;
+        if (live->audio_left > 0) {
+            // Audio: keep it, closing the gap left by earlier metadata
+            if (run > live->audio_left) run = live->audio_left;
+            if (out != in) memmove(buf + out, buf + in, run);
+            out += run;
+            live->audio_left -= run;
+        } else if (live->meta_left == 0) {
+            // Length byte (0: no new metadata this time)
+            live->meta_left = (uint16_t)(buf[in] * 16);
+            live->meta_len = 0;
+            if (live->meta_left == 0) live->audio_left = live->metaint;
+            run = 1;
+        } else {
+            // Metadata: keep the head for the title, skip the rest
+            if (run > live->meta_left) run = live->meta_left;
+            size_t keep = sizeof(live->meta) - live->meta_len;
+            if (keep > run) keep = run;
+            memcpy(live->meta + live->meta_len, buf + in, keep);
+            live->meta_len += (uint16_t)keep;
+            live->meta_left -= (uint16_t)run;
+            if (live->meta_left == 0) {
+                mp3dec_icy_parse(live);
+                live->audio_left = live->metaint;
+            }
+        }
+        in += run;
+    }
+    self->stats.meta_bytes += (uint32_t)(n - out);
+    return out;
+}
+
+// Top up file_buf from the stream, reading at most max_bytes.
+// Returns bytes read (0 = EOF, or no data yet on a live stream).
+static size_t mp3dec_refill(mp3dec_core_t *self, size_t max_bytes) {
+    if (self->in_memory) return 0; // Everything is buffered already
+
+    // Compact: move the unconsumed tail to the front
+    if (self->buf_pos > 0) {
+        memmove(self->file_buf, self->file_buf + self->buf_pos, self->buf_valid);
+        self->stats.bytes_moved += self->buf_valid;
+        self->buf_pos = 0;
+    }
+    size_t bytes_to_read = self->file_buf_size - self->buf_valid;
+    if (bytes_to_read > max_bytes) bytes_to_read = max_bytes;
+    if (bytes_to_read == 0) return 0;
+    uint8_t *dst = self->file_buf + self->buf_valid;
+    size_t bytes_read;
+    do {
+        bytes_read = self->io.read(self->io.ctx, dst, bytes_to_read);
+        if (bytes_read == MP3DEC_IO_AGAIN) return 0;
+        if (bytes_read == 0) {
+            self->live.eof = true;
+            return 0;
+        }
+        self->stats.bytes_read += bytes_read;
+        self->stats.refills++;
+        if (self->live.metaint) bytes_read = mp3dec_icy_strip(self, dst, bytes_read);
+    } while (bytes_read == 0); // Nothing but metadata: read on
+    self->buf_valid += bytes_read;
+    self->stream_pos += bytes_read; // Audio bytes: offsets skip the metadata
+    return bytes_read;
+}
+
+// Follow the header chain from buf the way mp3d_match_frame() does.
+// Returns 1 once `matches` headers matched, 0 on a mismatch and -1 when the
+// buffer ends first, with *need = bytes required to see the next header.
+// *verified counts the headers that matched.
+static int mp3dec_walk_chain(const uint8_t *buf, size_t n, int matches, int *verified, size_t *need) {
+    size_t pos = 0;
+    int m;
+    for (m = 0; m < matches; m++) {
+        const uint8_t *h = buf + pos;
+        pos += hdr_frame_bytes(h, 0) + hdr_padding(h);
+        if (pos + HDR_SIZE > n) {
+            *verified = m;
+            *need = pos + HDR_SIZE;
+            return -1;
+        }
+        if (!hdr_compare(buf, buf + pos)) {
+            *verified = m;
+            return 0;
+        }
+    }
+    *verified = matches;
+    return 1;
+}
+
+// Bytes that must be buffered before mp3d_find_frame() can accept or reject
+// its first candidate header without running out of data (0 = decidable now).
+// *cand / *verified: offset of that candidate and headers matched behind it.
+// Fast start uses this to decode the first frame after reading little more
+// than (sync_matches + 1) frames instead of a full buffer.
+static size_t mp3dec_sync_need(mp3dec_core_t *self, size_t *cand, int *verified) {
+    const uint8_t *buf = self->file_buf + self->buf_pos;
+    size_t n = self->buf_valid, p, need;
+    int matches = self->mp3d.sync_matches;
+
+    for (p = 0; p + HDR_SIZE <= n; p++) {
+        if (!hdr_valid(buf + p)) continue;
+        *cand = p;
+        *verified = 0;
+        if (!hdr_frame_bytes(buf + p, 0)) return self->file_buf_size; // Free format: fill up as usual
+
+        int res = mp3dec_walk_chain(buf + p, n - p, matches, verified, &need);
+        if (res > 0) return 0;         // Accepted
+        if (res < 0) return p + need;  // Undecided: need more data
+        // Rejected: try the next candidate
+    }
+    // No candidate yet (a header may still start in the last 3 bytes)
+    *cand = (n > HDR_SIZE - 1) ? n - (HDR_SIZE - 1) : 0;
+    *verified = 0;
+    return (n < 256) ? 512 : 2 * n; // Probe with growing reads
+}
+
+// Drop consumed bytes from the front of the buffered data
+static void mp3dec_consume(mp3dec_core_t *self, size_t consumed) {
+    if (consumed > self->buf_valid) consumed = self->buf_valid; // Safety
+    self->buf_valid -= consumed;
+    self->buf_pos += consumed;
+}
+
+// Physical seek on the stream + decoder reset (Critical)
+static int mp3dec_stream_seek(mp3dec_core_t *self, size_t offset) {
+    if (self->in_memory) {
+        // The data stays where it is: just move the read index
+        if (offset > self->file_buf_size) offset = self->file_buf_size;
+        self->buf_pos = offset;
+        self->buf_valid = self->file_buf_size - offset;
+    } else {
+        if (self->io.seek(self->io.ctx, offset) != 0) return MP3DEC_CORE_ERR_SEEK;
+
+        // We clear the internal buffer so we don't play leftover audio from the old position
+        self->buf_valid = 0;
+        self->buf_pos = 0;
+        self->stream_pos = offset;
+        self->live.eof = false;
+    }
+    self->started = false;
+    self->sync_pending = 0;
+    self->sync_confirmed = false;
+    int sync_matches = self->mp3d.sync_matches, quality = self->mp3d.quality; // Settings, not state
+    mp3dec_init(&self->mp3d);
+    self->mp3d.sync_matches = sync_matches;
+    self->mp3d.quality = quality;
+    return MP3DEC_CORE_OK;
+}
+
+// Small-buffer mode: the header chain behind a sync candidate may not fit in
+// file_buf. Drop the junk in front of the candidate to make room; if the chain
+// still does not fit, minimp3 accepts what it can see and the remaining
+// headers are checked as they arrive (sync_pending), with output muted.
+static void mp3dec_small_sync(mp3dec_core_t *self) {
+    size_t cand, need;
+    int verified;
+
+    // A frame error only drops header[0]: the chain itself (and its
+    // verification state) goes on if the next header continues it
+    uint8_t last[HDR_SIZE];
+    memcpy(last, self->mp3d.header, HDR_SIZE);
+    last[0] = 0xff;
+    if ((self->sync_confirmed || self->sync_pending > 0) && self->buf_valid >= HDR_SIZE
+        && hdr_compare(last, self->file_buf + self->buf_pos)) {
+        return;
+    }
+
+    while (1) {
+        need = mp3dec_sync_need(self, &cand, &verified);
+        if (need <= self->buf_valid) break;                          // Decided in the buffer
+        if (cand > 0) {                                              // Nothing to sync on before cand
+            mp3dec_consume(self, cand);
+            self->stats.bytes_skipped += cand;
+        }
+        else if (self->buf_valid == self->file_buf_size) break;      // Chain longer than the buffer
+        if (mp3dec_refill(self, self->file_buf_size) == 0) {         // End of File
+            need = mp3dec_sync_need(self, &cand, &verified);
+            break;
+        }
+    }
+    self->sync_pending = (need > self->buf_valid && cand == 0) ? self->mp3d.sync_matches : 0;
+    self->sync_confirmed = (self->sync_pending == 0);
+}
+
+// Small-buffer mode, locked on probation: check the headers that have come
+// into view since. Returns false if the chain broke (sync was false).
+static bool mp3dec_small_verify(mp3dec_core_t *self) {
+    size_t need;
+    int verified;
+    if (self->buf_valid < self->file_buf_size) mp3dec_refill(self, self->file_buf_size); // See as far as possible
+    int res = mp3dec_walk_chain(self->file_buf + self->buf_pos, self->buf_valid, self->sync_pending, &verified, &need);
+    if (res == 0) {
+        self->mp3d.header[0] = 0; // Lose sync, keep settings
+        self->stats.sync_losses++;
+        self->sync_pending = 0;
+        self->sync_confirmed = false;
+        return false;
+    }
+    if (res > 0) {
+        self->sync_pending = 0; // Confirmed: unmute
+        self->sync_confirmed = true;
+    }
+    return true;
+}
+
+// Make sure the next mp3dec_decode_frame() sees enough data.
+// Returns false once the stream is exhausted.
+static bool mp3dec_fill(mp3dec_core_t *self) {
+    if (self->in_memory) return self->buf_valid > 0; // Whole file in view
+
+    if (!self->started && self->mp3d.sync_matches < MAX_FRAME_SYNC_MATCHES) {
+        // Fast start: until audio comes out, read only what the next step needs
+        size_t need;
+        while (1) {
+            size_t cand;
+            int verified;
+            need = mp3dec_frame_need(self);
+            if (!need) need = mp3dec_sync_need(self, &cand, &verified);
+            if (need > self->file_buf_size) need = self->file_buf_size;
+            if (need <= self->buf_valid || mp3dec_refill(self, need - self->buf_valid) == 0) break;
+        }
+    } else if (mp3dec_need_refill(self)) {
+        mp3dec_refill(self, self->file_buf_size);
+    }
+
+    if (self->small_buf) {
+        bool locked = mp3dec_frame_need(self) != 0;
+        if (locked && self->sync_pending > 0) locked = mp3dec_small_verify(self);
+        if (!locked) mp3dec_small_sync(self);
+    }
+    return self->buf_valid > 0; // False: End of File
+}
+
+// --- Checkpoint Helpers ---
+// Called for every frame that advances the timeline, before its samples are counted
+static void mp3dec_checkpoint_frame(mp3dec_core_t *self) {
+    if (!self->pos_exact || self->cp_max == 0 || self->info.hz <= 0) return;
+
+    uint32_t offset = self->stream_pos - self->buf_valid + self->info.frame_offset;
+    if (self->cp_count > 0) {
+        mp3dec_checkpoint_t *last = &self->cp[self->cp_count - 1];
+        // Only extend the table forward; played regions are already covered
+        if (self->sample_pos <= last->sample) return;
+        if ((float)(self->sample_pos - last->sample) < self->cp_interval * (float)self->info.hz) return;
+    }
+
+    // Table full: keep every other entry and halve the density from now on
+    if (self->cp_count == self->cp_max) {
+        size_t i, j;
+        for (i = 0, j = 0; i < self->cp_count; i += 2, j++) {
+            self->cp[j] = self->cp[i];
+        }
+        self->cp_count = j;
+        self->cp_interval *= 2.0f;
+        if ((float)(self->sample_pos - self->cp[j - 1].sample) < self->cp_interval * (float)self->info.hz) return;
+    }
+
+    self->cp[self->cp_count].offset = offset;
+    self->cp[self->cp_count].sample = self->sample_pos;
+    self->cp_count++;
+}
+
+// Latest checkpoint at or before target_sec (NULL if none)
+static const mp3dec_checkpoint_t *mp3dec_checkpoint_find(mp3dec_core_t *self, float target_sec) {
+    if (self->cp_count == 0 || self->info.hz <= 0) return NULL;
+    uint32_t target = (uint32_t)(target_sec * (float)self->info.hz);
+
+    // Binary search: table is sorted by sample position
+    size_t lo = 0, hi = self->cp_count;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (self->cp[mid].sample <= target) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo ? &self->cp[lo - 1] : NULL;
+}
+
+// Move the timeline past the frame just parsed (call before consuming it)
+static void mp3dec_advance(mp3dec_core_t *self, int samples) {
+    mp3dec_checkpoint_frame(self);
+    if (self->sync_pending > 0) self->sync_pending--; // One header closer to confirmation
+    self->sample_pos += samples;
+    if (self->info.hz > 0) {
+        self->current_sec += (float)samples / (float)self->info.hz;
+    }
+}
+
+#ifdef MP3DEC_BENCH
+// Benchmark builds (bench/run.sh) measure the decoder's stack use: paint an
+// area below decode()'s frame, decode, then see how much of it was overwritten.
+// The paint keeps its area's address (as an integer: the frame is gone by
+// the time it is scanned, but the stack it occupied is decode()'s).
+#define MP3DEC_STACK_PROBE 49152
+#define MP3DEC_STACK_FILL  0xa5
+
+static uintptr_t mp3dec_stack_area;
+
+static MP3DEC_NOINLINE void mp3dec_stack_paint(void) {
+    volatile uint8_t area[MP3DEC_STACK_PROBE];
+    for (size_t i = 0; i < MP3DEC_STACK_PROBE; i++) area[i] = MP3DEC_STACK_FILL;
+    mp3dec_stack_area = (uintptr_t)area;
+}
+
+// The lowest bytes of the area the decoder never reached still hold the fill
+static MP3DEC_NOINLINE size_t mp3dec_stack_used(void) {
+    const volatile uint8_t *area = (const volatile uint8_t *)mp3dec_stack_area;
+    size_t i = 0;
+    while (i < MP3DEC_STACK_PROBE && area[i] == MP3DEC_STACK_FILL) i++;
+    return MP3DEC_STACK_PROBE - i;
+}
+
+static MP3DEC_NOINLINE int mp3dec_decode_probed(mp3dec_core_t *self, mp3d_sample_t *pcm) {
+    return mp3dec_decode_frame(&self->mp3d, self->file_buf + self->buf_pos, self->buf_valid, pcm, &self->info);
+}
+#endif // MP3DEC_BENCH
+
+// Update the health counters after decode() parsed (or failed to parse) a frame
+static void mp3dec_count_frame(mp3dec_core_t *self, bool was_locked, int samples, int frame_samples, size_t consumed) {
+    mp3dec_stats_t *st = &self->stats;
+    bool locked = self->mp3d.header[0] == 0xff;
+    if (!locked) {
+        st->bytes_skipped += consumed; // No frame found, or one with broken side info
+    } else {
+        st->bytes_skipped += self->info.frame_offset;
+    }
+    if (was_locked && (!locked || self->info.frame_offset > 0)) st->sync_losses++;
+
+    if (samples > 0) {
+        st->frames++;
+        if (st->last_hz && (st->last_hz != self->info.hz || st->last_channels != self->info.channels)) {
+            st->format_changes++;
+        }
+        st->last_hz = self->info.hz;
+        st->last_channels = self->info.channels;
+    } else if (frame_samples > 0) {
+        st->reservoir_miss++;
+    }
+}
+
+// Feed one frame's decode time to the load average and adjust the quality level
+static void mp3dec_govern(mp3dec_core_t *self, uint32_t elapsed_us, int frame_samples) {
+    if (self->info.hz <= 0) return;
+    float load = (float)elapsed_us * (float)self->info.hz / ((float)frame_samples * 1e6f);
+    self->load += (load - self->load) / (float)(1 << MP3DEC_GOV_EMA_SHIFT);
+    if (self->gov_target <= 0.0f) return;
+
+    int *quality = &self->mp3d.quality;
+    if (self->gov_hold > 0) {
+        self->gov_hold--;
+    } else if (self->load > self->gov_target && *quality < self->gov_max) {
+        (*quality)++;
+        self->gov_hold = MP3DEC_GOV_HOLD_DOWN;
+    } else if (self->load < self->gov_target * 0.5f && *quality > MP3D_QUALITY_FULL) {
+        (*quality)--;
+        self->gov_hold = MP3DEC_GOV_HOLD_UP;
+    }
+}
+
+// Live streams: take in what has arrived and run the jitter buffer. While
+// playing one read per frame keeps it topped up (a blocking read may wait);
+// after an underrun reading goes on up to the high watermark. Returns false
+// while (re)buffering.
+static bool mp3dec_live_ready(mp3dec_core_t *self) {
+    mp3dec_live_t *live = &self->live;
+    while (!live->eof && self->buf_valid < self->file_buf_size) {
+        if (mp3dec_refill(self, self->file_buf_size) == 0) break; // Nothing more yet
+        if (!live->buffering || self->buf_valid >= live->high) break;
+    }
+    if (live->eof) {
+        live->buffering = false; // Play out the rest
+        return true;
+    }
+    if (!live->buffering && self->buf_valid < live->low) {
+        live->buffering = true;
+        self->stats.underruns++;
+    }
+    if (live->buffering && self->buf_valid >= live->high) live->buffering = false;
+    return !live->buffering;
+}
+
+// --- Gapless ---
+static uint32_t mp3dec_be32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+// First frame of the stream: a Layer III frame whose side info is followed by
+// a Xing/Info tag holds the frame count (not counting itself) and, in the
+// LAME tag after it, the encoder delay and padding in samples.
+static void mp3dec_gapless_tag(mp3dec_core_t *self, const uint8_t *frame, size_t len) {
+    const uint8_t *h = frame;
+    if (HDR_GET_LAYER(h) != 1) return;
+    size_t side = HDR_TEST_MPEG1(h) ? (HDR_IS_MONO(h) ? 17 : 32) : (HDR_IS_MONO(h) ? 9 : 17);
+    const uint8_t *tag = frame + HDR_SIZE + side, *end = frame + len;
+    if (tag + 12 > end || (memcmp(tag, "Xing", 4) != 0 && memcmp(tag, "Info", 4) != 0)) return;
+    uint32_t flags = mp3dec_be32(tag + 4);
+    if (!(flags & 1)) return; // No frame count: length unknown
+    uint32_t frames = mp3dec_be32(tag + 8);
+    const uint8_t *lame = tag + 12 + ((flags & 2) ? 4 : 0) + ((flags & 4) ? 100 : 0) + ((flags & 8) ? 4 : 0);
+
+    uint32_t spf = hdr_frame_samples(h);
+    uint32_t delay = 0, padding = 0, decoder_delay = 0;
+    bool have_lame = lame + 24 <= end;
+    for (int i = 0; have_lame && i < 4; i++) {
+        have_lame = lame[i] >= 0x20 && lame[i] < 0x7f; // Encoder name ("LAME3.100", "Lavc...")
+    }
+    if (have_lame) {
+        delay = ((uint32_t)lame[21] << 4) | (lame[22] >> 4);
+        padding = ((uint32_t)(lame[22] & 0x0f) << 8) | lame[23];
+        decoder_delay = 528 + 1; // Synthesis filterbank latency, the delay is counted without it
+    }
+    if ((uint64_t)frames * spf <= (uint64_t)delay + padding) return;
+    self->gapless_skip = spf + delay + decoder_delay;
+    self->gapless_total = frames * spf - delay - padding;
+}
+
+// Drop the part of the frame just decoded (ending at sample_pos) outside the
+// tag's [gapless_skip, gapless_skip + gapless_total) window, moving the rest
+// to the front of pcm. Returns the samples (per channel) left.
+static int mp3dec_gapless_trim(mp3dec_core_t *self, int16_t *pcm, int samples) {
+    uint32_t end = self->sample_pos, start = end - samples;
+    uint32_t lo = self->gapless_skip, hi = lo + self->gapless_total;
+    if (end <= lo || start >= hi) return 0;
+    uint32_t first = (start < lo) ? lo - start : 0;
+    uint32_t last = (end > hi) ? hi - start : (uint32_t)samples;
+    if (first > 0) memmove(pcm, pcm + first * self->info.channels, (last - first) * self->info.channels * sizeof(int16_t));
+    return (int)(last - first);
+}
+
+// --- Spectrum ---
+// Power relative to full scale (32768^2) per unit of subband energy per
+// sample: the synthesis filterbank's power gain of 2^37 over 2^30
+#define MP3DEC_SPECTRUM_GAIN 128.0f
+
+// 10*log10(x) within ~0.3 dB from the float's exponent and mantissa (no libm)
+static float mp3dec_db(float x) {
+    if (x < 1e-20f) return -200.0f;
+    union { float f; uint32_t u; } v = { x };
+    float log2 = (float)((int)(v.u >> 23) - 127) + (float)(v.u & 0x7fffff) / (float)(1 << 23);
+    return 3.0103f * log2;
+}
+
+// Quadratic spacing of groups subband groups: one subband per group at the
+// bottom, wider groups at the top, every group at least one subband wide.
+// Group i is subbands edge[i]..edge[i+1]-1.
+static void mp3dec_band_groups(uint8_t *edge, int groups) {
+    edge[0] = 0;
+    for (int i = 1; i <= groups; i++) {
+        int e = (MP3DEC_SPECTRUM_BANDS * i * i + groups * groups / 2) / (groups * groups);
+        if (e <= edge[i - 1]) e = edge[i - 1] + 1;
+        if (e > MP3DEC_SPECTRUM_BANDS - (groups - i)) e = MP3DEC_SPECTRUM_BANDS - (groups - i);
+        edge[i] = (uint8_t)e;
+    }
+}
+
+// 0..255 over the range_db below full scale
+static uint8_t mp3dec_level(float db, int range_db) {
+    float level = 255.0f * (db + range_db) / range_db;
+    if (level <= 0.0f) return 0;
+    return (level >= 255.0f) ? 255 : (uint8_t)level;
+}
+
+static void mp3dec_spectrum_reset(mp3dec_spectrum_t *sp) {
+    memset(sp->energy, 0, sizeof(sp->energy));
+    sp->samples = 0;
+    sp->peak[0] = sp->peak[1] = 0;
+}
+
+// Called with each decoded frame (samples per channel) before post-processing.
+// Only the extremes are tracked, without branches, so the loops vectorize.
+static void mp3dec_spectrum_peak(mp3dec_core_t *self, const int16_t *pcm, int samples) {
+    mp3dec_spectrum_t *sp = &self->spectrum;
+    int16_t hi0 = 0, lo0 = 0, hi1 = 0, lo1 = 0;
+    if (self->info.channels == 2) {
+        for (int i = 0; i < samples; i++) {
+            int16_t l = pcm[2*i], r = pcm[2*i + 1];
+            hi0 = l > hi0 ? l : hi0;
+            lo0 = l < lo0 ? l : lo0;
+            hi1 = r > hi1 ? r : hi1;
+            lo1 = r < lo1 ? r : lo1;
+        }
+    } else {
+        for (int i = 0; i < samples; i++) {
+            hi0 = pcm[i] > hi0 ? pcm[i] : hi0;
+            lo0 = pcm[i] < lo0 ? pcm[i] : lo0;
+        }
+    }
+    int32_t peak0 = (hi0 > -lo0) ? hi0 : -lo0, peak1 = (hi1 > -lo1) ? hi1 : -lo1;
+    if (peak0 > sp->peak[0]) sp->peak[0] = peak0;
+    if (peak1 > sp->peak[1]) sp->peak[1] = peak1;
+}
+
+// --- Equalizer ---
+// dB per group of 8 (subbands 0, 1, 2-4, 5-7, 8-12, 13-17, 18-24, 25-31;
+// at 44.1 kHz: <0.7, 0.7-1.4, 1.4-3.4, 3.4-5.5, 5.5-9, 9-12, 12-17, >17 kHz)
+static const int8_t mp3dec_eq_presets[MP3DEC_EQ_PRESETS][8] = {
+    {  0,  0,  0,  0,  0,  0,  0,  0 }, // MP3DEC_EQ_FLAT
+    {  6,  3,  0,  0,  0,  0,  0,  0 }, // MP3DEC_EQ_BASS
+    {  0,  0,  0,  1,  3,  5,  6,  6 }, // MP3DEC_EQ_TREBLE
+    { -3, -1,  3,  3,  1,  0, -2, -3 }, // MP3DEC_EQ_VOCAL
+    {  4,  1, -2,  0,  2,  3,  4,  4 }, // MP3DEC_EQ_ROCK
+};
+
+// Shelf weights per subband (see mp3dec_core_set_tone)
+static const uint8_t mp3dec_bass_shelf[3] = { 4, 2, 1 };     // Quarters: subbands 0..2
+static const uint8_t mp3dec_treble_shelf[3] = { 1, 2, 3 };   // Quarters: subbands 5..7, full from 8
+
+// 10^(db/20) from 2^x: integer part by halving/doubling, fraction by a cubic
+// (within 0.01 dB, no libm)
+static float mp3dec_db_gain(float db) {
+    float x = db * 0.16609640f; // log2(10) / 20
+    float g = 1.0f;
+    for (; x >= 1.0f; x -= 1.0f) g *= 2.0f;
+    for (; x < 0.0f; x += 1.0f) g *= 0.5f;
+    return g * (1.0f + x * (0.695502f + x * (0.226543f + x * 0.078024f)));
+}
+
+// New targets from the settings; the gains in use ramp to them (mp3d_band_gain)
+static void mp3dec_eq_update(mp3dec_core_t *self) {
+    mp3dec_eq_t *eq = &self->eq;
+    eq->flat = true;
+    for (int b = 0; b < MP3DEC_SPECTRUM_BANDS; b++) {
+        float db = eq->db[b];
+        if (b < 3) db += eq->bass_db * mp3dec_bass_shelf[b] / 4;
+        if (b >= 5) db += eq->treble_db * (b < 8 ? mp3dec_treble_shelf[b - 5] : 4) / 4;
+        if (db > MP3DEC_EQ_MAX_DB) db = MP3DEC_EQ_MAX_DB;
+        if (db < -MP3DEC_EQ_MAX_DB) db = -MP3DEC_EQ_MAX_DB;
+        eq->gain[1][b] = (db == 0.0f) ? 1.0f : mp3dec_db_gain(db);
+        if (db != 0.0f) eq->flat = false;
+    }
+    if (!self->mp3d.band_gain && !eq->flat) {
+        for (int b = 0; b < MP3DEC_SPECTRUM_BANDS; b++) eq->gain[0][b] = 1.0f; // Ramp up from flat
+        self->mp3d.band_gain = &eq->gain[0][0];
+    }
+}
+
+// Back to flat and settled: stop processing
+static void mp3dec_eq_settle(mp3dec_core_t *self) {
+    for (int b = 0; b < MP3DEC_SPECTRUM_BANDS; b++) {
+        if (self->eq.gain[0][b] != 1.0f) return;
+    }
+    self->mp3d.band_gain = NULL;
+}
+
+// --- Overview ---
+// Power of a level written earlier (the middle of its step)
+static float mp3dec_level_power(uint8_t level, int range_db) {
+    float g = mp3dec_db_gain(((float)level + 0.5f) * range_db / 255.0f - range_db);
+    return g * g;
+}
+
+// Overview buffer full: merge pairs of levels (power mean), halving the count
+static size_t mp3dec_overview_halve(uint8_t *out, size_t n, int range_db) {
+    for (size_t i = 0; i < n / 2; i++) {
+        float p = mp3dec_level_power(out[2*i], range_db) + mp3dec_level_power(out[2*i + 1], range_db);
+        out[i] = mp3dec_level(mp3dec_db(p * 0.5f), range_db);
+    }
+    return n / 2;
+}
+
+// --- Decode ---
+int mp3dec_core_decode(mp3dec_core_t *self, int16_t *pcm) {
+    while (1) {
+        if (self->live.on && !mp3dec_live_ready(self)) return MP3DEC_CORE_BUFFERING;
+
+        // 1. Refill Buffer if needed
+        MP3D_PROF_START();
+        bool more = mp3dec_fill(self);
+        MP3D_PROF_MARK(MP3D_PROF_REFILL);
+        if (!more) return 0; // End of File
+
+        // 2. Decode Frame
+        bool muted = self->sync_pending > 0; // Sync not confirmed yet (small-buffer mode)
+        bool was_locked = self->mp3d.header[0] == 0xff;
+#ifdef MINIMP3_FLOAT_OUTPUT
+        float *out = self->pcm_f32;
+#else // MINIMP3_FLOAT_OUTPUT
+        int16_t *out = pcm;
+#endif // MINIMP3_FLOAT_OUTPUT
+        uint32_t t0 = self->io.ticks_us ? self->io.ticks_us() : 0;
+#ifdef MP3DEC_BENCH
+        mp3dec_stack_paint();
+        int samples = mp3dec_decode_probed(self, out);
+        size_t stack_used = mp3dec_stack_used();
+        if (stack_used > self->stats.stack_peak) self->stats.stack_peak = stack_used;
+#else // MP3DEC_BENCH
+        int samples = mp3dec_decode_frame(&self->mp3d, self->file_buf + self->buf_pos, self->buf_valid, out, &self->info);
+#endif // MP3DEC_BENCH
+        if (samples > 0 && self->io.ticks_us) mp3dec_govern(self, self->io.ticks_us() - t0, samples);
+        if (self->eq.flat && self->mp3d.band_gain) mp3dec_eq_settle(self);
+        if (self->spectrum.bars && samples > 0) {
+            self->spectrum.samples += samples; // The energy of every synthesized frame is in
+            self->spectrum.channels = self->info.channels;
+        }
+        if (self->gapless && samples > 0 && self->sample_pos == 0 && self->pos_exact) {
+            mp3dec_gapless_tag(self, self->file_buf + self->buf_pos + self->info.frame_offset,
+                self->info.frame_bytes - self->info.frame_offset);
+        }
+#ifdef MINIMP3_FLOAT_OUTPUT
+        if (samples > 0) mp3dec_f32_to_s16(out, pcm, samples * self->info.channels);
+#endif // MINIMP3_FLOAT_OUTPUT
+
+        // A frame whose bit reservoir is missing decodes to nothing but still
+        // occupies time; count it so tell() and the checkpoints agree with scan()
+        int frame_samples = samples;
+        if (samples == 0 && self->mp3d.header[0] == 0xff) frame_samples = hdr_frame_samples(self->mp3d.header);
+        if (frame_samples > 0) mp3dec_advance(self, frame_samples); // Needs the pre-consume offset
+
+        // 3. Consume Bytes
+        size_t consumed = self->info.frame_bytes;
+        if (consumed == 0) consumed = 1; // Prevent infinite loop on bad data
+        mp3dec_count_frame(self, was_locked, samples, frame_samples, consumed);
+        mp3dec_consume(self, consumed);
+
+        if (samples > 0) {
+            MP3D_PROF_START();
+            self->started = true;
+            if (self->gapless_total && self->pos_exact) {
+                // Past the last real sample only padding follows: that is the end
+                if (self->sample_pos - samples >= self->gapless_skip + self->gapless_total) return 0;
+                samples = mp3dec_gapless_trim(self, pcm, samples);
+                if (samples == 0) continue; // Tag frame or encoder delay
+            }
+            int output_samples = samples * self->info.channels;
+            if (muted) memset(pcm, 0, output_samples * sizeof(int16_t));
+            if (self->spectrum.bars) mp3dec_spectrum_peak(self, pcm, samples);
+
+            // 4. Post-Processing: Volume & Mono Mixing
+            // Optimization: Combine loops if volume != 100
+            if (self->force_mono && self->info.channels == 2) {
+                // Mix Stereo -> Mono (Average L+R)
+                for (int i = 0; i < samples; i++) {
+                    int32_t mixed = ((int32_t)pcm[i*2] + (int32_t)pcm[i*2+1]) / 2;
+                    if (self->volume < 100) mixed = mixed * self->volume / 100;
+                    pcm[i] = (int16_t)mixed; // Store continuously
+                }
+                MP3D_PROF_MARK(MP3D_PROF_POST);
+                return samples * 2; // Return bytes (samples * 1 channel * 2 bytes)
+            }
+            else if (self->volume < 100) {
+                // Just Volume
+                for (int i = 0; i < output_samples; i++) {
+                    pcm[i] = (int16_t)((int32_t)pcm[i] * self->volume / 100);
+                }
+            }
+            MP3D_PROF_MARK(MP3D_PROF_POST);
+
+            // Return number of bytes written to PCM buffer
+            // (Samples * Channels * 2 bytes_per_short)
+            return output_samples * 2;
+        }
+    }
+}
+
+// --- Seek ---
+int mp3dec_core_seek(mp3dec_core_t *self, size_t offset, float time_sec) {
+    // Perform the physical seek on the stream + reset decoder state
+    int err = mp3dec_stream_seek(self, offset);
+    if (err) return err;
+
+    // Force the internal timer to the new time
+    self->current_sec = time_sec;
+
+    // The caller's (offset, time) pair may be an estimate: don't record checkpoints from it
+    self->sample_pos = (uint32_t)(time_sec * (float)self->info.hz);
+    self->pos_exact = false;
+    return MP3DEC_CORE_OK;
+}
+
+// --- Scan (Precision Version) ---
+int mp3dec_core_scan(mp3dec_core_t *self, bool have_start, size_t start_offset, float start_time, float target_sec) {
+    // DECISION LOGIC: restart from the latest known point not past the target.
+    // 1. The file start is always a valid (but slow) starting point.
+    size_t from_offset = 0;
+    uint32_t from_sample = 0;
+    float from_time = 0.0f;
+    bool from_exact = true;
+
+    // 2. A checkpoint from the caller (start_time > 0) beats the file start.
+    if (have_start && start_time > 0.1f && start_time <= target_sec) {
+        from_offset = start_offset;
+        from_time = start_time;
+        from_sample = (uint32_t)(start_time * (float)self->info.hz);
+        from_exact = (self->info.hz > 0); // Trusted, but needs a rate to count samples
+    }
+
+    // 3. Our own checkpoint table beats both when it gets closer.
+    const mp3dec_checkpoint_t *cp = mp3dec_checkpoint_find(self, target_sec);
+    if (cp && (float)cp->sample / (float)self->info.hz > from_time) {
+        from_offset = cp->offset;
+        from_sample = cp->sample;
+        from_time = (float)cp->sample / (float)self->info.hz;
+        from_exact = true;
+    }
+
+    // 4. Going forward from the current position is free when it is closer still.
+    //    If we are lost (Current == 0) or going backwards, we MUST seek.
+    float scanned_time = self->current_sec;
+    bool perform_seek = !(scanned_time > 0.0f && scanned_time <= target_sec && scanned_time >= from_time);
+
+    // EXECUTE SEEK
+    if (perform_seek) {
+        int err = mp3dec_stream_seek(self, from_offset);
+        if (err) return err;
+
+        // CRITICAL FIX: Initialize time to the checkpoint time, not 0!
+        self->current_sec = from_time;
+        self->sample_pos = from_sample;
+        self->pos_exact = from_exact;
+    }
+
+    // FAST SCAN LOOP (header-only decode; also records checkpoints on the way)
+    while (1) {
+        if (!mp3dec_fill(self)) break;
+
+        int samples = mp3dec_decode_frame(&self->mp3d, self->file_buf + self->buf_pos, self->buf_valid, NULL, &self->info);
+
+        if (samples > 0) {
+            if (self->info.hz > 0) {
+                float frame_dur = (float)samples / (float)self->info.hz;
+                if (self->current_sec + frame_dur >= target_sec) {
+                    return 1;
+                }
+            }
+            mp3dec_advance(self, samples);
+            mp3dec_consume(self, self->info.frame_bytes);
+            self->started = true; // Skipping: no fast start reads
+        } else {
+            if (self->buf_valid > 0) {
+                // Skip everything the sync search already rejected, not just one byte
+                mp3dec_consume(self, self->info.frame_bytes ? self->info.frame_bytes : 1);
+            } else {
+                break;
+            }
+        }
+    }
+
+    return 0;
+}
+
+// --- Overview ---
+int mp3dec_core_overview(mp3dec_core_t *self, uint8_t *out, size_t points, float interval, int range_db) {
+    if (range_db <= 0) range_db = 60;
+    if (interval <= 0.0f) points &= ~(size_t)1; // Halving keeps levels aligned
+    if (points == 0) return 0;
+    int err = mp3dec_stream_seek(self, 0);
+    if (err) return err;
+    self->started = true; // A whole-file pass: no fast start reads
+    self->current_sec = 0.0f;
+    self->sample_pos = 0;
+    self->pos_exact = true;
+
+    size_t n = 0;
+    uint32_t span = 0, end = 0; // Samples per level, end of the one being summed
+    float power = 0.0f;
+    int frames = 0;
+    while (1) {
+        bool more = mp3dec_fill(self);
+        int samples = more ? mp3dec_decode_frame(&self->mp3d, self->file_buf + self->buf_pos, self->buf_valid, NULL, &self->info) : 0;
+        if (more && samples <= 0) {
+            if (self->buf_valid == 0) break;
+            mp3dec_consume(self, self->info.frame_bytes ? self->info.frame_bytes : 1);
+            continue;
+        }
+
+        // This frame starts the next level (or the stream ended): write the one summed so far
+        if (frames && (!more || self->sample_pos >= end)) {
+            if (n == points) {
+                if (interval > 0.0f) break;
+                n = mp3dec_overview_halve(out, n, range_db);
+                span *= 2;
+                end = (uint32_t)(n + 1) * span; // The level being summed is now twice as long
+            }
+            if (!more || self->sample_pos >= end) {
+                out[n++] = mp3dec_level(mp3dec_db(power / frames), range_db);
+                power = 0.0f;
+                frames = 0;
+                end += span;
+            }
+        }
+        if (!more) break;
+        if (span == 0) {
+            span = (uint32_t)(interval * self->info.hz);
+            if (span < (uint32_t)samples) span = samples; // At least a frame per level
+            end = span;
+        }
+
+        power += mp3dec_frame_power(self->file_buf + self->buf_pos + self->info.frame_offset,
+            self->info.frame_bytes - self->info.frame_offset);
+        frames++;
+        mp3dec_advance(self, samples); // Records checkpoints on the way
+        mp3dec_consume(self, self->info.frame_bytes);
+    }
+
+    // Ready to play from the start
+    err = mp3dec_stream_seek(self, 0);
+    if (err) return err;
+    self->current_sec = 0.0f;
+    self->sample_pos = 0;
+    self->pos_exact = true;
+    return (int)n;
+}
+
+// --- Snapshots ---
+// Layout (native byte order, meant to be restored on the same device):
+//   mp3dec_snapshot_hdr_t
+//   float mdct_overlap[2][288]          (IMDCT overlap)
+//   float qmf_state[960]                (synthesis filterbank history, oldest block first)
+//   uint8_t reserv_buf[reserv]          (bit reservoir, only the valid part)
+#define MP3DEC_SNAPSHOT_MAGIC   0x5333504DUL // "MP3S"
+#define MP3DEC_SNAPSHOT_VERSION 1
+#define MP3DEC_QMF_HISTORY      (15 * 64) // Floats of history in the mp3dec_t qmf_state ring
+
+typedef struct _mp3dec_snapshot_hdr_t {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t size;        // Total snapshot size in bytes
+    uint32_t offset;      // Stream offset of the next byte to decode
+    uint32_t sample_pos;
+    float current_sec;
+    int32_t free_format_bytes;
+    int16_t reserv;
+    uint8_t header[4];
+    uint8_t pos_exact;
+    uint8_t channels;     // mp3dec_frame_info_t of the last frame
+    uint8_t layer;
+    uint16_t bitrate_kbps;
+    int32_t hz;
+} mp3dec_snapshot_hdr_t;
+
+// The ring is stored unrolled, so the layout does not depend on where it stood.
+// Right-channel lanes (odd floats) may lag behind after mono frames.
+static void mp3dec_qmf_save(const mp3dec_t *d, uint8_t *out) {
+    for (int b = 0; b < 15; b++) {
+        float block[64];
+        memcpy(block, d->qmf_state + ((d->qmf_pos + b) % 17) * 64, sizeof(block));
+        if (d->qmf_right_pos != d->qmf_pos) {
+            const float *r = d->qmf_state + ((d->qmf_right_pos + b) % 17) * 64;
+            for (int i = 1; i < 64; i += 2) {
+                block[i] = r[i];
+            }
+        }
+        memcpy(out, block, sizeof(block));
+        out += sizeof(block);
+    }
+}
+
+static void mp3dec_qmf_load(mp3dec_t *d, const uint8_t *in) {
+    memcpy(d->qmf_state, in, MP3DEC_QMF_HISTORY * sizeof(float));
+    d->qmf_pos = 0;
+    d->qmf_right_pos = 0;
+}
+
+static size_t mp3dec_snapshot_bytes(int reserv) {
+    return sizeof(mp3dec_snapshot_hdr_t)
+        + sizeof(((mp3dec_t *)0)->mdct_overlap)
+        + MP3DEC_QMF_HISTORY * sizeof(float)
+        + (size_t)reserv;
+}
+
+// At most 6.7 KB (the reservoir part varies)
+size_t mp3dec_core_snapshot_size(const mp3dec_core_t *self) {
+    return mp3dec_snapshot_bytes(self->mp3d.reserv);
+}
+
+// Captures the stream offset, sample position and the mp3dec_t history;
+// out must hold mp3dec_core_snapshot_size() bytes
+void mp3dec_core_snapshot(const mp3dec_core_t *self, uint8_t *out) {
+    const mp3dec_t *d = &self->mp3d;
+
+    mp3dec_snapshot_hdr_t hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic = MP3DEC_SNAPSHOT_MAGIC;
+    hdr.version = MP3DEC_SNAPSHOT_VERSION;
+    hdr.size = (uint16_t)mp3dec_snapshot_bytes(d->reserv);
+    hdr.offset = self->stream_pos - self->buf_valid; // Buffered bytes are simply re-read
+    hdr.sample_pos = self->sample_pos;
+    hdr.current_sec = self->current_sec;
+    hdr.free_format_bytes = d->free_format_bytes;
+    hdr.reserv = (int16_t)d->reserv;
+    memcpy(hdr.header, d->header, 4);
+    hdr.pos_exact = self->pos_exact;
+    hdr.channels = (uint8_t)self->info.channels;
+    hdr.layer = (uint8_t)self->info.layer;
+    hdr.bitrate_kbps = (uint16_t)self->info.bitrate_kbps;
+    hdr.hz = self->info.hz;
+
+    uint8_t *p = out;
+    memcpy(p, &hdr, sizeof(hdr));                              p += sizeof(hdr);
+    memcpy(p, d->mdct_overlap, sizeof(d->mdct_overlap));       p += sizeof(d->mdct_overlap);
+    mp3dec_qmf_save(d, p);                                    p += MP3DEC_QMF_HISTORY * sizeof(float);
+    memcpy(p, d->reserv_buf, d->reserv);
+}
+
+// The decoder must be reading the same file the snapshot was taken from.
+// Seeks the stream and reloads the decoder history; no scan, no pre-roll.
+int mp3dec_core_restore(mp3dec_core_t *self, const uint8_t *state, size_t len) {
+    mp3dec_t *d = &self->mp3d;
+    const uint8_t *p = state;
+
+    // Validate before touching anything: a bad snapshot leaves the decoder as it was
+    mp3dec_snapshot_hdr_t hdr;
+    if (len < sizeof(hdr)) return MP3DEC_CORE_ERR_SNAPSHOT;
+    memcpy(&hdr, p, sizeof(hdr));
+    if (hdr.magic != MP3DEC_SNAPSHOT_MAGIC || hdr.version != MP3DEC_SNAPSHOT_VERSION
+        || hdr.reserv < 0 || hdr.reserv > (int16_t)sizeof(d->reserv_buf)
+        || hdr.size != mp3dec_snapshot_bytes(hdr.reserv) || len < hdr.size) {
+        return MP3DEC_CORE_ERR_SNAPSHOT;
+    }
+
+    // Reposition the stream (also resets the decoder), then reload the history
+    int err = mp3dec_stream_seek(self, hdr.offset);
+    if (err) return err;
+    p += sizeof(hdr);
+    memcpy(d->mdct_overlap, p, sizeof(d->mdct_overlap)); p += sizeof(d->mdct_overlap);
+    mp3dec_qmf_load(d, p);                               p += MP3DEC_QMF_HISTORY * sizeof(float);
+    memcpy(d->reserv_buf, p, hdr.reserv);
+    d->reserv = hdr.reserv;
+    d->free_format_bytes = hdr.free_format_bytes;
+    memcpy(d->header, hdr.header, 4);
+
+    self->sample_pos = hdr.sample_pos;
+    self->current_sec = hdr.current_sec;
+    self->pos_exact = hdr.pos_exact;
+    self->info.channels = hdr.channels;
+    self->info.layer = hdr.layer;
+    self->info.bitrate_kbps = hdr.bitrate_kbps;
+    self->info.hz = hdr.hz;
+    return MP3DEC_CORE_OK;
+}
+
+// --- Settings ---
+void mp3dec_core_set_volume(mp3dec_core_t *self, int volume) {
+    self->volume = (volume < 0) ? 0 : (volume > 100 ? 100 : volume);
+}
+
+void mp3dec_core_set_sync_matches(mp3dec_core_t *self, int n) {
+    self->mp3d.sync_matches = (n < 1) ? 1 : (n > MAX_FRAME_SYNC_MATCHES ? MAX_FRAME_SYNC_MATCHES : n);
+}
+
+void mp3dec_core_set_governor(mp3dec_core_t *self, float target, int max_quality) {
+    if (max_quality < MP3D_QUALITY_FULL) max_quality = MP3D_QUALITY_FULL;
+    if (max_quality > MP3D_QUALITY_LOWEST) max_quality = MP3D_QUALITY_LOWEST;
+
+    self->gov_target = (target > 0.0f) ? target : 0.0f;
+    self->gov_max = max_quality;
+    self->gov_hold = 0;
+    self->mp3d.quality = (self->gov_target > 0.0f) ? MP3D_QUALITY_FULL : max_quality;
+}
+
+void mp3dec_core_set_live(mp3dec_core_t *self, uint32_t metaint, size_t low, size_t high) {
+    mp3dec_live_t *live = &self->live;
+    if (high == 0 || high > self->file_buf_size) high = self->file_buf_size - self->file_buf_size / 4;
+    if (low == 0) low = MP3DEC_MIN_BUF_SIZE;
+    if (low > high) low = high;
+
+    live->on = !self->in_memory;
+    live->buffering = live->on; // Prebuffer before the first frame
+    live->low = low;
+    live->high = high;
+    live->metaint = metaint;
+    live->audio_left = metaint;
+    live->meta_left = 0;
+    live->title[0] = '\0';
+}
+
+void mp3dec_core_set_gapless(mp3dec_core_t *self, bool on) {
+    self->gapless = on;
+    if (!on) self->gapless_total = 0;
+}
+
+void mp3dec_core_set_spectrum(mp3dec_core_t *self, int bars, int range_db) {
+    mp3dec_spectrum_t *sp = &self->spectrum;
+    if (bars < 0) bars = 0;
+    if (bars > MP3DEC_SPECTRUM_BANDS) bars = MP3DEC_SPECTRUM_BANDS;
+    sp->bars = bars;
+    sp->range_db = (range_db > 0) ? range_db : 60;
+    mp3dec_spectrum_reset(sp);
+    self->mp3d.band_energy = bars ? &sp->energy[0][0] : NULL;
+
+    mp3dec_band_groups(sp->edge, bars);
+}
+
+void mp3dec_core_set_eq(mp3dec_core_t *self, const float *db, int bands) {
+    mp3dec_eq_t *eq = &self->eq;
+    if (bands > MP3DEC_SPECTRUM_BANDS) bands = MP3DEC_SPECTRUM_BANDS;
+    if (!db || bands <= 0) {
+        memset(eq->db, 0, sizeof(eq->db));
+    } else {
+        uint8_t edge[MP3DEC_SPECTRUM_BANDS + 1];
+        mp3dec_band_groups(edge, bands);
+        for (int i = 0; i < bands; i++) {
+            for (int b = edge[i]; b < edge[i + 1]; b++) eq->db[b] = db[i];
+        }
+    }
+    mp3dec_eq_update(self);
+}
+
+void mp3dec_core_set_eq_preset(mp3dec_core_t *self, int preset) {
+    float db[8];
+    if (preset < 0 || preset >= MP3DEC_EQ_PRESETS) preset = MP3DEC_EQ_FLAT;
+    for (int i = 0; i < 8; i++) db[i] = mp3dec_eq_presets[preset][i];
+    mp3dec_core_set_eq(self, db, 8);
+}
+
+void mp3dec_core_set_tone(mp3dec_core_t *self, float bass_db, float treble_db) {
+    self->eq.bass_db = bass_db;
+    self->eq.treble_db = treble_db;
+    mp3dec_eq_update(self);
+}
+
+size_t mp3dec_core_read_spectrum(mp3dec_core_t *self, uint8_t *out, size_t len) {
+    mp3dec_spectrum_t *sp = &self->spectrum;
+    if (!sp->bars || len < (size_t)sp->bars + MP3DEC_SPECTRUM_LEVELS) return 0;
+    int nch = (sp->channels == 2) ? 2 : 1;
+    float norm = sp->samples ? MP3DEC_SPECTRUM_GAIN / (float)sp->samples : 0.0f;
+
+    for (int i = 0; i < sp->bars; i++) {
+        float e = 0.0f;
+        for (int ch = 0; ch < nch; ch++) {
+            for (int b = sp->edge[i]; b < sp->edge[i + 1]; b++) e += sp->energy[ch][b];
+        }
+        out[i] = mp3dec_level(mp3dec_db(e * norm / nch), sp->range_db);
+    }
+    uint8_t *levels = out + sp->bars;
+    for (int ch = 0; ch < 2; ch++) {
+        int c = (ch < nch) ? ch : 0;
+        float e = 0.0f;
+        for (int b = 0; b < MP3DEC_SPECTRUM_BANDS; b++) e += sp->energy[c][b];
+        float peak = (float)sp->peak[c] / 32768.0f;
+        levels[2 * ch] = mp3dec_level(mp3dec_db(peak * peak), sp->range_db);
+        levels[2 * ch + 1] = mp3dec_level(mp3dec_db(e * norm), sp->range_db);
+    }
+    mp3dec_spectrum_reset(sp);
+    return sp->bars + MP3DEC_SPECTRUM_LEVELS;
+}
+
+void mp3dec_core_set_checkpoints(mp3dec_core_t *self, mp3dec_checkpoint_t *cp, size_t cp_max, float interval) {
+    self->cp = cp;
+    self->cp_max = cp_max;
+    self->cp_count = 0;
+    self->cp_interval = (interval > 0.0f) ? interval : MP3DEC_DEFAULT_CP_INTERVAL;
+}
+
+// --- Statistics ---
+void mp3dec_core_reset_stats(mp3dec_core_t *self) {
+    mp3dec_stats_t *st = &self->stats;
+    int last_hz = st->last_hz, last_channels = st->last_channels; // Keep detecting format changes
+    memset(st, 0, sizeof(*st));
+    st->last_hz = last_hz;
+    st->last_channels = last_channels;
+}
+
+#ifdef MINIMP3_PROFILE
+uint32_t mp3dec_core_profile_hz(void) {
+    return MINIMP3_PROFILE_HZ;
+}
+#endif // MINIMP3_PROFILE
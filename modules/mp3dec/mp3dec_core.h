@@ -0,0 +1,274 @@
+// Streaming decoder core: buffering, sync, checkpoints, scan/seek,
+// snapshots, statistics, load governor and post-processing around minimp3.
+// Plain C with no MicroPython dependency: the stream is reached through
+// mp3dec_core_io_t callbacks (or decoded in place from memory) and all memory
+// is owned by the caller.
+// mp3dec.c wraps it as mp3dec.MP3Decoder, cli/mp3dec_cli.c as a native tool.
+#ifndef MP3DEC_CORE_H
+#define MP3DEC_CORE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "minimp3.h"
+
+// --- Checkpoints ---
+// Sparse (byte offset, sample position) pairs recorded while decoding.
+// scan()/seek() restart from the nearest one instead of the file start.
+#define MP3DEC_DEFAULT_CP_MAX       64
+#define MP3DEC_DEFAULT_CP_INTERVAL  1.0f // Seconds (doubles on every decimation)
+
+typedef struct _mp3dec_checkpoint_t {
+    uint32_t offset; // Absolute byte offset of a frame header
+    uint32_t sample; // Sample position (per channel) of that frame
+} mp3dec_checkpoint_t;
+
+// --- Statistics ---
+// Decode health counters, cheap enough to keep in every build (see stats())
+typedef struct _mp3dec_stats_t {
+    uint32_t frames;          // Frames decoded to audio
+    uint32_t reservoir_miss;  // Frames muted because their bit reservoir was missing
+    uint32_t sync_losses;     // Times a locked decoder had to search for sync again
+    uint32_t bytes_skipped;   // Bytes dropped while searching for sync
+    uint32_t format_changes;  // Sample rate or channel count changed mid-stream
+    uint32_t bytes_read;      // Bytes read from the stream
+    uint32_t refills;         // read() calls that returned data
+    uint32_t bytes_moved;     // Bytes memmoved by buffer compaction
+    uint32_t underruns;       // Live streams: times the buffer ran below the low watermark
+    uint32_t meta_bytes;      // Live streams: ICY metadata bytes stripped from the stream
+#ifdef MP3DEC_BENCH
+    uint32_t stack_peak;      // Deepest stack use below decode(), bytes
+#endif // MP3DEC_BENCH
+    int last_hz;              // Format of the last decoded frame (0: none yet)
+    int last_channels;
+} mp3dec_stats_t;
+
+// --- Load Governor ---
+// decode() times each frame against its duration (real-time load, 1.0 = all
+// of it). Above the target the decoder steps to a cheaper MP3D_QUALITY_*
+// level, below half the target it steps back up.
+#define MP3DEC_GOV_EMA_SHIFT  3  // Load average over ~8 frames
+#define MP3DEC_GOV_HOLD_DOWN  16 // Frames to settle after degrading
+#define MP3DEC_GOV_HOLD_UP    64 // Frames to settle after restoring (slower, avoids flapping)
+
+// --- Buffer Sizes ---
+#define MP3DEC_DEFAULT_BUF_SIZE 8192
+#define MP3DEC_MIN_BUF_SIZE     1536 // Largest MPEG-1 Layer III frame (1441) + next header
+#define MP3DEC_SMALL_BUF_SIZE   4096 // Below this the sync chain may not fit: small-buffer mode
+
+// --- Live Streams ---
+// Internet radio: read() may have nothing yet (MP3DEC_IO_AGAIN) and an ICY
+// (Shoutcast/Icecast) stream carries a metadata block after every metaint
+// audio bytes, which the refill path strips. decode() holds back output until
+// the buffer reaches the high watermark, and again whenever it ran below the
+// low one with nothing more to read (an underrun).
+#define MP3DEC_IO_AGAIN       ((size_t)-1) // read(): no data available right now
+#define MP3DEC_ICY_TITLE_MAX  128          // StreamTitle bytes kept (longer titles are cut)
+#define MP3DEC_ICY_META_KEEP  (13 + MP3DEC_ICY_TITLE_MAX + 2) // Head of each metadata block searched for it
+
+typedef struct _mp3dec_live_t {
+    bool on;
+    bool buffering;       // Waiting for the high watermark (decode() returns MP3DEC_CORE_BUFFERING)
+    bool eof;             // read() returned 0: play out what is buffered
+    size_t low, high;     // Watermarks in bytes
+    uint32_t metaint;     // Audio bytes between ICY metadata blocks (0: none)
+    uint32_t audio_left;  // Audio bytes before the next metadata length byte
+    uint16_t meta_left;   // Bytes of the current metadata block still to come
+    uint16_t meta_len;    // Bytes of it kept in meta
+    char meta[MP3DEC_ICY_META_KEEP];
+    char title[MP3DEC_ICY_TITLE_MAX + 1]; // Latest StreamTitle ("" until the first)
+} mp3dec_live_t;
+
+// --- Spectrum ---
+// Visualizer tap (see mp3dec_core_set_spectrum): minimp3 sums the squared
+// subband samples of every granule before synthesis, per channel and per
+// subband (32, each 1/64 of the sample rate wide), and decode() keeps the
+// peak sample. Reading the levels groups the subbands into bars, converts
+// to dBFS and starts the next period; no FFT and no pass over the PCM
+// besides the peak.
+#define MP3DEC_SPECTRUM_BANDS  32
+#define MP3DEC_SPECTRUM_LEVELS 4 // Peak and RMS per channel, after the bars
+
+typedef struct _mp3dec_spectrum_t {
+    int bars;             // 0: tap off
+    int range_db;         // Levels 0..255 span -range_db..0 dBFS
+    uint8_t edge[MP3DEC_SPECTRUM_BANDS + 1]; // Bar i sums subbands edge[i]..edge[i+1]-1
+    float energy[2][MP3DEC_SPECTRUM_BANDS];  // Since the last read (mp3d.band_energy points here)
+    uint32_t samples;     // Samples (per channel) in energy
+    int channels;         // Of the audio in energy
+    int32_t peak[2];      // Largest |sample| per channel since the last read
+} mp3dec_spectrum_t;
+
+// --- Equalizer ---
+// Gains applied to the 32 subbands before synthesis (see
+// mp3dec_core_set_eq): a graphic equalizer and bass/treble shelves for one
+// multiply per sample, with gain changes ramped over a few granules.
+// Neighbouring subbands cancel each other's aliasing, so steep steps between
+// them are smoothed by grouping rather than applied as-is.
+#define MP3DEC_EQ_MAX_DB  24.0f // Gains are clamped to +-this
+
+// Presets for mp3dec_core_set_eq_preset (8 groups, see mp3dec_eq_presets)
+#define MP3DEC_EQ_FLAT    0
+#define MP3DEC_EQ_BASS    1
+#define MP3DEC_EQ_TREBLE  2
+#define MP3DEC_EQ_VOCAL   3
+#define MP3DEC_EQ_ROCK    4
+#define MP3DEC_EQ_PRESETS 5
+
+typedef struct _mp3dec_eq_t {
+    float db[MP3DEC_SPECTRUM_BANDS]; // Graphic EQ per subband
+    float bass_db, treble_db;
+    bool flat;            // All targets are 0 dB: the tap is dropped once the gains settle
+    float gain[2][MP3DEC_SPECTRUM_BANDS]; // In use and target (mp3d.band_gain points here)
+} mp3dec_eq_t;
+
+// --- Errors ---
+#define MP3DEC_CORE_OK            0
+#define MP3DEC_CORE_ERR_SEEK     -1 // The seek callback failed
+#define MP3DEC_CORE_ERR_SNAPSHOT -2 // restore(): not a snapshot of this format
+#define MP3DEC_CORE_BUFFERING    -3 // decode(): live stream (re)buffering, call again later
+
+// --- Host Interface ---
+// read: copy up to len bytes into buf, return the count (0 = end of stream,
+//       MP3DEC_IO_AGAIN = nothing available yet, for live streams).
+// seek: move to an absolute byte offset, return 0 on success.
+// ticks_us: free-running microsecond clock for the governor (NULL: no timing).
+typedef struct _mp3dec_core_io_t {
+    size_t (*read)(void *ctx, uint8_t *buf, size_t len);
+    int (*seek)(void *ctx, size_t offset);
+    uint32_t (*ticks_us)(void);
+    void *ctx;
+} mp3dec_core_io_t;
+
+// --- Decoder State ---
+typedef struct _mp3dec_core_t {
+    mp3dec_t mp3d;
+    mp3dec_frame_info_t info;
+    mp3dec_core_io_t io;
+    uint8_t *file_buf;
+    size_t file_buf_size;
+    size_t buf_valid;     // Unconsumed bytes, starting at file_buf + buf_pos
+    size_t buf_pos;       // Read index: consuming a frame just moves it forward
+    int volume;
+    float current_sec;    // Track playback time
+    bool force_mono;      // Force stereo to mono mix
+    size_t stream_pos;    // Absolute stream offset just past the buffered data
+    uint32_t sample_pos;  // Samples (per channel) since file start
+    bool pos_exact;       // sample_pos is known to match stream_pos
+    bool started;         // A frame was decoded since the last stream seek
+    bool small_buf;       // Sync chain is verified across refills (see mp3dec_small_sync)
+    int sync_pending;     // Headers after the current frame still to verify (output muted)
+    bool sync_confirmed;  // The current header chain was fully verified
+    bool in_memory;       // file_buf is the caller's data (whole file): no reads, no compaction
+    mp3dec_live_t live;   // Live stream mode (see mp3dec_core_set_live)
+    bool gapless;         // Trim the encoder delay and padding (see mp3dec_core_set_gapless)
+    uint32_t gapless_skip;  // Decoded samples (per channel) before the first real one, tag frame included
+    uint32_t gapless_total; // Real samples per the tag (0: no tag, nothing is trimmed)
+    mp3dec_spectrum_t spectrum; // Visualizer tap (see mp3dec_core_set_spectrum)
+    mp3dec_eq_t eq;       // Subband equalizer (see mp3dec_core_set_eq)
+    mp3dec_checkpoint_t *cp;
+    size_t cp_count;
+    size_t cp_max;
+    float cp_interval;    // Seconds between checkpoints
+    mp3dec_stats_t stats;
+    float gov_target;     // Load that triggers degrading (0: governor off)
+    int gov_max;          // Cheapest MP3D_QUALITY_* level the governor may pick
+    int gov_hold;         // Frames until the governor may step again
+    float load;           // Moving average of decode time / frame duration
+#ifdef MINIMP3_FLOAT_OUTPUT
+    float pcm_f32[MINIMP3_MAX_SAMPLES_PER_FRAME]; // Decoder output, converted to int16 by decode()
+#endif // MINIMP3_FLOAT_OUTPUT
+} mp3dec_core_t;
+
+// The stream is expected to be positioned at its start. buf_size must be at
+// least MP3DEC_MIN_BUF_SIZE; below MP3DEC_SMALL_BUF_SIZE small-buffer mode is
+// used. cp may be NULL with cp_max 0 (no checkpoints).
+void mp3dec_core_init(mp3dec_core_t *self, const mp3dec_core_io_t *io, uint8_t *buf, size_t buf_size,
+    mp3dec_checkpoint_t *cp, size_t cp_max);
+
+// In-memory source: decode straight from the len bytes at data (the whole
+// file), which must stay in place and unchanged while the decoder uses them.
+// Nothing is read or copied and seeking only moves the read index; io->read
+// and io->seek are not called and may be NULL.
+void mp3dec_core_init_mem(mp3dec_core_t *self, const mp3dec_core_io_t *io, const uint8_t *data, size_t len,
+    mp3dec_checkpoint_t *cp, size_t cp_max);
+
+// Live stream mode, set before the first decode(): metaint is the icy-metaint
+// response header (0: no metadata), low/high the watermarks in bytes (0: one
+// frame and 3/4 of the buffer). Seeking and scanning need a seekable stream.
+void mp3dec_core_set_live(mp3dec_core_t *self, uint32_t metaint, size_t low, size_t high);
+
+// Gapless output, set before the first decode(): when the first frame is a
+// Xing/Info tag, it is dropped and, with a LAME tag, so are the encoder delay
+// and padding, so decode() returns exactly the samples that were encoded.
+// gapless_total then holds the track length in samples.
+void mp3dec_core_set_gapless(mp3dec_core_t *self, bool on);
+
+// Spectrum tap: bars (1..32, 0: off) spaced quadratically over the subbands
+// (bar i ends near subband 32*(i+1)^2/bars^2, at least one each), levels
+// in dB over range_db (0: 60). Peak and RMS are of the decoded audio, before
+// volume and mono mixing.
+void mp3dec_core_set_spectrum(mp3dec_core_t *self, int bars, int range_db);
+
+// Write the levels since the last read to out, 0..255 each: the bars, then
+// peak L, RMS L, peak R, RMS R (R = L for mono). Returns the bytes written,
+// 0 when the tap is off or len is below bars + MP3DEC_SPECTRUM_LEVELS.
+size_t mp3dec_core_read_spectrum(mp3dec_core_t *self, uint8_t *out, size_t len);
+
+// Graphic equalizer: bands (1..32) gains in dB over the subbands, grouped
+// like the spectrum bars (32: one per subband; NULL or 0 bands: flat). Takes
+// effect from the next granule, ramped.
+void mp3dec_core_set_eq(mp3dec_core_t *self, const float *db, int bands);
+void mp3dec_core_set_eq_preset(mp3dec_core_t *self, int preset);
+
+// Shelves on top of the equalizer, in dB: bass is full below 0.7 kHz and
+// gone by 2 kHz, treble starts at 3.4 kHz and is full above 5.5 kHz (at
+// 44.1 kHz; the corners scale with the sample rate)
+void mp3dec_core_set_tone(mp3dec_core_t *self, float bass_db, float treble_db);
+
+// Decode the next frame into pcm (up to MINIMP3_MAX_SAMPLES_PER_FRAME samples).
+// Returns bytes written, 0 at the end of the stream, MP3DEC_CORE_BUFFERING
+// while a live stream fills its buffer.
+int mp3dec_core_decode(mp3dec_core_t *self, int16_t *pcm);
+
+// Restart decoding at a byte offset the caller knows to be time_sec
+int mp3dec_core_seek(mp3dec_core_t *self, size_t offset, float time_sec);
+
+// Skip ahead to the frame containing target_sec without synthesis, starting
+// from the best of (start_offset, start_time) if have_start, the checkpoints
+// and the current position. Returns 1 when reached, 0 at the end of the
+// stream or a negative MP3DEC_CORE_ERR_*.
+int mp3dec_core_scan(mp3dec_core_t *self, bool have_start, size_t start_offset, float start_time, float target_sec);
+
+// Loudness overview (e.g. the waveform of a long recording) without decoding:
+// reads the stream from its start, headers and side info only, and writes a
+// level per interval seconds to out (0..255 over range_db, 0: 60, like the
+// spectrum tap), estimated from each frame's side info (mp3dec_frame_power;
+// Layer I/II frames read as silence). Stops when points levels are written;
+// with interval 0 it covers the whole stream instead, from one frame per
+// level, merging pairs whenever out is full (points/2..points levels). Leaves
+// the decoder at the start, checkpoints recorded. Returns the levels written,
+// or a negative MP3DEC_CORE_ERR_*.
+int mp3dec_core_overview(mp3dec_core_t *self, uint8_t *out, size_t points, float interval, int range_db);
+
+// Snapshots: state to continue on the exact next sample after a power cycle
+size_t mp3dec_core_snapshot_size(const mp3dec_core_t *self);
+void mp3dec_core_snapshot(const mp3dec_core_t *self, uint8_t *out);
+int mp3dec_core_restore(mp3dec_core_t *self, const uint8_t *state, size_t len);
+
+// Settings (values are clamped to their valid range)
+void mp3dec_core_set_volume(mp3dec_core_t *self, int volume);
+void mp3dec_core_set_sync_matches(mp3dec_core_t *self, int n);
+void mp3dec_core_set_governor(mp3dec_core_t *self, float target, int max_quality);
+// cp: the caller's (possibly reallocated) table of cp_max entries, emptied here
+void mp3dec_core_set_checkpoints(mp3dec_core_t *self, mp3dec_checkpoint_t *cp, size_t cp_max, float interval);
+
+// Zero the counters, keeping the last format so format changes are still detected
+void mp3dec_core_reset_stats(mp3dec_core_t *self);
+
+#ifdef MINIMP3_PROFILE
+// Tick rate of mp3d_profile_ticks (0: CPU cycles)
+uint32_t mp3dec_core_profile_hz(void);
+#endif // MINIMP3_PROFILE
+
+#endif // MP3DEC_CORE_H
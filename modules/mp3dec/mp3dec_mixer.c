@@ -0,0 +1,177 @@
+#include "mp3dec_mixer.h"
+#include <string.h>
+
+// --- Init ---
+void mp3dec_mixer_init(mp3dec_mixer_t *self, int channels) {
+    memset(self, 0, sizeof(*self));
+    self->channels = (channels == 1) ? 1 : 2;
+}
+
+// --- Voices ---
+int mp3dec_mixer_add(mp3dec_mixer_t *self, mp3dec_core_t *core, int16_t *pcm) {
+    mp3dec_voice_t v;
+    memset(&v, 0, sizeof(v));
+    v.core = core;
+    v.pcm = pcm;
+    return mp3dec_mixer_add_voice(self, &v);
+}
+
+int mp3dec_mixer_add_voice(mp3dec_mixer_t *self, const mp3dec_voice_t *voice) {
+    if (mp3dec_mixer_active(self) == 0) self->hz = 0; // A new rate may start here
+    if (voice->pcm_pos < voice->pcm_len) {
+        int hz = voice->core->info.hz;
+        if (self->hz && hz != self->hz) return -1;
+        self->hz = hz;
+    }
+    for (int i = 0; i < MP3DEC_MIXER_MAX_VOICES; i++) {
+        mp3dec_voice_t *v = &self->voices[i];
+        if (v->core) continue;
+        *v = *voice;
+        v->played = 0;
+        mp3dec_mixer_set_gain(self, i, 1.0f, 0.0f);
+        return i;
+    }
+    return -1;
+}
+
+void mp3dec_mixer_remove(mp3dec_mixer_t *self, int voice) {
+    if (voice >= 0 && voice < MP3DEC_MIXER_MAX_VOICES) self->voices[voice].core = NULL;
+}
+
+static int32_t mp3dec_mixer_q12(float gain) {
+    if (gain < -MP3DEC_MIXER_GAIN_MAX) gain = -MP3DEC_MIXER_GAIN_MAX;
+    if (gain > MP3DEC_MIXER_GAIN_MAX) gain = MP3DEC_MIXER_GAIN_MAX;
+    return (int32_t)(gain * MP3DEC_MIXER_UNITY + (gain < 0.0f ? -0.5f : 0.5f));
+}
+
+void mp3dec_mixer_set_matrix(mp3dec_mixer_t *self, int voice, float ll, float lr, float rl, float rr) {
+    if (voice < 0 || voice >= MP3DEC_MIXER_MAX_VOICES) return;
+    int32_t *m = self->voices[voice].matrix;
+    m[0] = mp3dec_mixer_q12(ll);
+    m[1] = mp3dec_mixer_q12(lr);
+    m[2] = mp3dec_mixer_q12(rl);
+    m[3] = mp3dec_mixer_q12(rr);
+}
+
+// Balance: the far side fades out, the near side stays at gain
+void mp3dec_mixer_set_gain(mp3dec_mixer_t *self, int voice, float gain, float pan) {
+    if (gain < 0.0f) gain = 0.0f;
+    if (pan < -1.0f) pan = -1.0f;
+    if (pan > 1.0f) pan = 1.0f;
+    float left = (pan > 0.0f) ? gain * (1.0f - pan) : gain;
+    float right = (pan < 0.0f) ? gain * (1.0f + pan) : gain;
+    mp3dec_mixer_set_matrix(self, voice, left, 0.0f, 0.0f, right);
+}
+
+int mp3dec_mixer_active(const mp3dec_mixer_t *self) {
+    int n = 0;
+    for (int i = 0; i < MP3DEC_MIXER_MAX_VOICES; i++) n += self->voices[i].core != NULL;
+    return n;
+}
+
+int mp3dec_voice_decode(mp3dec_voice_t *v) {
+    int bytes = mp3dec_core_decode(v->core, v->pcm);
+    v->pcm_pos = 0;
+    v->pcm_len = (bytes > 0) ? bytes / 2 : 0;
+    if (bytes > 0) v->channels = (v->core->force_mono && v->core->info.channels == 2) ? 1 : v->core->info.channels;
+    return bytes;
+}
+
+// Decode the voice's next frame. Returns false when there is none right now:
+// the voice was released (end of stream, other sample rate) or is buffering.
+static bool mp3dec_voice_fetch(mp3dec_mixer_t *self, mp3dec_voice_t *v) {
+    int bytes = mp3dec_voice_decode(v);
+    if (bytes == MP3DEC_CORE_BUFFERING) return false;
+    if (bytes <= 0) {
+        v->core = NULL; // Finished
+        return false;
+    }
+    if (self->hz == 0) {
+        self->hz = v->core->info.hz;
+    } else if (v->core->info.hz != self->hz) {
+        self->rate_drops++; // No resampling: it would play at the wrong speed
+        v->core = NULL;
+        return false;
+    }
+    return true;
+}
+
+// --- Mixing ---
+// Add n sample frames of src (src_ch wide) into acc (out_ch wide). The matrix
+// is folded for the channel counts first, so each case is one multiply-add
+// per input and output sample. Unity gain passes samples through exactly.
+static void mp3dec_voice_accumulate(const mp3dec_voice_t *v, int32_t *acc, const int16_t *src, int n, int out_ch) {
+    const int32_t *m = v->matrix;
+    if (v->channels == 2 && out_ch == 2) {
+        for (int i = 0; i < n; i++) {
+            int32_t l = src[2*i], r = src[2*i + 1];
+            acc[2*i] += (l * m[0] + r * m[1]) >> 12;
+            acc[2*i + 1] += (l * m[2] + r * m[3]) >> 12;
+        }
+    } else if (v->channels == 1 && out_ch == 2) {
+        int32_t cl = m[0] + m[1], cr = m[2] + m[3];
+        for (int i = 0; i < n; i++) {
+            acc[2*i] += (src[i] * cl) >> 12;
+            acc[2*i + 1] += (src[i] * cr) >> 12;
+        }
+    } else if (v->channels == 2) {
+        int32_t cl = (m[0] + m[2]) / 2, cr = (m[1] + m[3]) / 2;
+        for (int i = 0; i < n; i++) {
+            acc[i] += (src[2*i] * cl + src[2*i + 1] * cr) >> 12;
+        }
+    } else {
+        int32_t c = (m[0] + m[1] + m[2] + m[3]) / 2;
+        for (int i = 0; i < n; i++) {
+            acc[i] += (src[i] * c) >> 12;
+        }
+    }
+}
+
+size_t mp3dec_mixer_mix(mp3dec_mixer_t *self, int16_t *out, size_t frames) {
+    if (mp3dec_mixer_active(self) == 0) return 0;
+
+    int32_t acc[MP3DEC_MIXER_BLOCK * 2];
+    const int out_ch = self->channels;
+    size_t done = 0;
+    while (done < frames) {
+        int n = (frames - done < MP3DEC_MIXER_BLOCK) ? (int)(frames - done) : MP3DEC_MIXER_BLOCK;
+        memset(acc, 0, n * out_ch * sizeof(int32_t));
+
+        int end = 0; // Frames of this block up to where the last voice ended
+        for (int i = 0; i < MP3DEC_MIXER_MAX_VOICES; i++) {
+            mp3dec_voice_t *v = &self->voices[i];
+            if (!v->core) continue;
+            int filled = 0;
+            while (v->core && filled < n) {
+                if (v->pcm_pos >= v->pcm_len && !mp3dec_voice_fetch(self, v)) break;
+                int take = (v->pcm_len - v->pcm_pos) / v->channels;
+                if (take > n - filled) take = n - filled;
+                mp3dec_voice_accumulate(v, acc + filled * out_ch, v->pcm + v->pcm_pos, take, out_ch);
+                v->pcm_pos += take * v->channels;
+                v->played += take;
+                filled += take;
+            }
+            if (v->core) filled = n; // Still playing (or buffering): silence, not the end
+            if (filled > end) end = filled;
+        }
+        if (end < n) n = end; // All voices ended in this block
+
+        // Saturate once, after all voices
+        int16_t *dst = out + done * out_ch;
+        for (int i = 0; i < n * out_ch; i++) {
+            int32_t s = acc[i];
+            if (s > 32767) {
+                s = 32767;
+                self->clipped++;
+            } else if (s < -32768) {
+                s = -32768;
+                self->clipped++;
+            }
+            dst[i] = (int16_t)s;
+        }
+        done += n;
+        if (!mp3dec_mixer_active(self)) break;
+    }
+    self->frames += done;
+    return done;
+}
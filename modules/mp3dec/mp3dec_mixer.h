@@ -0,0 +1,68 @@
+// Multi-stream mixer: pulls PCM from up to MP3DEC_MIXER_MAX_VOICES decoder
+// cores (music plus sound effects) into one output buffer per call.
+// Each voice has a gain matrix (gain, pan or any channel mapping), mono and
+// stereo sources are adapted to the output's channel count, and the voices
+// are summed in a 32-bit accumulator that is saturated to int16 once.
+// Voices are released when their stream ends. Plain C like mp3dec_core.c;
+// mp3dec.c wraps it as mp3dec.Mixer.
+#ifndef MP3DEC_MIXER_H
+#define MP3DEC_MIXER_H
+
+#include "mp3dec_core.h"
+
+#define MP3DEC_MIXER_MAX_VOICES 8
+#define MP3DEC_MIXER_BLOCK      128       // Sample frames per accumulator pass (1 KB of stack)
+#define MP3DEC_MIXER_UNITY      (1 << 12) // Gain 1.0 (Q12)
+#define MP3DEC_MIXER_GAIN_MAX   2.0f      // Keeps every product and pair sum within 31 bits
+
+typedef struct _mp3dec_voice_t {
+    mp3dec_core_t *core;  // NULL: free slot
+    int16_t *pcm;         // Decoded frame not mixed yet (MINIMP3_MAX_SAMPLES_PER_FRAME samples)
+    int pcm_pos;          // Next sample (interleaved) of pcm
+    int pcm_len;
+    int channels;         // Of pcm
+    int32_t matrix[4];    // Q12: left from (L, R), right from (L, R)
+    uint32_t played;      // Sample frames mixed
+} mp3dec_voice_t;
+
+typedef struct _mp3dec_mixer_t {
+    int channels;         // Output: 1 or 2
+    int hz;               // Output rate: set by the first voice added to an empty mixer (0: none yet)
+    mp3dec_voice_t voices[MP3DEC_MIXER_MAX_VOICES];
+    uint32_t frames;      // Sample frames mixed
+    uint32_t clipped;     // Output samples saturated
+    uint32_t rate_drops;  // Voices released for a sample rate other than hz
+} mp3dec_mixer_t;
+
+void mp3dec_mixer_init(mp3dec_mixer_t *self, int channels);
+
+// Start mixing core (positioned where it should play from), at unity gain.
+// pcm is the voice's frame buffer, owned by the caller like the core.
+// Returns the voice number, or -1 when all voices are in use.
+int mp3dec_mixer_add(mp3dec_mixer_t *self, mp3dec_core_t *core, int16_t *pcm);
+
+// Same for a voice whose first frame may already be decoded (see
+// mp3dec_voice_decode), e.g. the next track of a playlist. Returns -1 as
+// well when that frame's sample rate differs from hz.
+int mp3dec_mixer_add_voice(mp3dec_mixer_t *self, const mp3dec_voice_t *voice);
+void mp3dec_mixer_remove(mp3dec_mixer_t *self, int voice);
+
+// Gain (0..MP3DEC_MIXER_GAIN_MAX) and balance (-1 left .. 1 right), or a
+// full mapping: left = ll*L + lr*R, right = rl*L + rr*R (L = R for mono
+// sources; mono output is the average of left and right)
+void mp3dec_mixer_set_gain(mp3dec_mixer_t *self, int voice, float gain, float pan);
+void mp3dec_mixer_set_matrix(mp3dec_mixer_t *self, int voice, float ll, float lr, float rl, float rr);
+
+// Voices in use
+int mp3dec_mixer_active(const mp3dec_mixer_t *self);
+
+// Decode the voice's next frame into its pcm (its core and pcm set, nothing
+// pending). Returns mp3dec_core_decode()'s result.
+int mp3dec_voice_decode(mp3dec_voice_t *v);
+
+// Fill out with up to frames sample frames (interleaved, channels wide);
+// voices that end or are still buffering leave silence. Returns frames, less
+// where the last voice ended, 0 when no voice was playing (out untouched).
+size_t mp3dec_mixer_mix(mp3dec_mixer_t *self, int16_t *out, size_t frames);
+
+#endif // MP3DEC_MIXER_H
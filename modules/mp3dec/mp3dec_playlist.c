@@ -0,0 +1,165 @@
+#include "mp3dec_playlist.h"
+#include <string.h>
+
+// --- Init ---
+void mp3dec_playlist_init(mp3dec_playlist_t *self, int channels) {
+    memset(self, 0, sizeof(*self));
+    mp3dec_mixer_init(&self->mixer, channels);
+    self->current = -1;
+    self->fading = -1;
+}
+
+// --- Queue ---
+bool mp3dec_playlist_append(mp3dec_playlist_t *self, mp3dec_core_t *core, int16_t *pcm) {
+    if (self->queued == MP3DEC_PLAYLIST_MAX) return false;
+    mp3dec_voice_t *v = &self->queue[self->queued++];
+    memset(v, 0, sizeof(*v));
+    v->core = core;
+    v->pcm = pcm;
+    mp3dec_core_set_gapless(core, true);
+    return true;
+}
+
+static void mp3dec_playlist_pop(mp3dec_playlist_t *self) {
+    self->queued--;
+    memmove(&self->queue[0], &self->queue[1], self->queued * sizeof(self->queue[0]));
+}
+
+// Decode the first frame of queue[0] unless done already, dropping tracks
+// without audio. Returns false when there is no next track yet.
+static bool mp3dec_playlist_prime(mp3dec_playlist_t *self) {
+    while (self->queued) {
+        mp3dec_voice_t *v = &self->queue[0];
+        if (v->pcm_pos < v->pcm_len) return true;
+        int bytes = mp3dec_voice_decode(v);
+        if (bytes > 0) return true;
+        if (bytes == MP3DEC_CORE_BUFFERING) return false;
+        mp3dec_playlist_pop(self);
+    }
+    return false;
+}
+
+void mp3dec_playlist_set_crossfade(mp3dec_playlist_t *self, float sec) {
+    self->fade_sec = (sec > 0.0f) ? sec : 0.0f;
+}
+
+static void mp3dec_playlist_end_fade(mp3dec_playlist_t *self) {
+    mp3dec_mixer_remove(&self->mixer, self->fading);
+    self->fading = -1;
+}
+
+void mp3dec_playlist_skip(mp3dec_playlist_t *self) {
+    if (self->fading >= 0) mp3dec_playlist_end_fade(self);
+    mp3dec_mixer_remove(&self->mixer, self->current);
+    self->current = -1;
+}
+
+// --- Transitions ---
+// sin(x * pi/2) at x = i/32, Q12: the equal-power curve (the fade-out is the
+// same curve backwards, so both gains squared always sum to 1)
+static const int16_t mp3dec_fade_curve[33] = {
+    0, 201, 401, 601, 799, 995, 1189, 1380, 1567, 1751, 1931, 2106, 2276, 2440, 2598, 2751, 2896,
+    3035, 3166, 3290, 3406, 3513, 3612, 3703, 3784, 3857, 3920, 3973, 4017, 4052, 4076, 4091, 4096
+};
+
+static float mp3dec_fade_gain(uint32_t pos, uint32_t len) {
+    uint32_t x = (uint32_t)(((uint64_t)pos << 10) / len); // 0..1024: 32 steps of 32
+    int i = x >> 5, f = x & 31;
+    int32_t g = mp3dec_fade_curve[i];
+    if (i < 32) g += ((mp3dec_fade_curve[i + 1] - g) * f) >> 5;
+    return (float)g / MP3DEC_MIXER_UNITY;
+}
+
+// Start queue[0] as the current track, alone in the mixer. With join (output
+// already written at the mixer's rate) only when its sample rate matches.
+static bool mp3dec_playlist_next(mp3dec_playlist_t *self, bool join) {
+    if (!mp3dec_playlist_prime(self)) return false;
+    if (join && self->queue[0].core->info.hz != self->mixer.hz) return false;
+    self->current = mp3dec_mixer_add_voice(&self->mixer, &self->queue[0]);
+    mp3dec_playlist_pop(self);
+    self->tracks++;
+    return true;
+}
+
+// Fade queue[0] in over the left sample frames of the current track
+static void mp3dec_playlist_crossfade(mp3dec_playlist_t *self, uint32_t left) {
+    int incoming = mp3dec_mixer_add_voice(&self->mixer, &self->queue[0]);
+    if (incoming < 0) return;
+    mp3dec_playlist_pop(self);
+    self->fading = self->current;
+    self->current = incoming;
+    self->fade_len = left;
+    self->fade_pos = 0;
+    self->tracks++;
+    self->crossfades++;
+}
+
+// Frames of the current track left before its crossfade is due (0: now), or
+// frames when there is no crossfade to start
+static size_t mp3dec_playlist_until_fade(mp3dec_playlist_t *self, size_t frames) {
+    const mp3dec_voice_t *cur = &self->mixer.voices[self->current];
+    uint32_t total = cur->core->gapless_total;
+    uint32_t fade = (uint32_t)(self->fade_sec * self->mixer.hz);
+    if (fade == 0 || total == 0 || cur->played >= total) return frames;
+    if (!mp3dec_playlist_prime(self) || self->queue[0].core->info.hz != self->mixer.hz) return frames;
+    uint32_t left = total - cur->played;
+    if (left <= fade) {
+        mp3dec_playlist_crossfade(self, left);
+        return 0;
+    }
+    return (left - fade < frames) ? left - fade : frames;
+}
+
+// --- Decoding ---
+size_t mp3dec_playlist_decode(mp3dec_playlist_t *self, int16_t *out, size_t frames) {
+    const int ch = self->mixer.channels;
+    size_t done = 0;
+    while (done < frames) {
+        if (self->current < 0 && !mp3dec_playlist_next(self, done > 0)) break;
+
+        size_t want = frames - done;
+        if (self->fading >= 0) {
+            // Gains are stepped every MP3DEC_PLAYLIST_FADE_STEP frames, at the step's middle
+            if (want > MP3DEC_PLAYLIST_FADE_STEP) want = MP3DEC_PLAYLIST_FADE_STEP;
+            if (want > self->fade_len - self->fade_pos) want = self->fade_len - self->fade_pos;
+            uint32_t mid = self->fade_pos + want / 2;
+            mp3dec_mixer_set_gain(&self->mixer, self->current, mp3dec_fade_gain(mid, self->fade_len), 0.0f);
+            mp3dec_mixer_set_gain(&self->mixer, self->fading, mp3dec_fade_gain(self->fade_len - mid, self->fade_len), 0.0f);
+        } else {
+            want = mp3dec_playlist_until_fade(self, want);
+            if (want == 0) continue; // Crossfade started
+        }
+
+        done += mp3dec_mixer_mix(&self->mixer, out + done * ch, want);
+        if (self->fading >= 0) {
+            self->fade_pos += want;
+            if (self->fade_pos >= self->fade_len || !self->mixer.voices[self->fading].core) {
+                mp3dec_playlist_end_fade(self);
+                mp3dec_mixer_set_gain(&self->mixer, self->current, 1.0f, 0.0f);
+            }
+        }
+        if (!self->mixer.voices[self->current].core) {
+            // Track ended (when it was still fading in, the fade ends with it)
+            if (self->fading >= 0) mp3dec_playlist_end_fade(self);
+            self->current = -1;
+        }
+    }
+    // Get the next track ready while this buffer plays
+    if (self->current >= 0) mp3dec_playlist_prime(self);
+    return done;
+}
+
+// --- Queries ---
+mp3dec_core_t *mp3dec_playlist_current(const mp3dec_playlist_t *self) {
+    return (self->current >= 0) ? self->mixer.voices[self->current].core : NULL;
+}
+
+bool mp3dec_playlist_uses(const mp3dec_playlist_t *self, const mp3dec_core_t *core) {
+    for (int i = 0; i < MP3DEC_MIXER_MAX_VOICES; i++) {
+        if (self->mixer.voices[i].core == core) return true;
+    }
+    for (int i = 0; i < self->queued; i++) {
+        if (self->queue[i].core == core) return true;
+    }
+    return false;
+}
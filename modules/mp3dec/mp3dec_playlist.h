@@ -0,0 +1,56 @@
+// Gapless playlist: plays queued decoder cores back to back into the output
+// buffer the caller drains. The next track is primed (read, synced and its
+// first frame decoded) while the current one plays, tracks are joined within
+// the same buffer, and with a crossfade set the next one fades in on an
+// equal-power curve as the current one fades out. Queued cores are put in
+// gapless mode, so a LAME-tagged track ends exactly on its last real sample;
+// the crossfade starts from the track length of that tag (untagged tracks are
+// joined without one). Plain C like mp3dec_mixer.c, which does the mixing;
+// mp3dec.c wraps it as mp3dec.Playlist.
+#ifndef MP3DEC_PLAYLIST_H
+#define MP3DEC_PLAYLIST_H
+
+#include "mp3dec_mixer.h"
+
+#define MP3DEC_PLAYLIST_MAX        4  // Tracks queued after the current one
+#define MP3DEC_PLAYLIST_FADE_STEP  32 // Sample frames per crossfade gain step
+
+typedef struct _mp3dec_playlist_t {
+    mp3dec_mixer_t mixer;     // The current track, plus the outgoing one during a crossfade
+    mp3dec_voice_t queue[MP3DEC_PLAYLIST_MAX]; // queue[0] is primed while the current track plays
+    int queued;
+    int current;              // Mixer voice of the current track (-1: none)
+    int fading;               // Mixer voice of the outgoing track (-1: none)
+    float fade_sec;           // Crossfade length (0: gapless join)
+    uint32_t fade_len;        // Sample frames of the running crossfade
+    uint32_t fade_pos;
+    uint32_t tracks;          // Tracks started
+    uint32_t crossfades;      // Transitions that were crossfaded
+} mp3dec_playlist_t;
+
+// channels: output width, 1 or 2
+void mp3dec_playlist_init(mp3dec_playlist_t *self, int channels);
+
+// Queue core, positioned at its start and not decoded yet, with its frame
+// buffer pcm (MINIMP3_MAX_SAMPLES_PER_FRAME samples, owned by the caller like
+// the core). Returns false when the queue is full.
+bool mp3dec_playlist_append(mp3dec_playlist_t *self, mp3dec_core_t *core, int16_t *pcm);
+
+void mp3dec_playlist_set_crossfade(mp3dec_playlist_t *self, float sec);
+
+// End the current track (and a running crossfade) now; the next decode()
+// starts the next one.
+void mp3dec_playlist_skip(mp3dec_playlist_t *self);
+
+// Fill out with up to frames sample frames (interleaved, channels wide).
+// Returns fewer at the end of the playlist and when the next track has
+// another sample rate (it starts with the next call: check mixer.hz), 0 when
+// nothing is left to play.
+size_t mp3dec_playlist_decode(mp3dec_playlist_t *self, int16_t *out, size_t frames);
+
+// The core of the current track (NULL: none), and whether core is still in
+// use (playing or queued)
+mp3dec_core_t *mp3dec_playlist_current(const mp3dec_playlist_t *self);
+bool mp3dec_playlist_uses(const mp3dec_playlist_t *self, const mp3dec_core_t *core);
+
+#endif // MP3DEC_PLAYLIST_H
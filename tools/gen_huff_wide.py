@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""Generate modules/mp3dec/minimp3_huff_wide.h from the compact tables in minimp3.h.
+
+The compact L3_huffman() tables are trees walked 5 bits (or less) at a time,
+so long codewords take several probes. This script decodes those trees back
+into codeword lists and repacks them with a wider first level, keeping the
+leaf/pointer encoding L3_huffman() already understands:
+
+    leaf >= 0: (bits consumed at this level << 8) | (y << 4) | x
+    leaf <  0: (-offset << 3) | width of the next level (1..7)
+
+Usage: tools/gen_huff_wide.py [--bits N] [minimp3.h] [minimp3_huff_wide.h]
+"""
+
+import argparse
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_SRC = os.path.join(HERE, '..', 'modules', 'mp3dec', 'minimp3.h')
+DEFAULT_DST = os.path.join(HERE, '..', 'modules', 'mp3dec', 'minimp3_huff_wide.h')
+
+SUB_BITS = 7  # widest level the pointer encoding can express (leaf & 7)
+
+
+def parse_array(src, name):
+    m = re.search(r'\b' + re.escape(name) + r'\[[^\]]*\]\s*=\s*\{([^}]*)\}', src)
+    if not m:
+        sys.exit('gen_huff_wide: %s[] not found' % name)
+    return [int(v) for v in m.group(1).replace('\n', ' ').split(',') if v.strip()]
+
+
+def walk(tabs, base, offset, width, prefix, plen, codes):
+    """Collect (code, length, value) from one level of a compact big_values tree."""
+    for p in range(1 << width):
+        leaf = tabs[base + offset + p]
+        if leaf >= 0:
+            n = leaf >> 8
+            code = (prefix << n) | (p >> (width - n))
+            codes[(code, plen + n)] = leaf & 0xff
+        else:
+            walk(tabs, base, -(leaf >> 3), leaf & 7, (prefix << width) | p, plen + width, codes)
+
+
+def check_prefix_free(codes, name):
+    for (c1, l1) in codes:
+        for (c2, l2) in codes:
+            if (c1, l1) != (c2, l2) and l1 <= l2 and (c2 >> (l2 - l1)) == c1:
+                sys.exit('gen_huff_wide: %s is not a prefix code' % name)
+
+
+def build(codes, bits):
+    """Pack codewords into a multi-level table, first level 'bits' wide."""
+    out = []
+
+    def level(entries, width):
+        start = len(out)
+        out.extend([None] * (1 << width))
+        longer = {}
+        for code, n, value in entries:
+            if n <= width:
+                for p in range(1 << (width - n)):
+                    out[start + (code << (width - n)) + p] = (n << 8) | value
+            else:
+                longer.setdefault(code >> (n - width), []).append((code, n, value))
+        for head, sub in sorted(longer.items()):
+            rest = [(c & ((1 << (n - width)) - 1), n - width, v) for c, n, v in sub]
+            w = min(SUB_BITS, max(n for _, n, _ in rest))
+            offset = level(rest, w)
+            if offset*8 > 32768:
+                sys.exit('gen_huff_wide: table too large for int16 pointers')
+            out[start + head] = -offset*8 + w
+        return start
+
+    level([(c, n, v) for (c, n), v in sorted(codes.items())], bits)
+    if None in out:
+        sys.exit('gen_huff_wide: incomplete code')
+    return out
+
+
+def c_rows(values, per_row=16, indent='    '):
+    rows = []
+    for i in range(0, len(values), per_row):
+        rows.append(indent + ','.join(str(v) for v in values[i:i + per_row]))
+    return ',\n'.join(rows)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('--bits', type=int, default=8, help='first-level width, 5..12 (default 8)')
+    ap.add_argument('src', nargs='?', default=DEFAULT_SRC)
+    ap.add_argument('dst', nargs='?', default=DEFAULT_DST)
+    args = ap.parse_args()
+    if not 5 <= args.bits <= 12:
+        sys.exit('gen_huff_wide: --bits must be 5..12')
+
+    src = open(args.src).read()
+    tabs = parse_array(src, 'tabs')
+    tabindex = parse_array(src, 'tabindex')
+    tab32 = parse_array(src, 'tab32')
+
+    # big_values tables: identical trees share one packed table, like tabindex does
+    packed, index, widths, longest, cache = [], [], [], [], {}
+    for t, base in enumerate(tabindex):
+        if base not in cache:
+            codes = {}
+            walk(tabs, base, 0, 5, 0, 0, codes)
+            check_prefix_free(codes, 'table %d' % t)
+            maxlen = max(n for _, n in codes)
+            # table 0 codes nothing (length 0); it still needs one bit to index
+            width = max(1, min(args.bits, maxlen))
+            cache[base] = (len(packed), width, maxlen)
+            packed.extend(build(codes, width))
+        offset, width, maxlen = cache[base]
+        index.append(offset)
+        widths.append(width)
+        longest.append(maxlen)
+
+    # count1 table A: at most 6 bits, so one 64-entry probe replaces the two-step tab32
+    count1 = []
+    for p in range(64):
+        leaf = tab32[p >> 2]
+        if not (leaf & 8):
+            leaf = tab32[(leaf >> 3) + ((p & 3) >> (2 - (leaf & 3)))]
+        count1.append(leaf)
+
+    with open(args.dst, 'w') as f:
+        f.write('/* Generated by tools/gen_huff_wide.py --bits %d from minimp3.h, do not edit.\n' % args.bits)
+        f.write('   Wide-first-level Huffman tables for MINIMP3_WIDE_HUFFMAN, %d bytes. */\n'
+                % (2*len(packed) + len(count1) + 2*len(index) + len(widths)))
+        f.write('#ifndef MINIMP3_HUFF_WIDE_H\n#define MINIMP3_HUFF_WIDE_H\n\n')
+        f.write('#define MINIMP3_HUFF_WIDE_BITS %d\n\n' % args.bits)
+        f.write('static const int16_t g_huff_wide[%d] = {\n%s\n};\n\n' % (len(packed), c_rows(packed)))
+        f.write('static const int16_t g_huff_wide_index[32] = {\n%s\n};\n\n' % c_rows(index))
+        f.write('/* first-level width per table_select; longest codewords: %s */\n'
+                % ','.join(str(n) for n in longest))
+        f.write('static const uint8_t g_huff_wide_bits[32] = {\n%s\n};\n\n' % c_rows(widths))
+        f.write('/* count1 table A, indexed by the next 6 bits: (xywv << 4) | 8 | length */\n')
+        f.write('static const uint8_t g_huff_wide_count1[64] = {\n%s\n};\n\n' % c_rows(count1))
+        f.write('#endif /* MINIMP3_HUFF_WIDE_H */\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+"""Generate modules/mp3dec/minimp3_pow43.h: pow(x, 4/3) for the linbits range.
+
+L3_pow_43() looks up x < 129 in g_pow43[] and approximates larger values with
+a polynomial (up to ~1.3e-6 relative error). With MINIMP3_POW43_TABLE_SIZE=N
+defined, minimp3 includes this header and looks up 129 <= x < N instead
+(N rounds up to the next CHUNK step; 8207 covers everything 13 linbits can
+produce). The values are correctly rounded, so such builds are slightly more
+accurate and no longer bit-exact with the default one.
+
+Usage: tools/gen_pow43.py [minimp3_pow43.h]
+"""
+
+import os
+import struct
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_DST = os.path.join(HERE, '..', 'modules', 'mp3dec', 'minimp3_pow43.h')
+
+FIRST = 129         # g_pow43[] in minimp3.h covers 0..128
+LAST = 15 + 8191    # largest big_value: 15 + 13 linbits
+CHUNK = 512
+
+
+def f32(v):
+    """Round to float32 and print it back exactly (9 significant digits)."""
+    v = struct.unpack('<f', struct.pack('<f', v))[0]
+    s = '%.9g' % v
+    return s + ('f' if '.' in s or 'e' in s else '.0f')
+
+
+def main():
+    dst = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_DST
+    values = [f32(x ** (4.0/3)) for x in range(FIRST, LAST + 1)]
+
+    with open(dst, 'w') as f:
+        f.write('/* Generated by tools/gen_pow43.py, do not edit.\n')
+        f.write('   pow(x, 4/3) for %d <= x < MINIMP3_POW43_TABLE_SIZE, in %d-entry steps. */\n'
+                % (FIRST, CHUNK))
+        f.write('#ifndef MINIMP3_POW43_H\n#define MINIMP3_POW43_H\n\n')
+        f.write('static const float g_pow43_ext[] = {\n')
+        for start in range(0, len(values), CHUNK):
+            x = FIRST + start
+            if start:
+                f.write('#if MINIMP3_POW43_TABLE_SIZE > %d\n' % x)
+            chunk = values[start:start + CHUNK]
+            for i in range(0, len(chunk), 8):
+                f.write('    ' + ','.join(chunk[i:i + 8]) + ',\n')
+            if start:
+                f.write('#endif\n')
+        f.write('};\n\n#endif /* MINIMP3_POW43_H */\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,619 @@
+#!/usr/bin/env python3
+"""Generate the Layer III reference streams in conformance/streams.
+
+The conformance corpus is mostly LAME output, which CI cannot pin to one
+encoder version, and the synth_* files carry random payloads that only
+support a length check. These streams are encoded here from a synthetic
+hybrid-domain signal (partials, a tilted noise floor, a level that wanders
+between about -45 and -14 dBFS, silent stretches), so they are valid,
+reproducible and quiet enough for the tolerance cases' PSNR check:
+
+    stereo_44k_128   MPEG-1 stereo, short blocks, scfsi, preflag
+    ms_32k_96        MPEG-1 mid/side stereo, short blocks
+    is_48k_160       MPEG-1 intensity + mid/side stereo, long blocks
+    mono_44k_64      MPEG-1 mono, short blocks
+    lsf_22k_64       MPEG-2 mid/side stereo, short blocks
+    lsf_8k_16        MPEG-2.5 mono, short blocks
+    lowpass_edges    MPEG-1 stereo whose count1 quads straddle the lowpass
+                     edges of quality 1/2 (line 360) and 3 (line 180) on odd
+                     big_values; the _cut20 and _cut10 twins hold the same
+                     granules with the lines from 360 and 180 up zeroed, so
+                     those qualities must decode both to the same PCM
+
+The encoder is deliberately simple: CBR with the bit reservoir, random
+scalefactors and subblock gains, the cheapest Huffman tables and region
+split, and global_gain searched to fit the bits. The Huffman codes and the
+scalefactor band tables are read from minimp3.h, so the streams only depend
+on this script and the seeds below.
+
+Usage: tools/gen_ref_streams.py [minimp3.h] [out_dir]
+"""
+
+import argparse
+import copy
+import math
+import os
+import random
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, HERE)
+from gen_huff_wide import parse_array, walk  # noqa: E402
+
+DEFAULT_SRC = os.path.join(HERE, '..', 'modules', 'mp3dec', 'minimp3.h')
+DEFAULT_OUT = os.path.join(HERE, '..', 'conformance', 'streams')
+
+# name, MPEG version, sample rate, kbps, channel mode, short blocks, seconds, seed
+STREAMS = [
+    ('stereo_44k_128', 1, 44100, 128, 'stereo', True, 2.0, 1),
+    ('ms_32k_96', 1, 32000, 96, 'ms', True, 2.0, 2),
+    ('is_48k_160', 1, 48000, 160, 'ms_is', False, 2.0, 3),
+    ('mono_44k_64', 1, 44100, 64, 'mono', True, 2.0, 4),
+    ('lsf_22k_64', 2, 22050, 64, 'ms', True, 2.0, 5),
+    ('lsf_8k_16', 25, 8000, 16, 'mono', True, 2.0, 6),
+]
+LOWPASS = ('lowpass_edges', 1, 44100, 128, 'stereo', True, 2.0, 7)
+LOWPASS_EDGES = [358, 178]  # first count1 line, granule by granule
+LOWPASS_CUTS = [('_cut20', 360), ('_cut10', 180)]
+
+KBPS = {1: [0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320],
+        2: [0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160]}
+RATES = {1: [44100, 48000, 32000], 2: [22050, 24000, 16000], 25: [11025, 12000, 8000]}
+VERSION_BITS = {1: 3, 2: 2, 25: 0}
+LINBITS = [0]*16 + [1, 2, 3, 4, 6, 8, 10, 13, 4, 5, 6, 7, 8, 9, 11, 13]
+PRETAB = [1, 1, 1, 1, 2, 2, 3, 3, 3, 2]
+SCFC_SLEN = [(0, 0), (0, 1), (0, 2), (0, 3), (3, 0), (1, 1), (1, 2), (1, 3),
+             (2, 1), (2, 2), (2, 3), (3, 1), (3, 2), (3, 3), (4, 2), (4, 3)]
+MAX_Q = 15 + 8191
+# sum of xr^2 over a granule whose PCM has full-scale (0 dBFS) mean power: the hybrid
+# filterbank halves the power of the lines, measured with minimp3
+FULL_SCALE_ENERGY = 2.0
+
+
+def parse_rows(src, name):
+    m = re.search(r'\b' + re.escape(name) + r'\[\d+\]\[\d+\]\s*=\s*\{(.*?)\};', src, re.S)
+    if not m:
+        sys.exit('gen_ref_streams: %s[][] not found' % name)
+    return [[int(v) for v in row.split(',') if v.strip()] for row in re.findall(r'\{([^{}]*)\}', m.group(1))]
+
+
+class Tables:
+    """Huffman codes and band tables of minimp3.h, seen from the encoder side."""
+
+    def __init__(self, src):
+        tabs = parse_array(src, 'tabs')
+        tabindex = parse_array(src, 'tabindex')
+        tab32 = parse_array(src, 'tab32')
+        self.pair = {}  # table_select: {(x, y): (code, length)}
+        for t, base in enumerate(tabindex):
+            if base:  # table 0 codes nothing, 4 and 14 are not used
+                codes = {}
+                walk(tabs, base, 0, 5, 0, 0, codes)
+                self.pair[t] = {(v & 15, v >> 4): cl for cl, v in codes.items()}
+        self.xmax = {t: max(x for x, _ in c) for t, c in self.pair.items()}
+        # count1 tables, keyed by the 4 line flags (first line in bit 3)
+        quad_a = {}
+        for p in range(64):
+            leaf = tab32[p >> 2]
+            if not (leaf & 8):
+                leaf = tab32[(leaf >> 3) + ((p & 3) >> (2 - (leaf & 3)))]
+            quad_a[leaf >> 4] = (p >> (6 - (leaf & 7)), leaf & 7)
+        self.quad = [quad_a, {15 - p: (p, 4) for p in range(16)}]
+        self.scf_long = parse_rows(src, 'g_scf_long')
+        self.scf_short = parse_rows(src, 'g_scf_short')
+
+    def bands(self, version, rate, short):
+        sr_idx = RATES[version].index(rate) + {1: 6, 2: 3, 25: 0}[version]
+        sr_idx -= sr_idx != 0
+        row = (self.scf_short if short else self.scf_long)[sr_idx]
+        return row[:row.index(0)]
+
+
+class Bits:
+    def __init__(self):
+        self.parts = []
+        self.n = 0
+
+    def put(self, value, n):
+        assert 0 <= value < 1 << n, (value, n)
+        if n:
+            self.parts.append(format(value, '0%db' % n))
+            self.n += n
+
+    def append(self, other):
+        self.parts.extend(other.parts)
+        self.n += other.n
+
+    def tobytes(self):
+        s = ''.join(self.parts)
+        s += '0'*(-len(s) % 8)
+        return bytes(int(s[i:i + 8], 2) for i in range(0, len(s), 8))
+
+
+class Signal:
+    """Hybrid-domain target spectra: a few partials over a tilted noise floor."""
+
+    def __init__(self, rnd, nch, cutoff):
+        self.rnd = rnd
+        self.nch = nch
+        self.cutoff = cutoff
+        self.level = -24.0
+        self.silent = 0
+        self.note = 0
+        self.partials = []
+
+    def next_granule(self):
+        rnd = self.rnd
+        self.level = min(-14.0, max(-45.0, self.level + rnd.gauss(0, 1.5)))
+        if self.silent:
+            self.silent -= 1
+        elif rnd.random() < 0.01:
+            self.silent = rnd.randrange(8, 20)
+        if self.note:
+            self.note -= 1
+        else:
+            self.note = rnd.randrange(20, 60)
+            f0 = rnd.uniform(4, 40)
+            self.partials = [(f0*h, 1.0/h, rnd.random()) for h in range(1, 6) if f0*h < self.cutoff]
+
+    def spectrum(self, ch, n_lines, weight):
+        """n_lines of one window, summing to weight of the granule's energy."""
+        rnd = self.rnd
+        if self.silent:
+            return [0.0]*n_lines
+        scale = n_lines/576.0
+        x = [0.0]*n_lines
+        for k in range(min(n_lines, int(self.cutoff*scale))):
+            x[k] = 0.3*rnd.gauss(0, 1)*10**(-2.0*k/n_lines)
+        for line, amp, pan in self.partials:
+            k = int(line*scale)
+            if ch:
+                amp *= pan
+            elif self.nch > 1:
+                amp *= 1 - pan
+            sign = rnd.choice((-1, 1))
+            for d, a in ((-1, 0.3), (0, 1.0), (1, 0.3)):
+                if 0 <= k + d < n_lines:
+                    x[k + d] += sign*amp*a*8
+        energy = sum(v*v for v in x) or 1.0
+        gain = math.sqrt(weight*FULL_SCALE_ENERGY*10**(self.level/10)/energy)
+        return [v*gain for v in x]
+
+
+def force_edge(q, start, end=418):
+    """Odd big_values ending at line start, then count1 quads up to end with the first one's
+    second half set."""
+    for k in range(start, 576):
+        q[k] = max(-1, min(1, q[k])) if k < end else 0
+    q[start - 1] = 2 if q[start - 1] >= 0 else -2
+    q[start + 2], q[start + 3], q[end - 1] = 1, -1, 1
+
+
+def quantize(x, steps):
+    return [int((abs(v)/s)**0.75 + 0.4054)*(1 if v >= 0 else -1) for v, s in zip(x, steps)]
+
+
+class Granule:
+    """Side info and main data of one granule of one channel."""
+
+    def __init__(self, block_type):
+        self.block_type = block_type
+        self.sbg = [0, 0, 0]
+        self.sfc = 0
+        self.scf = []
+        self.slen = [0, 0, 0, 0]
+        self.counts = []
+        self.scfsi = 0
+        self.preflag = 0
+        self.sfs = 0
+        self.gg = 210
+        self.q_target = []
+        self.q = [0]*576
+        self.big_values = 0
+        self.tables = [0, 0, 0]
+        self.regions = [0, 0]
+        self.count1_table = 0
+        self.main = Bits()
+
+    def part2_bits(self):
+        return sum(n*s for g, (n, s) in enumerate(zip(self.counts, self.slen)) if not (self.scfsi & (8 >> g)))
+
+
+def pair_bits(tables, t, x, y):
+    cl = tables.pair[t]
+    ax, ay = abs(x), abs(y)
+    lb = LINBITS[t]
+    if lb:
+        bits = cl[(min(ax, 15), min(ay, 15))][1] + (lb if ax >= 15 else 0) + (lb if ay >= 15 else 0)
+    else:
+        bits = cl[(ax, ay)][1]
+    return bits + (ax != 0) + (ay != 0)
+
+
+def band_bits(tables, q):
+    """Bits of the pairs of q in every table able to code them."""
+    m = max(abs(v) for v in q)
+    cost = {0: 0} if not m else {}
+    for t in tables.pair:
+        if t < 16 and tables.xmax[t] >= m:
+            cost[t] = sum(pair_bits(tables, t, q[i], q[i + 1]) for i in range(0, len(q), 2))
+    # tables 16..23 and 24..31 share their codes and differ in linbits only
+    escapes = sum(abs(v) >= 15 for v in q)
+    for family in (16, 24):
+        bits = sum(pair_bits(tables, family, q[i], q[i + 1]) for i in range(0, len(q), 2)) - escapes*LINBITS[family]
+        for t in range(family, family + 8):
+            if 15 + (1 << LINBITS[t]) - 1 >= m:
+                cost[t] = bits + escapes*LINBITS[t]
+    return cost
+
+
+def encode_spectrum(tables, gr, band_widths):
+    """Huffman-code gr.q: returns the part 3 bits and fills in the region/table fields."""
+    q = gr.q
+    end = 576
+    while end > 0 and q[end - 1] == 0 and q[end - 2] == 0:
+        end -= 2
+    c1 = end
+    while c1 >= 4 and max(abs(v) for v in q[c1 - 4:c1]) <= 1:
+        c1 -= 4
+    gr.big_values = c1//2
+
+    # band boundaries (in lines) of the big_values region
+    starts, pos = [], 0
+    for w in band_widths:
+        if pos >= c1:
+            break
+        starts.append((pos, min(pos + w, c1)))
+        pos += w
+    band_cost = [band_bits(tables, q[a:b]) for a, b in starts]
+
+    def region_cost(lo, hi):
+        lo, hi = min(lo, len(band_cost)), min(hi, len(band_cost))
+        used = band_cost[lo:hi]
+        if not used:
+            return 0, 0
+        common = set(used[0])
+        for c in used[1:]:
+            common &= set(c)
+        return min((sum(c[t] for c in used), t) for t in common)
+
+    if gr.block_type:
+        n0 = 9 if gr.block_type == 2 else 8
+        r0, r1 = region_cost(0, n0), region_cost(n0, len(band_widths))
+        best = (r0[0] + r1[0], [r0[1], r1[1], 0], [n0 - 1, 0])
+    else:
+        best = None
+        for a in range(16):
+            ra = region_cost(0, a + 1)
+            for b in range(8):
+                if a + b + 2 > len(band_widths):
+                    break
+                rb, rc = region_cost(a + 1, a + b + 2), region_cost(a + b + 2, len(band_widths))
+                cost = ra[0] + rb[0] + rc[0]
+                if best is None or cost < best[0]:
+                    best = (cost, [ra[1], rb[1], rc[1]], [a, b])
+    _, gr.tables, gr.regions = best
+
+    bits = Bits()
+    if gr.block_type:
+        bounds = [sum(band_widths[:gr.regions[0] + 1]), 576, 576]
+    else:
+        bounds = [sum(band_widths[:gr.regions[0] + 1]), sum(band_widths[:gr.regions[0] + gr.regions[1] + 2]), 576]
+    reg = 0
+    for i in range(0, c1, 2):
+        while i >= bounds[reg]:
+            reg += 1
+        t = gr.tables[reg]
+        if not t:
+            continue
+        lb = LINBITS[t]
+        x, y = q[i], q[i + 1]
+        code, n = tables.pair[t][(min(abs(x), 15), min(abs(y), 15))]
+        bits.put(code, n)
+        for v in (x, y):
+            if lb and abs(v) >= 15:
+                bits.put(abs(v) - 15, lb)
+            if v:
+                bits.put(v < 0, 1)
+
+    quads = [q[i:i + 4] for i in range(c1, end, 4)]
+    flags = [sum((v != 0) << (3 - j) for j, v in enumerate(quad)) for quad in quads]
+    costs = [sum(tables.quad[k][f][1] for f in flags) for k in (0, 1)]
+    gr.count1_table = int(costs[1] < costs[0])
+    for quad, f in zip(quads, flags):
+        bits.put(*tables.quad[gr.count1_table][f])
+        for v in quad:
+            if v:
+                bits.put(v < 0, 1)
+    return bits
+
+
+class Encoder:
+    def __init__(self, tables, name, version, rate, kbps, mode, short, seconds, seed, edges=None):
+        self.tables = tables
+        self.edges = edges
+        self.granule = 0
+        self.version = version
+        self.mpeg1 = version == 1
+        self.rate = rate
+        self.kbps = kbps
+        self.mode = mode
+        self.nch = 1 if mode == 'mono' else 2
+        self.ms = mode in ('ms', 'ms_is')
+        self.intensity = mode == 'ms_is'
+        self.short = short
+        self.ngr = 2 if self.mpeg1 else 1
+        self.frames = int(seconds*rate/(576*self.ngr))
+        self.rnd = random.Random(seed)
+        self.signal = Signal(self.rnd, self.nch, 576*min(1.0, 16000.0/(rate/2)))
+        self.long_bands = tables.bands(version, rate, False)
+        self.short_bands = tables.bands(version, rate, True)
+        self.side_bytes = (17 if self.nch == 1 else 32) if self.mpeg1 else (9 if self.nch == 1 else 17)
+
+    def block_types(self):
+        """Granule block types: long, or start, 1..3 short, stop around a transient."""
+        seq = []
+        while len(seq) < self.frames*self.ngr:
+            if self.short and self.rnd.random() < 0.05:
+                seq += [1] + [2]*self.rnd.randrange(1, 4) + [3]
+            else:
+                seq.append(0)
+        return seq[:self.frames*self.ngr]
+
+    def target(self, gr_type, ch):
+        weight = 0.1 if self.ms and ch else 1.0  # side channel
+        if gr_type != 2:
+            return self.signal.spectrum(ch, 576, weight)
+        windows = [self.signal.spectrum(ch, 192, weight/3) for _ in range(3)]
+        x, pos = [], 0
+        for i in range(0, len(self.short_bands), 3):
+            w = self.short_bands[i]
+            for win in windows:
+                x += win[pos:pos + w]
+            pos += w
+        return x
+
+    def scalefactors(self, gr, prev, is_band):
+        rnd = self.rnd
+        gr.sfs = int(rnd.random() < 0.3)
+        silent = not any(gr.q_target)
+        if self.mpeg1:
+            if is_band is not None:
+                gr.sfc = rnd.choice((3, 7, 10, 13, 15))  # intensity positions need 3 bits
+            else:
+                gr.sfc = 0 if silent else rnd.randrange(16)
+            s1, s2 = SCFC_SLEN[gr.sfc]
+            gr.slen = [s1, s1, s2, s2]
+            gr.counts = [9, 9, 6, 12] if gr.block_type == 2 else [6, 5, 5, 5]
+            gr.preflag = int(gr.block_type != 2 and not silent and rnd.random() < 0.2)
+        else:
+            s = [0, 0, 0, 0] if silent else [rnd.randrange(5), rnd.randrange(5), rnd.randrange(4), rnd.randrange(4)]
+            gr.sfc = s[0]*80 + s[1]*16 + s[2]*4 + s[3]
+            gr.slen = s
+            gr.counts = [9, 9, 9, 9] if gr.block_type == 2 else [6, 5, 5, 5]
+        if gr.block_type == 2:
+            gr.sbg = [rnd.randrange(3) for _ in range(3)]
+        scf = []
+        for n, s in zip(gr.counts, gr.slen):
+            scf += [min((1 << s) - 1, int(rnd.expovariate(0.7))) if s else 0 for _ in range(n)]
+        if is_band is not None:
+            scf[is_band:] = [rnd.randrange(7) for _ in scf[is_band:]]
+        gr.scf = scf
+        if prev is not None and prev.block_type != 2 and gr.block_type != 2:
+            first = 0
+            for g, n in enumerate(gr.counts):
+                if rnd.random() < 0.5:
+                    gr.scfsi |= 8 >> g
+                    gr.scf[first:first + n] = prev.scf[first:first + n]
+                first += n
+
+    def steps(self, gr, gg):
+        """Quantizer step of every line, mirroring L3_decode_scalefactors()."""
+        shift = gr.sfs + 1
+        base = gg - 210 - (2 if self.ms else 0)
+        out = []
+        if gr.block_type == 2:
+            iscf = gr.scf + [0, 0, 0]
+            for i, w in enumerate(self.short_bands):
+                e = base - ((iscf[i] + (gr.sbg[i % 3] << (3 - shift))) << shift)
+                out += [2**(e/4.0)]*w
+        else:
+            iscf = gr.scf + [0]
+            for i, w in enumerate(self.long_bands):
+                pre = PRETAB[i - 11] if gr.preflag and 11 <= i <= 20 else 0
+                e = base - ((iscf[i] + pre) << shift)
+                out += [2**(e/4.0)]*w
+        return out
+
+    def shape(self, gr):
+        if self.edges:
+            force_edge(gr.q, self.edges[self.granule % len(self.edges)])
+
+    def fit(self, gr, budget):
+        """Smallest global_gain whose Huffman bits fit the budget."""
+        widths = self.short_bands if gr.block_type == 2 else self.long_bands
+        if gr.part2_bits() > budget//2:  # starved: no scalefactors
+            gr.sfc, gr.slen, gr.scfsi = 0, [0, 0, 0, 0], 0
+            gr.scf = [0]*len(gr.scf)
+        part2 = gr.part2_bits()
+        peak = max(abs(v) for v in gr.q_target)
+        if not peak:
+            gr.gg = 210
+            gr.q = [0]*576
+            gr.main = encode_spectrum(self.tables, gr, widths)
+            return part2
+        unit = self.steps(gr, 0)
+        ratio = max(abs(v)/s for v, s in zip(gr.q_target, unit))/MAX_Q**(4/3.0)
+        lo = min(255, max(0, int(math.ceil(4*math.log2(ratio)))))
+        hi, best = 255, None
+        while lo <= hi:
+            gg = (lo + hi)//2
+            gr.q = quantize(gr.q_target, [s*2**(gg/4.0) for s in unit])
+            self.shape(gr)
+            bits = encode_spectrum(self.tables, gr, widths)
+            if part2 + bits.n <= budget:
+                best, hi = gg, gg - 1
+            else:
+                lo = gg + 1
+        gr.gg = 255 if best is None else best
+        gr.q = quantize(gr.q_target, [s*2**(gr.gg/4.0) for s in unit])
+        self.shape(gr)
+        if best is None:
+            gr.q = [0]*576
+        gr.main = encode_spectrum(self.tables, gr, widths)
+        return part2 + gr.main.n
+
+    def scalefactor_bits(self, gr):
+        bits, first = Bits(), 0
+        for g, (n, s) in enumerate(zip(gr.counts, gr.slen)):
+            if not (gr.scfsi & (8 >> g)):
+                for v in gr.scf[first:first + n]:
+                    bits.put(v, s)
+            first += n
+        return bits
+
+    def side_info(self, grs, main_data_begin):
+        bits = Bits()
+        if self.mpeg1:
+            bits.put(main_data_begin, 9)
+            bits.put(0, 5 if self.nch == 1 else 3)
+            for ch in range(self.nch):
+                bits.put(grs[1][ch].scfsi, 4)
+        else:
+            bits.put(main_data_begin, 8)
+            bits.put(0, self.nch)
+        for gr_ch in grs:
+            for gr in gr_ch:
+                bits.put(gr.part23, 12)
+                bits.put(gr.big_values, 9)
+                bits.put(gr.gg, 8)
+                bits.put(gr.sfc, 4 if self.mpeg1 else 9)
+                bits.put(gr.block_type != 0, 1)
+                if gr.block_type:
+                    bits.put(gr.block_type, 2)
+                    bits.put(0, 1)
+                    bits.put(gr.tables[0], 5)
+                    bits.put(gr.tables[1], 5)
+                    for g in gr.sbg:
+                        bits.put(g, 3)
+                else:
+                    for t in gr.tables:
+                        bits.put(t, 5)
+                    bits.put(gr.regions[0], 4)
+                    bits.put(gr.regions[1], 3)
+                if self.mpeg1:
+                    bits.put(gr.preflag, 1)
+                bits.put(gr.sfs, 1)
+                bits.put(gr.count1_table, 1)
+        assert bits.n == self.side_bytes*8
+        return bits.tobytes()
+
+    def header(self, padding):
+        bits = Bits()
+        bits.put(0x7ff, 11)
+        bits.put(VERSION_BITS[self.version], 2)
+        bits.put(1, 2)  # Layer III
+        bits.put(1, 1)  # no CRC
+        bits.put(KBPS[1 if self.mpeg1 else 2].index(self.kbps), 4)
+        bits.put(RATES[self.version].index(self.rate), 2)
+        bits.put(padding, 1)
+        bits.put(0, 1)
+        bits.put({'stereo': 0, 'ms': 1, 'ms_is': 1, 'mono': 3}[self.mode], 2)
+        bits.put({'ms': 2, 'ms_is': 3}.get(self.mode, 0), 2)
+        bits.put(0, 4)
+        return bits.tobytes()
+
+    def plan(self):
+        """Granules of every frame, coded within the CBR budget and the bit reservoir."""
+        types = self.block_types()
+        numerator = (144 if self.mpeg1 else 72)*self.kbps*1000
+        frames, slots, used, rest = [], 0, 0, 0
+        for f in range(self.frames):
+            rest += numerator % self.rate
+            padding = int(rest >= self.rate)
+            rest -= padding*self.rate
+            slot = numerator//self.rate + padding - 4 - self.side_bytes
+            reservoir = min(511, slots - used)
+            avail = (reservoir + slot)*8
+            mean = slot*8//(self.ngr*self.nch)
+            grs = []
+            for g in range(self.ngr):
+                self.signal.next_granule()
+                bt = types[f*self.ngr + g]
+                gr_ch = []
+                for ch in range(self.nch):
+                    gr = Granule(bt)
+                    gr.q_target = self.target(bt, ch)
+                    is_band = None
+                    if self.intensity and ch:
+                        is_band = 12  # right channel silent from sfb 12 up, coded by intensity position
+                        start = sum(self.long_bands[:is_band])
+                        gr.q_target[start:] = [0.0]*(576 - start)
+                    self.scalefactors(gr, grs[0][ch] if g else None, is_band)
+                    budget = min(4095, avail, int(mean*(1.6 if bt == 2 else 1.0) + reservoir*8//(4*self.ngr*self.nch)))
+                    gr.part23 = self.fit(gr, budget)
+                    avail -= gr.part23
+                    gr_ch.append(gr)
+                grs.append(gr_ch)
+                self.granule += 1
+            frames.append((padding, slot, grs))
+            used = slots - reservoir + ((reservoir + slot)*8 - avail + 7)//8
+            slots += slot
+        return frames
+
+    def cut(self, gr, lines):
+        """gr with the lines from 'lines' up zeroed, recoded with the same gain and scalefactors."""
+        twin = copy.copy(gr)
+        twin.q = gr.q[:lines] + [0]*(576 - lines)
+        twin.main = encode_spectrum(self.tables, twin, self.short_bands if gr.block_type == 2 else self.long_bands)
+        twin.part23 = twin.part2_bits() + twin.main.n
+        return twin
+
+    def write(self, frames, lines=576):
+        out, slots, main = [], 0, bytearray()
+        for padding, slot, grs in frames:
+            reservoir = slots - len(main)
+            if reservoir > 511:
+                main += bytes(reservoir - 511)
+                reservoir = 511
+            if lines < 576:
+                grs = [[self.cut(gr, lines) for gr in gr_ch] for gr_ch in grs]
+            data = Bits()
+            for gr in (gr for gr_ch in grs for gr in gr_ch):
+                data.append(self.scalefactor_bits(gr))
+                data.append(gr.main)
+            assert data.n <= (reservoir + slot)*8
+            out.append((self.header(padding), self.side_info(grs, reservoir), slots, slot))
+            main += data.tobytes()
+            slots += slot
+        main += bytes(max(0, slots - len(main)))
+        return b''.join(h + side + bytes(main[pos:pos + slot]) for h, side, pos, slot in out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('src', nargs='?', default=DEFAULT_SRC)
+    ap.add_argument('out', nargs='?', default=DEFAULT_OUT)
+    args = ap.parse_args()
+
+    tables = Tables(open(args.src).read())
+    os.makedirs(args.out, exist_ok=True)
+
+    def save(name, data):
+        with open(os.path.join(args.out, name + '.mp3'), 'wb') as f:
+            f.write(data)
+        print('%-20s %7d bytes' % (name, len(data)))
+
+    for stream in STREAMS:
+        enc = Encoder(tables, *stream)
+        save(stream[0], enc.write(enc.plan()))
+    enc = Encoder(tables, *LOWPASS, edges=LOWPASS_EDGES)
+    frames = enc.plan()
+    save(LOWPASS[0], enc.write(frames))
+    for suffix, lines in LOWPASS_CUTS:
+        save(LOWPASS[0] + suffix, enc.write(frames, lines))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+"""Generate modules/mp3dec/minimp3_side_power.h from the Huffman tables in minimp3.h.
+
+mp3dec_frame_power() estimates a granule's loudness from its side info alone:
+which table codes each region, how many bits it took and the scalefactor
+sizes. It needs, per Huffman table, what a line holds on average. A prefix
+code fits the distribution P(codeword) = 2^-length best, so with that
+distribution this script computes
+
+    g_side_energy  mean |q|^(8/3) per line (the dequantizer's power law); for
+                   the escape tables 16..31 over the values below 15, as the
+                   escapes are accounted by g_side_peak
+    g_side_bits    mean bits per line: codeword, sign bits and, for the escape
+                   tables, linbits after each 15
+    g_side_peak    (15 + 2^linbits/2)^(8/3): an escape table is only chosen for
+                   a region holding about such a value
+    g_side_scf     mean of 2^(-2*m*s) over the scalefactors s = 0..2^slen - 1
+                   (m = 0.5 or 1 per scalefac_scale): the attenuation of a
+                   partition whose scalefactors are not decoded
+
+The big_values entries come first (0 for the unused tables 0, 4 and 14), then
+count1 tables A and B (4 lines per codeword).
+
+Usage: tools/gen_side_power.py [minimp3.h] [minimp3_side_power.h]
+"""
+
+import argparse
+import os
+import re
+
+from gen_huff_wide import parse_array, walk
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_SRC = os.path.join(HERE, '..', 'modules', 'mp3dec', 'minimp3.h')
+DEFAULT_DST = os.path.join(HERE, '..', 'modules', 'mp3dec', 'minimp3_side_power.h')
+
+UNUSED = (0, 4, 14)  # table_select values with no table
+ESCAPE = 15          # big_values at or above it carry linbits (tables 16..31)
+SCF_SLEN_MAX = 5     # scalefactor sizes above share the last column
+DIGITS = 4
+
+
+def power(q):
+    return q ** (8.0/3)
+
+
+def big_values(codes, linbits, escape):
+    """(energy, bits) per line of one table, codes as walk() returns them."""
+    prob = bits = energy = below = 0.0
+    for (_, n), v in codes.items():
+        x, y = v & 15, v >> 4
+        p = 2.0 ** -n
+        prob += p
+        bits += p*(n + (x > 0) + (y > 0) + linbits*((x == ESCAPE) + (y == ESCAPE)))
+        if not escape or (x < ESCAPE and y < ESCAPE):
+            below += p
+            energy += p*(power(x) + power(y))
+    return energy/below/2, bits/prob/2
+
+
+def count1(tab32):
+    """(energy, bits) per line of count1 tables A and B."""
+    prob = bits = ones = 0.0
+    for p in range(64):  # tab32 resolved for every 6-bit peek, as gen_huff_wide.py does
+        leaf = tab32[p >> 2]
+        if not (leaf & 8):
+            leaf = tab32[(leaf >> 3) + ((p & 3) >> (2 - (leaf & 3)))]
+        n, nonzero = leaf & 7, bin(leaf >> 4).count('1')
+        prob += 1/64.0
+        bits += (n + nonzero)/64.0
+        ones += nonzero/64.0
+    # table B: a fixed 4-bit code, every quad equally likely
+    return [(ones/prob/4, bits/prob/4), (0.5, 1.5)]
+
+
+def f32(v):
+    s = re.sub(r'e\+?(-?)0*', r'e\1', '%.*g' % (DIGITS, v))
+    if s == '0':
+        return '0'
+    return s + ('f' if '.' in s or 'e' in s else '.0f')
+
+
+def rows(values, per_row, indent='    '):
+    return ',\n'.join(indent + ', '.join(f32(v) for v in values[i:i + per_row])
+                      for i in range(0, len(values), per_row))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('src', nargs='?', default=DEFAULT_SRC)
+    ap.add_argument('dst', nargs='?', default=DEFAULT_DST)
+    args = ap.parse_args()
+
+    src = open(args.src).read()
+    tabs = parse_array(src, 'tabs')
+    tabindex = parse_array(src, 'tabindex')
+    tab32 = parse_array(src, 'tab32')
+    linbits = parse_array(src, 'g_linbits')
+
+    energy, bits = [], []
+    for t, base in enumerate(tabindex):
+        if t in UNUSED:
+            e, b = 0.0, 0.0
+        else:
+            codes = {}
+            walk(tabs, base, 0, 5, 0, 0, codes)
+            e, b = big_values(codes, linbits[t], t >= 16)
+        energy.append(e)
+        bits.append(b)
+    for e, b in count1(tab32):
+        energy.append(e)
+        bits.append(b)
+    peak = [power(ESCAPE + 2 ** lb / 2.0) for lb in linbits[16:]]
+    scf = [[sum(2.0 ** (-2*m*s) for s in range(2 ** slen)) / 2 ** slen for slen in range(SCF_SLEN_MAX + 1)]
+           for m in (0.5, 1.0)]
+
+    with open(args.dst, 'w') as f:
+        f.write('/* Generated by tools/gen_side_power.py from minimp3.h, do not edit.\n')
+        f.write('   Per-table line statistics for mp3dec_frame_power(), see the script. */\n')
+        f.write('#ifndef MINIMP3_SIDE_POWER_H\n#define MINIMP3_SIDE_POWER_H\n\n')
+        f.write('/* mean |q|^(8/3) per line: big_values tables 0..31, then count1 tables A and B */\n')
+        f.write('static const float g_side_energy[34] = {\n%s\n};\n' % rows(energy, 8))
+        f.write('/* mean bits per line, same order */\n')
+        f.write('static const float g_side_bits[34] = {\n%s\n};\n' % rows(bits, 8))
+        f.write('/* (15 + 2^linbits/2)^(8/3) for tables 16..31 */\n')
+        f.write('static const float g_side_peak[16] = {\n%s\n};\n' % rows(peak, 8))
+        f.write('/* mean attenuation of a partition by scalefac_scale and scalefactor bits (0..5) */\n')
+        f.write('static const float g_side_scf[2][6] = {\n%s\n};\n\n' % ',\n'.join(
+            '    { %s }' % ', '.join(f32(v) for v in row) for row in scf))
+        f.write('#endif /* MINIMP3_SIDE_POWER_H */\n')
+
+
+if __name__ == '__main__':
+    main()
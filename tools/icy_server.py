@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""Stand-in Shoutcast/Icecast server for trying MP3Decoder.set_live().
+
+Loops an MP3 file as an ICY stream: a client that sends "Icy-MetaData: 1"
+gets an icy-metaint header and a metadata block (StreamTitle='...';) after
+every metaint audio bytes, with the title changing every --title-every
+seconds. The audio is paced at --rate times the file's average bitrate, and
+--stall stops sending for a while every --stall-every seconds, so the jitter
+buffer and its underrun counter can be watched without a real radio station.
+With --once each client gets the file once and the connection is closed, so
+a client's PCM can be compared with a plain decode (conformance/live.py).
+
+Usage: tools/icy_server.py [--port 8000] [--metaint 16000] [--rate 1.0]
+                           [--stall SEC] [--stall-every SEC] [--once]
+                           [--dump FILE] file.mp3
+
+Client side (MicroPython, unix port or board):
+
+    s = socket.socket(); s.connect(addr)
+    s.write(b'GET / HTTP/1.0\\r\\nIcy-MetaData: 1\\r\\n\\r\\n')
+    ...read the header lines up to the empty one, note icy-metaint...
+    dec = mp3dec.MP3Decoder(s, 32768)
+    dec.set_live(metaint)
+    n = dec.decode(pcm)     # None while buffering, 0 at the end
+    dec.get_title(), dec.stats()['underruns']
+
+A stream captured with --dump decodes natively with cli/mp3dec -I metaint.
+"""
+
+import argparse
+import socketserver
+import time
+
+
+def mp3_bitrate(data):
+    """Average bitrate in bytes/s from the first MPEG-1/2 Layer III header."""
+    rates = {3: [0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320],
+             2: [0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160]}
+    for i in range(len(data) - 3):
+        if data[i] == 0xff and data[i + 1] & 0xe6 == 0xe2:
+            version = 3 if data[i + 1] & 0x08 else 2
+            index = data[i + 2] >> 4
+            if 0 < index < 15:
+                return rates[version][index] * 1000 // 8
+    return 16000
+
+
+def metadata(title):
+    """One ICY metadata block: length byte in 16-byte units, then the text."""
+    text = ("StreamTitle='%s';" % title).encode('utf-8')[:255 * 16]
+    text += b'\0' * (-len(text) % 16)
+    return bytes([len(text) // 16]) + text
+
+
+class IcyStream:
+    def __init__(self, args):
+        with open(args.file, 'rb') as f:
+            self.data = f.read()
+        self.args = args
+        self.byte_rate = mp3_bitrate(self.data) * args.rate
+
+    def chunks(self, metaint):
+        """Audio (and metadata) to send, forever or once with --once."""
+        pos, sent, start = 0, 0, time.monotonic()
+        while True:
+            n = metaint or 4096
+            if self.args.once:
+                n = min(n, len(self.data) - sent)
+                if not n:
+                    return
+            audio = b''
+            while len(audio) < n:
+                take = self.data[pos:pos + n - len(audio)]
+                audio += take
+                pos = (pos + len(take)) % len(self.data)
+            chunk = audio
+            if metaint and len(audio) == metaint:  # Not after a short last block
+                elapsed = time.monotonic() - start
+                chunk += metadata('Song %d' % (int(elapsed / self.args.title_every) + 1))
+            yield chunk
+            sent += len(audio)
+            # Pace at the bitrate, plus the configured stalls
+            due = start + sent / self.byte_rate
+            if self.args.stall and self.args.stall_every:
+                due += self.args.stall * int((due - start) / self.args.stall_every)
+            delay = due - time.monotonic()
+            if delay > 0:
+                time.sleep(delay)
+
+
+class Handler(socketserver.StreamRequestHandler):
+    def handle(self):
+        headers = {}
+        while True:
+            line = self.rfile.readline().decode('latin-1').strip()
+            if not line:
+                break
+            if ':' in line:
+                key, value = line.split(':', 1)
+                headers[key.strip().lower()] = value.strip()
+        args = self.server.stream.args
+        metaint = args.metaint if headers.get('icy-metadata') == '1' else 0
+        reply = 'ICY 200 OK\r\nicy-name: icy_server.py\r\ncontent-type: audio/mpeg\r\n'
+        if metaint:
+            reply += 'icy-metaint: %d\r\n' % metaint
+        self.wfile.write((reply + '\r\n').encode('latin-1'))
+        print('%s: streaming, metaint %d' % (self.client_address[0], metaint), flush=True)
+        dump = open(args.dump, 'wb') if args.dump else None
+        try:
+            for chunk in self.server.stream.chunks(metaint):
+                self.wfile.write(chunk)
+                if dump:
+                    dump.write(chunk)
+        except (BrokenPipeError, ConnectionResetError):
+            print('%s: disconnected' % self.client_address[0])
+        finally:
+            if dump:
+                dump.close()
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('--port', type=int, default=8000, help='0: any free port (printed)')
+    ap.add_argument('--metaint', type=int, default=16000, help='audio bytes between metadata blocks')
+    ap.add_argument('--rate', type=float, default=1.0, help='send speed relative to the bitrate')
+    ap.add_argument('--title-every', type=float, default=10.0, help='seconds per title')
+    ap.add_argument('--stall', type=float, default=0.0, help='seconds to stop sending')
+    ap.add_argument('--stall-every', type=float, default=0.0, help='seconds between stalls')
+    ap.add_argument('--once', action='store_true', help='send the file once, then close the connection')
+    ap.add_argument('--dump', help='also write the stream (with metadata) to this file')
+    ap.add_argument('file')
+    args = ap.parse_args()
+
+    socketserver.ThreadingTCPServer.allow_reuse_address = True
+    server = socketserver.ThreadingTCPServer(('', args.port), Handler)
+    server.stream = IcyStream(args)
+    print('serving %s on port %d (%.0f bytes/s)' % (args.file, server.server_address[1], server.stream.byte_rate),
+          flush=True)
+    server.serve_forever()
+
+
+if __name__ == '__main__':
+    main()